@@ -12,6 +12,8 @@
 #ifndef CHC_COLLISIONSYSTEM_H
 #define CHC_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCCollisionInfo.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/core/ChApiCE.h"
@@ -152,6 +154,29 @@ class ChApi ChCollisionSystem {
     /// Perform a ray-hit test with the collision models.
     virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) = 0;
 
+    /// Segment used for batched ray-hit tests, see RayHitBatch().
+    struct ChRay {
+        ChVector<> from;  ///< start point in absolute space coordinates
+        ChVector<> to;    ///< end point in absolute space coordinates
+    };
+
+    /// Perform a batch of ray-hit tests with the collision models; results[i] is the result of rays[i].
+    /// Rays are treated as models of family 0, as in RayHit(): a model is considered if its family group is
+    /// in the given family mask (by default, all) and if its own family mask does not exclude family 0.
+    /// This default implementation calls RayHit() for each ray and discards the hits of filtered out models,
+    /// hence it may miss a model behind one filtered out; collision systems override it with queries that
+    /// skip such models and process the rays in parallel.
+    /// Must not be called while the collision detection is running.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             short int family_mask = 0x7FFF) {
+        results.resize(rays.size());
+        for (size_t i = 0; i < rays.size(); i++) {
+            if (RayHit(rays[i].from, rays[i].to, results[i]) && !(results[i].hitModel->GetFamilyGroup() & family_mask))
+                results[i].hit = false;
+        }
+    }
+
     // SERIALIZATION
 
     virtual void ArchiveOUT(ChArchiveOut& marchive) {
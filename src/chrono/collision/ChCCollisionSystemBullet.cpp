@@ -9,6 +9,8 @@
 // and at http://projectchrono.org/license-chrono.txt.
 //
 
+#include <algorithm>
+
 #include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
@@ -16,6 +18,7 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainerBase.h"
 #include "chrono/physics/ChProximityContainerBase.h"
+#include "chrono/utils/ChZoneProfiler.h"
 #include "chrono/collision/bullet/LinearMath/btPoolAllocator.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSphereShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCylinderShape.h"
@@ -1258,12 +1261,15 @@ void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_PROFILE_ZONE("ChCollisionSystemBullet::Run");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
 }
 
 void ChCollisionSystemBullet::ReportContacts(ChContactContainerBase* mcontactcontainer) {
+    CH_PROFILE_ZONE("ChCollisionSystemBullet::ReportContacts");
+
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
@@ -1392,6 +1398,177 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from, const ChVector<>& t
     return false;
 }
 
+// Closest-hit ray callback with the family filter of RayHit(), restricted to the given family mask:
+// the ray is in the default group (family 0), the object group must be in the family mask and the
+// object mask must include the ray group. Objects in the given (sorted) list are excluded.
+class _FamilyRayResultCallback : public btCollisionWorld::ClosestRayResultCallback {
+  public:
+    _FamilyRayResultCallback(const btVector3& from,
+                             const btVector3& to,
+                             short int family_mask,
+                             const std::vector<btCollisionObject*>& excluded)
+        : btCollisionWorld::ClosestRayResultCallback(from, to), m_excluded(excluded) {
+        m_collisionFilterMask = family_mask;
+    }
+
+    virtual bool needsCollision(btBroadphaseProxy* proxy0) const override {
+        if (!btCollisionWorld::ClosestRayResultCallback::needsCollision(proxy0))
+            return false;
+        btCollisionObject* object = static_cast<btCollisionObject*>(proxy0->m_clientObject);
+        return !std::binary_search(m_excluded.begin(), m_excluded.end(), object);
+    }
+
+    const std::vector<btCollisionObject*>& m_excluded;
+};
+
+// Broadphase callback casting a ray as btCollisionWorld::rayTest(), except for compound shapes.
+// For these, btCollisionWorld::rayTestSingle() temporarily sets each child shape as the shape of the
+// collision object, so that concurrent rays on the same object would conflict. Here the children
+// are tested one by one (with AABB culling), leaving the collision object untouched.
+class _BatchRayCallback : public btBroadphaseRayCallback {
+  public:
+    _BatchRayCallback(const btVector3& from, const btVector3& to, btCollisionWorld::RayResultCallback& result)
+        : m_from(from), m_to(to), m_result(result) {
+        m_from_trans.setIdentity();
+        m_from_trans.setOrigin(from);
+        m_to_trans.setIdentity();
+        m_to_trans.setOrigin(to);
+
+        // As in btSingleRayCallback
+        btVector3 dir = (to - from).normalized();
+        for (int k = 0; k < 3; k++) {
+            m_rayDirectionInverse[k] = dir[k] == btScalar(0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1) / dir[k];
+            m_signs[k] = m_rayDirectionInverse[k] < 0;
+        }
+        m_lambda_max = dir.dot(to - from);
+    }
+
+    virtual bool process(const btBroadphaseProxy* proxy) override {
+        if (m_result.m_closestHitFraction == btScalar(0))
+            return false;
+        btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        if (m_result.needsCollision(object->getBroadphaseHandle()))
+            RayTestShape(object, object->getCollisionShape(), object->getWorldTransform());
+        return true;
+    }
+
+  private:
+    void RayTestShape(btCollisionObject* object, const btCollisionShape* shape, const btTransform& trans) {
+        if (!shape->isCompound()) {
+            btCollisionWorld::rayTestSingle(m_from_trans, m_to_trans, object, shape, trans, m_result);
+            return;
+        }
+        const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+        for (int i = 0; i < compound->getNumChildShapes(); i++) {
+            const btCollisionShape* child = compound->getChildShape(i);
+            btTransform child_trans = trans * compound->getChildTransform(i);
+            btVector3 aabb_min, aabb_max, normal;
+            child->getAabb(child_trans, aabb_min, aabb_max);
+            btScalar param = m_result.m_closestHitFraction;
+            if (btRayAabb(m_from, m_to, aabb_min, aabb_max, param, normal))
+                RayTestShape(object, child, child_trans);
+        }
+    }
+
+    btVector3 m_from;
+    btVector3 m_to;
+    btTransform m_from_trans;
+    btTransform m_to_trans;
+    btCollisionWorld::RayResultCallback& m_result;
+};
+
+// Check if the shape is (or contains) a GImpact shape.
+static bool _HasGImpactShape(const btCollisionShape* shape) {
+    if (shape->getShapeType() == GIMPACT_SHAPE_PROXYTYPE)
+        return true;
+    if (shape->isCompound()) {
+        const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+        for (int i = 0; i < compound->getNumChildShapes(); i++) {
+            if (_HasGImpactShape(compound->getChildShape(i)))
+                return true;
+        }
+    }
+    return false;
+}
+
+// Store the hit of the ray callback in the ray-hit result, if it refers to a collision model.
+static void _SetRayhitResult(const btCollisionWorld::ClosestRayResultCallback& rayCallback,
+                             ChCollisionSystem::ChRayhitResult& mresult) {
+    ChCollisionModel* model = (ChCollisionModel*)(rayCallback.m_collisionObject->getUserPointer());
+    if (!model)
+        return;
+    mresult.hit = true;
+    mresult.hitModel = model;
+    mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                             rayCallback.m_hitPointWorld.z());
+    mresult.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                              rayCallback.m_hitNormalWorld.z());
+    mresult.abs_hitNormal.Normalize();
+    mresult.dist_factor = rayCallback.m_closestHitFraction;
+}
+
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays,
+                                          std::vector<ChRayhitResult>& results,
+                                          short int family_mask) {
+    results.resize(rays.size());
+
+    // GImpact meshes lock and unlock their vertex data at each query, which is not thread-safe:
+    // collision objects with such shapes are tested in a serial pass.
+    std::vector<btCollisionObject*> gimpact_objects;
+    _FamilyRayResultCallback filter(btVector3(0, 0, 0), btVector3(0, 0, 0), family_mask, gimpact_objects);
+    btCollisionObjectArray& objects = bt_collision_world->getCollisionObjectArray();
+    for (int j = 0; j < objects.size(); j++) {
+        if (filter.needsCollision(objects[j]->getBroadphaseHandle()) &&
+            _HasGImpactShape(objects[j]->getCollisionShape()))
+            gimpact_objects.push_back(objects[j]);
+    }
+    std::sort(gimpact_objects.begin(), gimpact_objects.end());
+
+    // Other ray tests only read the collision world (the traversal of the broadphase tree uses
+    // a local stack, compound shapes are handled by _BatchRayCallback), so that the rays can be
+    // processed in parallel.
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int i = 0; i < (int)rays.size(); i++) {
+        btVector3 btfrom((btScalar)rays[i].from.x(), (btScalar)rays[i].from.y(), (btScalar)rays[i].from.z());
+        btVector3 btto((btScalar)rays[i].to.x(), (btScalar)rays[i].to.y(), (btScalar)rays[i].to.z());
+
+        _FamilyRayResultCallback rayCallback(btfrom, btto, family_mask, gimpact_objects);
+        _BatchRayCallback broadphaseCallback(btfrom, btto, rayCallback);
+        bt_broadphase->rayTest(btfrom, btto, broadphaseCallback);
+
+        results[i].hit = false;
+        if (rayCallback.hasHit())
+            _SetRayhitResult(rayCallback, results[i]);
+    }
+
+    if (gimpact_objects.empty())
+        return;
+
+    for (int i = 0; i < (int)rays.size(); i++) {
+        btVector3 btfrom((btScalar)rays[i].from.x(), (btScalar)rays[i].from.y(), (btScalar)rays[i].from.z());
+        btVector3 btto((btScalar)rays[i].to.x(), (btScalar)rays[i].to.y(), (btScalar)rays[i].to.z());
+        btTransform from_trans(btMatrix3x3::getIdentity(), btfrom);
+        btTransform to_trans(btMatrix3x3::getIdentity(), btto);
+
+        for (auto object : gimpact_objects) {
+            // Only hits closer than the current one are accepted
+            btCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+            rayCallback.m_closestHitFraction = results[i].hit ? (btScalar)results[i].dist_factor : btScalar(1);
+
+            btScalar param = rayCallback.m_closestHitFraction;
+            btVector3 normal;
+            btBroadphaseProxy* proxy = object->getBroadphaseHandle();
+            if (!btRayAabb(btfrom, btto, proxy->m_aabbMin, proxy->m_aabbMax, param, normal))
+                continue;
+
+            btCollisionWorld::rayTestSingle(from_trans, to_trans, object, object->getCollisionShape(),
+                                            object->getWorldTransform(), rayCallback);
+            if (rayCallback.hasHit())
+                _SetRayhitResult(rayCallback, results[i]);
+        }
+    }
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (btScalar)threshold;
 }
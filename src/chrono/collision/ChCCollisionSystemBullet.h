@@ -75,6 +75,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Perform a raycast (ray-hit test with the collision models).
     virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult);
 
+    /// Perform a batch of raycasts, in parallel (see ChCollisionSystem::RayHitBatch).
+    /// With the default \a family_mask, results are the same as those of RayHit().
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             short int family_mask = 0x7FFF);
+
     // For Bullet related stuff
     btCollisionWorld* GetBulletCollisionWorld() { return bt_collision_world; }
 
@@ -0,0 +1,385 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <set>
+
+#include "chrono/core/ChSparseLDLT.h"
+#include "chrono/parallel/ChOpenMP.h"
+
+namespace chrono {
+
+ChSparseLDLT::ChSparseLDLT()
+    : m_ordering(Ordering::MINIMUM_DEGREE),
+      m_npos(std::numeric_limits<int>::max()),
+      m_perturbation(1e-8),
+      m_analyzed(false),
+      m_analyzed_npos(0),
+      m_n(0),
+      m_num_perturbed(0),
+      m_num_analyses(0) {
+    m_nthreads = CHOMPfunctions::GetNumProcs();
+}
+
+// Minimum degree ordering, by explicit elimination of the nodes of the graph of A: at each step
+// the node with fewest neighbors is eliminated and its neighbors are connected to each other.
+// Rows expected to give negative pivots (constraints) become eligible only after all their neighbor
+// rows with positive pivots (variables) were eliminated: this way the pivots of the variables come from
+// the positive definite block, and the ones of the constraints from the negative definite Schur complement.
+void ChSparseLDLT::OrderMinimumDegree(const int* Ap, const int* Ai) {
+    std::vector<std::vector<int>> adj(m_n);
+    for (int i = 0; i < m_n; i++) {
+        for (int p = Ap[i]; p < Ap[i + 1]; p++) {
+            if (Ai[p] != i) {
+                adj[i].push_back(Ai[p]);
+                adj[Ai[p]].push_back(i);
+            }
+        }
+    }
+
+    int npos = m_npos;
+    auto is_eligible = [&adj, npos](int i) {
+        return i < npos || std::all_of(adj[i].begin(), adj[i].end(), [npos](int v) { return v >= npos; });
+    };
+
+    std::set<std::pair<int, int>> queue;  // (degree, node) of eligible nodes
+    std::vector<char> eligible(m_n);
+    std::vector<char> eliminated(m_n, 0);
+    for (int i = 0; i < m_n; i++) {
+        std::sort(adj[i].begin(), adj[i].end());
+        adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+    }
+    for (int i = 0; i < m_n; i++) {
+        eligible[i] = is_eligible(i);
+        if (eligible[i])
+            queue.insert(std::make_pair((int)adj[i].size(), i));
+    }
+
+    m_perm.clear();
+    std::vector<int> merged;
+    while (!queue.empty()) {
+        int p = queue.begin()->second;
+        queue.erase(queue.begin());
+        m_perm.push_back(p);
+        eliminated[p] = 1;
+
+        const std::vector<int>& nbrs = adj[p];
+        for (int u : nbrs) {
+            if (eligible[u])
+                queue.erase(std::make_pair((int)adj[u].size(), u));
+            merged.clear();
+            std::set_union(adj[u].begin(), adj[u].end(), nbrs.begin(), nbrs.end(), std::back_inserter(merged));
+            merged.erase(std::remove_if(merged.begin(), merged.end(), [=](int v) { return v == u || v == p; }),
+                         merged.end());
+            adj[u].swap(merged);
+            eligible[u] = is_eligible(u);
+            if (eligible[u])
+                queue.insert(std::make_pair((int)adj[u].size(), u));
+        }
+        std::vector<int>().swap(adj[p]);
+    }
+
+    // Every row becomes eligible once its variable neighbors are eliminated; this is only a safeguard
+    for (int i = 0; i < m_n; i++) {
+        if (!eliminated[i])
+            m_perm.push_back(i);
+    }
+}
+
+void ChSparseLDLT::Analyze(ChCSR3Matrix& A) {
+    m_n = A.GetNumRows();
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    m_Sp.assign(Ap, Ap + m_n + 1);
+    m_Si.assign(Ai, Ai + Ap[m_n]);
+
+    AnalyzePattern();
+    MapValues(A);
+}
+
+void ChSparseLDLT::AnalyzePattern() {
+    const int* Ap = m_Sp.data();
+    const int* Ai = m_Si.data();
+
+    // Fill-reducing ordering
+    if (m_ordering == Ordering::MINIMUM_DEGREE) {
+        OrderMinimumDegree(Ap, Ai);
+    } else {
+        m_perm.resize(m_n);
+        for (int i = 0; i < m_n; i++)
+            m_perm[i] = i;
+    }
+    m_pinv.resize(m_n);
+    for (int k = 0; k < m_n; k++)
+        m_pinv[m_perm[k]] = k;
+
+    // Elimination tree and pattern of L. The k-th row of L has the nodes reached going up the
+    // tree from the entries of the upper triangle of the k-th row of C (see T. Davis, LDL).
+    m_parent.assign(m_n, -1);
+    std::vector<int> flag(m_n);
+    std::vector<int> col_count(m_n, 0);
+    std::vector<int> row_count(m_n, 0);
+    for (int k = 0; k < m_n; k++) {
+        flag[k] = k;
+        int i = m_perm[k];
+        for (int p = Ap[i]; p < Ap[i + 1]; p++) {
+            for (int c = m_pinv[Ai[p]]; c < k && flag[c] != k; c = m_parent[c]) {
+                if (m_parent[c] == -1)
+                    m_parent[c] = k;
+                col_count[c]++;
+                row_count[k]++;
+                flag[c] = k;
+            }
+        }
+    }
+
+    m_Lp.assign(m_n + 1, 0);
+    m_Rp.assign(m_n + 1, 0);
+    for (int k = 0; k < m_n; k++) {
+        m_Lp[k + 1] = m_Lp[k] + col_count[k];
+        m_Rp[k + 1] = m_Rp[k] + row_count[k];
+    }
+    m_Li.resize(m_Lp[m_n]);
+    m_Ri.resize(m_Rp[m_n]);
+    m_Rpos.resize(m_Rp[m_n]);
+
+    // Rows are visited in increasing order, so the row indices of each column come out sorted
+    std::vector<int> col_fill(m_Lp.begin(), m_Lp.end() - 1);
+    for (int k = 0; k < m_n; k++) {
+        flag[k] = k;
+        int q = m_Rp[k];
+        int i = m_perm[k];
+        for (int p = Ap[i]; p < Ap[i + 1]; p++) {
+            for (int c = m_pinv[Ai[p]]; c < k && flag[c] != k; c = m_parent[c]) {
+                m_Li[col_fill[c]] = k;
+                m_Ri[q] = c;
+                m_Rpos[q] = col_fill[c];
+                col_fill[c]++;
+                q++;
+                flag[c] = k;
+            }
+        }
+    }
+
+    // Levels of the elimination tree: a column only depends on columns of lower levels
+    std::vector<int> level(m_n, 0);
+    int nlevels = 0;
+    for (int j = 0; j < m_n; j++) {
+        if (m_parent[j] != -1)
+            level[m_parent[j]] = std::max(level[m_parent[j]], level[j] + 1);
+        nlevels = std::max(nlevels, level[j] + 1);
+    }
+    m_level_ptr.assign(nlevels + 1, 0);
+    for (int j = 0; j < m_n; j++)
+        m_level_ptr[level[j] + 1]++;
+    for (int l = 0; l < nlevels; l++)
+        m_level_ptr[l + 1] += m_level_ptr[l];
+    m_level_cols.resize(m_n);
+    std::vector<int> level_fill(m_level_ptr.begin(), m_level_ptr.end() - 1);
+    for (int j = 0; j < m_n; j++)
+        m_level_cols[level_fill[level[j]]++] = j;
+
+    m_Lx.resize(m_Li.size());
+    m_D.resize(m_n);
+
+    m_analyzed = true;
+    m_analyzed_npos = m_npos;
+    m_num_analyses++;
+}
+
+void ChSparseLDLT::MapValues(ChCSR3Matrix& A) {
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    m_Ap.assign(Ap, Ap + m_n + 1);
+    m_Ai.assign(Ai, Ai + Ap[m_n]);
+
+    // Lower triangle of C = P*A*P': the j-th column of C is the row perm[j] of A
+    m_Cp.assign(m_n + 1, 0);
+    m_Ci.clear();
+    m_Csrc.clear();
+    for (int j = 0; j < m_n; j++) {
+        int i = m_perm[j];
+        for (int p = Ap[i]; p < Ap[i + 1]; p++) {
+            if (m_pinv[Ai[p]] >= j) {
+                m_Ci.push_back(m_pinv[Ai[p]]);
+                m_Csrc.push_back(p);
+            }
+        }
+        m_Cp[j + 1] = (int)m_Ci.size();
+    }
+}
+
+bool ChSparseLDLT::SamePattern(const ChCSR3Matrix& A) const {
+    if (A.GetNumRows() != m_n || A.GetNumColumns() != m_n || A.GetNNZ() != (int)m_Ai.size())
+        return false;
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    return std::equal(m_Ap.begin(), m_Ap.end(), Ap) && std::equal(m_Ai.begin(), m_Ai.end(), Ai);
+}
+
+bool ChSparseLDLT::ContainedPattern(const ChCSR3Matrix& A) const {
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    for (int i = 0; i < m_n; i++) {
+        if (!std::includes(m_Si.begin() + m_Sp[i], m_Si.begin() + m_Sp[i + 1], Ai + Ap[i], Ai + Ap[i + 1]))
+            return false;
+    }
+    return true;
+}
+
+void ChSparseLDLT::MergePattern(const ChCSR3Matrix& A) {
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    std::vector<int> Sp(m_n + 1, 0);
+    std::vector<int> Si;
+    Si.reserve(m_Si.size() + Ap[m_n]);
+    for (int i = 0; i < m_n; i++) {
+        std::set_union(m_Si.begin() + m_Sp[i], m_Si.begin() + m_Sp[i + 1], Ai + Ap[i], Ai + Ap[i + 1],
+                       std::back_inserter(Si));
+        Sp[i + 1] = (int)Si.size();
+    }
+    m_Sp.swap(Sp);
+    m_Si.swap(Si);
+}
+
+// Left-looking factorization of the j-th column, using the work vector w (zero on input and output).
+// Returns 1 if the pivot was perturbed, -1 if it is zero, 0 otherwise.
+int ChSparseLDLT::FactorizeColumn(int j, const double* Ax, double threshold, std::vector<double>& w) {
+    for (int p = m_Cp[j]; p < m_Cp[j + 1]; p++)
+        w[m_Ci[p]] += Ax[m_Csrc[p]];
+
+    // Updates from the columns k with L(j,k) != 0, all factorized already (descendants of j)
+    for (int q = m_Rp[j]; q < m_Rp[j + 1]; q++) {
+        int k = m_Ri[q];
+        int pos = m_Rpos[q];
+        double ljk = m_Lx[pos];
+        double f = ljk * m_D[k];
+        w[j] -= f * ljk;
+        for (int t = pos + 1; t < m_Lp[k + 1]; t++)
+            w[m_Li[t]] -= f * m_Lx[t];
+    }
+
+    double d = w[j];
+    w[j] = 0;
+
+    int status = 0;
+    if (std::abs(d) <= threshold) {
+        if (threshold > 0) {
+            d = (m_perm[j] < m_npos) ? threshold : -threshold;
+            status = 1;
+        } else {
+            d = 1;
+            status = -1;
+        }
+    }
+    m_D[j] = d;
+
+    for (int t = m_Lp[j]; t < m_Lp[j + 1]; t++) {
+        m_Lx[t] = w[m_Li[t]] / d;
+        w[m_Li[t]] = 0;
+    }
+
+    return status;
+}
+
+bool ChSparseLDLT::Factorize(ChCSR3Matrix& A) {
+    // The pattern of the assembled matrix can lose entries that happen to be exactly zero: the analysis
+    // is kept as long as the pattern is contained in the analyzed one, otherwise it is repeated on the
+    // union of the two patterns, so that it settles after a few steps.
+    if (!m_analyzed || m_analyzed_npos != m_npos || A.GetNumRows() != m_n) {
+        Analyze(A);
+    } else if (!SamePattern(A)) {
+        if (!ContainedPattern(A)) {
+            MergePattern(A);
+            AnalyzePattern();
+        }
+        MapValues(A);
+    }
+
+    const double* Ax = A.GetCSR_ValueArray();
+    double amax = 0;
+    for (int p = 0; p < m_Ap[m_n]; p++)
+        amax = std::max(amax, std::abs(Ax[p]));
+    double threshold = m_perturbation * amax;
+
+    // Levels with enough columns are factorized in parallel, the others (typically the
+    // chain at the top of the elimination tree) serially.
+    int nthreads = std::max(m_nthreads, 1);
+    int nlevels = (int)m_level_ptr.size() - 1;
+    int nparallel = 0;
+    if (nthreads > 1) {
+        while (nparallel < nlevels && m_level_ptr[nparallel + 1] - m_level_ptr[nparallel] >= 2 * nthreads)
+            nparallel++;
+    }
+
+    int num_perturbed = 0;
+    int num_zero = 0;
+
+    if (nparallel > 0) {
+#pragma omp parallel num_threads(nthreads)
+        {
+            std::vector<double> w(m_n, 0.0);
+            for (int l = 0; l < nparallel; l++) {
+#pragma omp for schedule(dynamic, 8) reduction(+ : num_perturbed, num_zero)
+                for (int c = m_level_ptr[l]; c < m_level_ptr[l + 1]; c++) {
+                    int status = FactorizeColumn(m_level_cols[c], Ax, threshold, w);
+                    num_perturbed += (status == 1);
+                    num_zero += (status == -1);
+                }
+            }
+        }
+    }
+
+    std::vector<double> w(m_n, 0.0);
+    for (int c = m_level_ptr[nparallel]; c < m_n; c++) {
+        int status = FactorizeColumn(m_level_cols[c], Ax, threshold, w);
+        num_perturbed += (status == 1);
+        num_zero += (status == -1);
+    }
+
+    m_num_perturbed = num_perturbed;
+    return num_zero == 0;
+}
+
+void ChSparseLDLT::Solve(ChMatrix<>& x, const ChMatrix<>& b) const {
+    std::vector<double> y(m_n);
+    for (int k = 0; k < m_n; k++)
+        y[k] = b(m_perm[k]);
+
+    // L*z = y
+    for (int j = 0; j < m_n; j++) {
+        for (int t = m_Lp[j]; t < m_Lp[j + 1]; t++)
+            y[m_Li[t]] -= m_Lx[t] * y[j];
+    }
+
+    // D*z = z
+    for (int j = 0; j < m_n; j++)
+        y[j] /= m_D[j];
+
+    // L'*z = z
+    for (int j = m_n - 1; j >= 0; j--) {
+        for (int t = m_Lp[j]; t < m_Lp[j + 1]; t++)
+            y[j] -= m_Lx[t] * y[m_Li[t]];
+    }
+
+    if (x.GetRows() != m_n || x.GetColumns() != 1)
+        x.Resize(m_n, 1);
+    for (int k = 0; k < m_n; k++)
+        x(m_perm[k]) = y[k];
+}
+
+}  // end namespace chrono
@@ -0,0 +1,157 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSPARSELDLT_H
+#define CHSPARSELDLT_H
+
+#include <vector>
+
+#include "chrono/core/ChCSR3Matrix.h"
+#include "chrono/core/ChMatrixDynamic.h"
+
+namespace chrono {
+
+/// @addtogroup chrono
+/// @{
+
+/// Sparse direct solver for symmetric (possibly indefinite) matrices, with the factorization
+/// P*A*P' = L*D*L', where P is a fill-reducing permutation, L is unit lower triangular and D is diagonal.
+///
+/// The matrix is a row-major ChCSR3Matrix storing both triangles (as assembled by
+/// ChSystemDescriptor::ConvertToMatrixForm()). The factorization has three phases:
+/// - analysis: fill-reducing ordering and symbolic factorization (elimination tree, pattern of L).
+///   It is done only when the sparsity pattern of the matrix is not contained in the analyzed one,
+///   so that it is reused across steps if the pattern does not change.
+/// - numeric factorization: left-looking, by columns. Columns in disjoint subtrees of the elimination
+///   tree are independent and are factorized in parallel, level by level.
+/// - solution: forward and backward substitutions.
+///
+/// No pivoting is done. Saddle-point matrices (ex. the KKT matrix [H Cq'; Cq E] of a system with
+/// constraints) are factorized as quasi-definite matrices: the first rows are expected to give
+/// positive pivots, the last ones negative pivots (see SetNumPositivePivots()), and pivots that are
+/// too small are replaced with a small value of the expected sign, as in the static pivot perturbation
+/// of Pardiso. The solution then needs iterative refinement (see ChSolverSparseLDLT).
+class ChApi ChSparseLDLT {
+  public:
+    /// Fill-reducing orderings.
+    enum class Ordering {
+        NATURAL,         ///< no permutation
+        MINIMUM_DEGREE,  ///< minimum degree on the elimination graph (constraints after their variables)
+    };
+
+    ChSparseLDLT();
+
+    /// Set the fill-reducing ordering (default: MINIMUM_DEGREE).
+    void SetOrdering(Ordering ordering) {
+        m_ordering = ordering;
+        m_analyzed = false;
+    }
+    Ordering GetOrdering() const { return m_ordering; }
+
+    /// Set the number of threads used by the numeric factorization (default: number of processors).
+    void SetNumThreads(int nthreads) { m_nthreads = nthreads; }
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Set the number of leading rows expected to give positive pivots; the remaining rows are
+    /// expected to give negative pivots (default: all rows positive).
+    void SetNumPositivePivots(int npos) { m_npos = npos; }
+
+    /// Set the relative perturbation for small pivots (default: 1e-8). Pivots smaller than
+    /// perturbation*max|A_ij| are replaced by +/-perturbation*max|A_ij|, with the expected sign.
+    void SetPivotPerturbation(double perturbation) { m_perturbation = perturbation; }
+    double GetPivotPerturbation() const { return m_perturbation; }
+
+    /// Perform the ordering and the symbolic factorization of the given matrix.
+    void Analyze(ChCSR3Matrix& A);
+
+    /// Perform the numeric factorization of the given matrix. The analysis is repeated only if
+    /// the sparsity pattern of the matrix has entries not in the analyzed pattern.
+    /// Returns false if a zero pivot was found (only possible if the perturbation is zero).
+    bool Factorize(ChCSR3Matrix& A);
+
+    /// Solve A*x = b using the last factorization. x and b can be the same matrix.
+    void Solve(ChMatrix<>& x, const ChMatrix<>& b) const;
+
+    /// Problem size of the last factorization.
+    int GetSize() const { return m_n; }
+
+    /// Number of non-zeros in L (excluding the unit diagonal).
+    int GetNNZ_L() const { return (int)m_Li.size(); }
+
+    /// Number of pivots perturbed during the last factorization.
+    int GetNumPerturbedPivots() const { return m_num_perturbed; }
+
+    /// Number of analyses performed (ordering and symbolic factorization).
+    int GetNumAnalyses() const { return m_num_analyses; }
+
+    /// Access the permutation (the k-th row of P*A*P' is the row perm[k] of A).
+    const std::vector<int>& GetPermutation() const { return m_perm; }
+
+  private:
+    void AnalyzePattern();
+    void MapValues(ChCSR3Matrix& A);
+    void OrderMinimumDegree(const int* Ap, const int* Ai);
+    bool SamePattern(const ChCSR3Matrix& A) const;
+    bool ContainedPattern(const ChCSR3Matrix& A) const;
+    void MergePattern(const ChCSR3Matrix& A);
+    int FactorizeColumn(int j, const double* Ax, double threshold, std::vector<double>& w);
+
+    Ordering m_ordering;
+    int m_nthreads;
+    int m_npos;
+    double m_perturbation;
+
+    bool m_analyzed;
+    int m_analyzed_npos;
+    int m_n;
+    int m_num_perturbed;
+    int m_num_analyses;
+
+    // Analyzed sparsity pattern (union of the patterns factorized since the last Analyze)
+    std::vector<int> m_Sp;
+    std::vector<int> m_Si;
+
+    // Sparsity pattern of the last factorized matrix
+    std::vector<int> m_Ap;
+    std::vector<int> m_Ai;
+
+    // Ordering
+    std::vector<int> m_perm;  ///< new to old index
+    std::vector<int> m_pinv;  ///< old to new index
+
+    // Lower triangle of P*A*P', by columns, as positions in the values of A
+    std::vector<int> m_Cp;
+    std::vector<int> m_Ci;    ///< row index
+    std::vector<int> m_Csrc;  ///< position in the values of A
+
+    // Symbolic factorization
+    std::vector<int> m_parent;  ///< elimination tree
+    std::vector<int> m_Lp;      ///< columns of L
+    std::vector<int> m_Li;      ///< row indices of L, sorted in each column
+    std::vector<int> m_Rp;      ///< rows of L
+    std::vector<int> m_Ri;      ///< column indices of L, by rows
+    std::vector<int> m_Rpos;    ///< position of the entries of the rows in the columns of L
+    std::vector<int> m_level_ptr;   ///< columns of each level of the elimination tree
+    std::vector<int> m_level_cols;  ///< columns sorted by level
+
+    // Numeric factorization
+    std::vector<double> m_Lx;  ///< values of L
+    std::vector<double> m_D;   ///< diagonal
+};
+
+/// @} chrono
+
+}  // end namespace chrono
+
+#endif
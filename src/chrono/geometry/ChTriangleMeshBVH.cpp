@@ -0,0 +1,367 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "chrono/geometry/ChTriangleMeshBVH.h"
+
+namespace chrono {
+namespace geometry {
+
+// Component-wise minimum and maximum of two vectors.
+static ChVector<> _Vmin(const ChVector<>& a, const ChVector<>& b) {
+    return ChVector<>(std::min(a.x(), b.x()), std::min(a.y(), b.y()), std::min(a.z(), b.z()));
+}
+static ChVector<> _Vmax(const ChVector<>& a, const ChVector<>& b) {
+    return ChVector<>(std::max(a.x(), b.x()), std::max(a.y(), b.y()), std::max(a.z(), b.z()));
+}
+
+// Squared distance from a point to a node box (zero if the point is inside).
+static double _PointBoxDistance2(const ChTriangleMeshBVH::Node& node, const ChVector<>& p) {
+    double d2 = 0;
+    for (int k = 0; k < 3; k++) {
+        double d = std::max(std::max(node.aabb_min[k] - p[k], p[k] - node.aabb_max[k]), 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+// Parameter at which a ray enters a node box (slab test), or +infinity if it misses the box before tmax.
+static double _RayBoxEntry(const ChTriangleMeshBVH::Node& node,
+                           const ChVector<>& from,
+                           const ChVector<>& inv_dir,
+                           double tmax) {
+    double tmin = 0;
+    for (int k = 0; k < 3; k++) {
+        double t1 = (node.aabb_min[k] - from[k]) * inv_dir[k];
+        double t2 = (node.aabb_max[k] - from[k]) * inv_dir[k];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+    }
+    return (tmin <= tmax) ? tmin : std::numeric_limits<double>::infinity();
+}
+
+// Intersection of the segment from + t*dir, t in [0,1], with a triangle (Moller-Trumbore).
+static bool _RayTriangle(const ChVector<>& from,
+                         const ChVector<>& dir,
+                         const ChVector<>& v0,
+                         const ChVector<>& v1,
+                         const ChVector<>& v2,
+                         double& t) {
+    ChVector<> e1 = v1 - v0;
+    ChVector<> e2 = v2 - v0;
+    ChVector<> p = Vcross(dir, e2);
+    double det = Vdot(e1, p);
+    if (std::abs(det) < 1e-30)
+        return false;
+    double inv_det = 1 / det;
+    ChVector<> s = from - v0;
+    double u = Vdot(s, p) * inv_det;
+    if (u < 0 || u > 1)
+        return false;
+    ChVector<> q = Vcross(s, e1);
+    double v = Vdot(dir, q) * inv_det;
+    if (v < 0 || u + v > 1)
+        return false;
+    t = Vdot(e2, q) * inv_det;
+    return t >= 0 && t <= 1;
+}
+
+// Point of a triangle closest to p (Ericson, Real-Time Collision Detection, 5.1.5).
+static ChVector<> _ClosestPointTriangle(const ChVector<>& p,
+                                        const ChVector<>& a,
+                                        const ChVector<>& b,
+                                        const ChVector<>& c) {
+    ChVector<> ab = b - a;
+    ChVector<> ac = c - a;
+    ChVector<> ap = p - a;
+    double d1 = Vdot(ab, ap);
+    double d2 = Vdot(ac, ap);
+    if (d1 <= 0 && d2 <= 0)
+        return a;
+
+    ChVector<> bp = p - b;
+    double d3 = Vdot(ab, bp);
+    double d4 = Vdot(ac, bp);
+    if (d3 >= 0 && d4 <= d3)
+        return b;
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0)
+        return a + ab * (d1 / (d1 - d3));
+
+    ChVector<> cp = p - c;
+    double d5 = Vdot(ab, cp);
+    double d6 = Vdot(ac, cp);
+    if (d6 >= 0 && d5 <= d6)
+        return c;
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0)
+        return a + ac * (d2 / (d2 - d6));
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    double denom = 1 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChTriangleMeshBVH::Build(const std::vector<ChVector<>>& vertices,
+                              const std::vector<ChVector<int>>& faces,
+                              int leaf_size) {
+    Clear();
+    m_leaf_size = std::max(leaf_size, 1);
+    m_num_triangles = (int)faces.size();
+    if (m_num_triangles == 0)
+        return;
+
+    std::vector<ChVector<>> centers(m_num_triangles);
+    m_tris.resize(m_num_triangles);
+    for (int i = 0; i < m_num_triangles; i++) {
+        centers[i] = (vertices[faces[i].x()] + vertices[faces[i].y()] + vertices[faces[i].z()]) / 3;
+        m_tris[i] = i;
+    }
+
+    m_nodes.reserve(2 * m_num_triangles);
+    BuildNode(0, m_num_triangles, m_leaf_size, centers);
+
+    Refit(vertices, faces);
+}
+
+int ChTriangleMeshBVH::BuildNode(int begin, int end, int leaf_size, const std::vector<ChVector<>>& centers) {
+    int index = (int)m_nodes.size();
+    m_nodes.push_back(Node());
+
+    if (end - begin <= leaf_size) {
+        m_nodes[index].first = begin;
+        m_nodes[index].count = end - begin;
+        m_leaves.push_back(index);
+        return index;
+    }
+
+    // Split at the median of the triangle centers, along their largest extent
+    ChVector<> cmin = centers[m_tris[begin]];
+    ChVector<> cmax = cmin;
+    for (int i = begin + 1; i < end; i++) {
+        const ChVector<>& c = centers[m_tris[i]];
+        cmin = _Vmin(cmin, c);
+        cmax = _Vmax(cmax, c);
+    }
+    ChVector<> extent = cmax - cmin;
+    int axis = (extent.x() >= extent.y() && extent.x() >= extent.z()) ? 0 : (extent.y() >= extent.z() ? 1 : 2);
+    int mid = (begin + end) / 2;
+    std::nth_element(m_tris.begin() + begin, m_tris.begin() + mid, m_tris.begin() + end,
+                     [&centers, axis](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+
+    BuildNode(begin, mid, leaf_size, centers);
+    int right = BuildNode(mid, end, leaf_size, centers);
+    m_nodes[index].first = right;
+    m_nodes[index].count = 0;
+    return index;
+}
+
+void ChTriangleMeshBVH::Refit(const std::vector<ChVector<>>& vertices, const std::vector<ChVector<int>>& faces) {
+    assert((int)faces.size() == m_num_triangles);
+
+    // Leaves, from their triangles
+#pragma omp parallel for
+    for (int i = 0; i < (int)m_leaves.size(); i++) {
+        Node& node = m_nodes[m_leaves[i]];
+        ChVector<> vmin(std::numeric_limits<double>::max());
+        ChVector<> vmax(-std::numeric_limits<double>::max());
+        for (int j = node.first; j < node.first + node.count; j++) {
+            const ChVector<int>& face = faces[m_tris[j]];
+            for (int k = 0; k < 3; k++) {
+                vmin = _Vmin(vmin, vertices[face[k]]);
+                vmax = _Vmax(vmax, vertices[face[k]]);
+            }
+        }
+        for (int k = 0; k < 3; k++) {
+            node.aabb_min[k] = vmin[k];
+            node.aabb_max[k] = vmax[k];
+        }
+    }
+
+    // Inner nodes, from their children (which follow them)
+    for (int i = (int)m_nodes.size() - 1; i >= 0; i--) {
+        Node& node = m_nodes[i];
+        if (node.count > 0)
+            continue;
+        const Node& left = m_nodes[i + 1];
+        const Node& right = m_nodes[node.first];
+        for (int k = 0; k < 3; k++) {
+            node.aabb_min[k] = std::min(left.aabb_min[k], right.aabb_min[k]);
+            node.aabb_max[k] = std::max(left.aabb_max[k], right.aabb_max[k]);
+        }
+    }
+}
+
+void ChTriangleMeshBVH::Clear() {
+    m_nodes.clear();
+    m_leaves.clear();
+    m_tris.clear();
+    m_num_triangles = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChTriangleMeshBVH::RayHit(const std::vector<ChVector<>>& vertices,
+                               const std::vector<ChVector<int>>& faces,
+                               const ChVector<>& from,
+                               const ChVector<>& to,
+                               int& triangle,
+                               ChVector<>& point,
+                               double& t) const {
+    if (m_nodes.empty() || (int)faces.size() != m_num_triangles)
+        return false;
+
+    ChVector<> dir = to - from;
+    ChVector<> inv_dir(1 / dir.x(), 1 / dir.y(), 1 / dir.z());
+    double t_hit = 1;
+    triangle = -1;
+
+    // Visit the nodes hit by the ray, the closest child first
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        int index = stack.back();
+        const Node& node = m_nodes[index];
+        stack.pop_back();
+        if (_RayBoxEntry(node, from, inv_dir, t_hit) > t_hit)
+            continue;
+        if (node.count > 0) {
+            for (int j = node.first; j < node.first + node.count; j++) {
+                const ChVector<int>& face = faces[m_tris[j]];
+                double tj;
+                if (_RayTriangle(from, dir, vertices[face.x()], vertices[face.y()], vertices[face.z()], tj) &&
+                    tj < t_hit) {
+                    t_hit = tj;
+                    triangle = m_tris[j];
+                }
+            }
+            continue;
+        }
+        int left = index + 1;
+        int right = node.first;
+        double t_left = _RayBoxEntry(m_nodes[left], from, inv_dir, t_hit);
+        double t_right = _RayBoxEntry(m_nodes[right], from, inv_dir, t_hit);
+        if (t_left <= t_right) {
+            stack.push_back(right);
+            stack.push_back(left);
+        } else {
+            stack.push_back(left);
+            stack.push_back(right);
+        }
+    }
+
+    if (triangle < 0)
+        return false;
+    t = t_hit;
+    point = from + dir * t_hit;
+    return true;
+}
+
+bool ChTriangleMeshBVH::ClosestPoint(const std::vector<ChVector<>>& vertices,
+                                     const std::vector<ChVector<int>>& faces,
+                                     const ChVector<>& p,
+                                     double max_dist,
+                                     int& triangle,
+                                     ChVector<>& point,
+                                     double& dist) const {
+    if (m_nodes.empty() || (int)faces.size() != m_num_triangles)
+        return false;
+
+    double best_dist2 = max_dist * max_dist;
+    triangle = -1;
+
+    // Visit the nodes closer than the closest point found so far, the closest child first
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        int index = stack.back();
+        const Node& node = m_nodes[index];
+        stack.pop_back();
+        if (_PointBoxDistance2(node, p) >= best_dist2)
+            continue;
+        if (node.count > 0) {
+            for (int j = node.first; j < node.first + node.count; j++) {
+                const ChVector<int>& face = faces[m_tris[j]];
+                ChVector<> q = _ClosestPointTriangle(p, vertices[face.x()], vertices[face.y()], vertices[face.z()]);
+                double d2 = (q - p).Length2();
+                if (d2 < best_dist2) {
+                    best_dist2 = d2;
+                    triangle = m_tris[j];
+                    point = q;
+                }
+            }
+            continue;
+        }
+        int left = index + 1;
+        int right = node.first;
+        if (_PointBoxDistance2(m_nodes[left], p) <= _PointBoxDistance2(m_nodes[right], p)) {
+            stack.push_back(right);
+            stack.push_back(left);
+        } else {
+            stack.push_back(left);
+            stack.push_back(right);
+        }
+    }
+
+    if (triangle < 0)
+        return false;
+    dist = std::sqrt(best_dist2);
+    return true;
+}
+
+void ChTriangleMeshBVH::FindOverlaps(const std::vector<ChVector<>>& vertices,
+                                     const std::vector<ChVector<int>>& faces,
+                                     const ChVector<>& aabb_min,
+                                     const ChVector<>& aabb_max,
+                                     std::vector<int>& triangles) const {
+    if (m_nodes.empty() || (int)faces.size() != m_num_triangles)
+        return;
+
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        int index = stack.back();
+        const Node& node = m_nodes[index];
+        stack.pop_back();
+        bool overlap = true;
+        for (int k = 0; k < 3; k++)
+            overlap &= node.aabb_min[k] <= aabb_max[k] && node.aabb_max[k] >= aabb_min[k];
+        if (!overlap)
+            continue;
+        if (node.count == 0) {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+            continue;
+        }
+        for (int j = node.first; j < node.first + node.count; j++) {
+            const ChVector<int>& face = faces[m_tris[j]];
+            ChVector<> vmin = _Vmin(_Vmin(vertices[face.x()], vertices[face.y()]), vertices[face.z()]);
+            ChVector<> vmax = _Vmax(_Vmax(vertices[face.x()], vertices[face.y()]), vertices[face.z()]);
+            if (vmin.x() <= aabb_max.x() && vmax.x() >= aabb_min.x() && vmin.y() <= aabb_max.y() &&
+                vmax.y() >= aabb_min.y() && vmin.z() <= aabb_max.z() && vmax.z() >= aabb_min.z())
+                triangles.push_back(m_tris[j]);
+        }
+    }
+}
+
+}  // end namespace geometry
+}  // end namespace chrono
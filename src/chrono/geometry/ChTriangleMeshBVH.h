@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHC_TRIANGLEMESHBVH_H
+#define CHC_TRIANGLEMESHBVH_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+namespace geometry {
+
+/// Bounding volume hierarchy (tree of axis-aligned bounding boxes) of the triangles of a mesh
+/// given as vertices and vertex indices, as in ChTriangleMeshConnected.
+///
+/// The tree is built top-down, splitting the triangles at the median of their centers along the
+/// largest extent, down to leaves of a few triangles. Nodes are stored in a flat array in depth-first
+/// order (the left child of a node is the next node), with their boxes as contiguous coordinates.
+/// When the vertices move, Refit() recomputes the boxes bottom-up in a single sweep, keeping the
+/// tree topology: this is much cheaper than a rebuild, but the boxes get looser as the mesh deforms,
+/// so the tree should be rebuilt after large deformations.
+class ChApi ChTriangleMeshBVH {
+  public:
+    /// Node of the tree.
+    struct Node {
+        double aabb_min[3];  ///< lower corner of the bounding box
+        double aabb_max[3];  ///< upper corner of the bounding box
+        int first;           ///< leaf: first entry in the triangle list; inner node: index of the right child
+        int count;           ///< leaf: number of triangles; inner node: 0
+    };
+
+    ChTriangleMeshBVH() : m_num_triangles(0), m_leaf_size(4) {}
+
+    /// Build the tree of the given triangles, with at most leaf_size triangles per leaf.
+    void Build(const std::vector<ChVector<>>& vertices, const std::vector<ChVector<int>>& faces, int leaf_size = 4);
+
+    /// Recompute the bounding boxes for new positions of the vertices, keeping the tree topology.
+    /// The triangles must be the same as when the tree was built.
+    void Refit(const std::vector<ChVector<>>& vertices, const std::vector<ChVector<int>>& faces);
+
+    /// Delete the tree (the leaf size is kept for the next build).
+    void Clear();
+
+    /// Return true if the tree was built.
+    bool IsBuilt() const { return !m_nodes.empty(); }
+
+    /// Number of triangles when the tree was built.
+    int GetNumTriangles() const { return m_num_triangles; }
+
+    /// Maximum number of triangles per leaf in the last build.
+    int GetLeafSize() const { return m_leaf_size; }
+
+    /// Access the nodes of the tree (the first one is the root).
+    const std::vector<Node>& GetNodes() const { return m_nodes; }
+
+    /// The queries below find nothing if the tree is not built or if the number of triangles changed since.
+
+    /// Find the first triangle hit by the segment from-to.
+    /// Return false if no triangle is hit; otherwise return the index of the triangle, the hit point
+    /// and its parameter along the segment (0 at from, 1 at to).
+    bool RayHit(const std::vector<ChVector<>>& vertices,
+                const std::vector<ChVector<int>>& faces,
+                const ChVector<>& from,
+                const ChVector<>& to,
+                int& triangle,
+                ChVector<>& point,
+                double& t) const;
+
+    /// Find the point of the mesh closest to p, among those closer than max_dist.
+    /// Return false if there is none; otherwise return the index of the triangle, the point and its distance.
+    bool ClosestPoint(const std::vector<ChVector<>>& vertices,
+                      const std::vector<ChVector<int>>& faces,
+                      const ChVector<>& p,
+                      double max_dist,
+                      int& triangle,
+                      ChVector<>& point,
+                      double& dist) const;
+
+    /// Find the triangles whose bounding boxes overlap the given box (appended to the list).
+    void FindOverlaps(const std::vector<ChVector<>>& vertices,
+                      const std::vector<ChVector<int>>& faces,
+                      const ChVector<>& aabb_min,
+                      const ChVector<>& aabb_max,
+                      std::vector<int>& triangles) const;
+
+  private:
+    int BuildNode(int begin, int end, int leaf_size, const std::vector<ChVector<>>& centers);
+
+    std::vector<Node> m_nodes;  ///< nodes, in depth-first order
+    std::vector<int> m_leaves;  ///< indices of the leaf nodes
+    std::vector<int> m_tris;    ///< triangles, in the order of the leaves
+    int m_num_triangles;
+    int m_leaf_size;
+};
+
+}  // end namespace geometry
+}  // end namespace chrono
+
+#endif
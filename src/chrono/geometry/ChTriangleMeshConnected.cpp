@@ -757,6 +757,8 @@ ChTriangleMeshConnected::ChTriangleMeshConnected(const ChTriangleMeshConnected&
     m_face_n_indices = source.m_face_n_indices;
     m_face_uv_indices = source.m_face_uv_indices;
     m_face_col_indices = source.m_face_col_indices;
+
+    m_bvh = source.m_bvh;
 }
 
 // Following function is a modified version of:
@@ -890,6 +892,7 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
 using namespace WAVEFRONT;
 
 void ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_normals, bool load_uv) {
+    InvalidateBVH();
     this->m_vertices.clear();
     this->m_normals.clear();
     this->m_UV.clear();
@@ -1038,6 +1041,23 @@ void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33
         m_normals[i] = rotscale * m_normals[i];
         m_normals[i].Normalize();
     }
+    if (m_bvh.IsBuilt() && m_bvh.GetNumTriangles() == getNumTriangles())
+        m_bvh.Refit(m_vertices, m_face_v_indices);
+    else
+        InvalidateBVH();
+}
+
+void ChTriangleMeshConnected::RefitBVH() {
+    if (m_bvh.IsBuilt() && m_bvh.GetNumTriangles() == getNumTriangles())
+        m_bvh.Refit(m_vertices, m_face_v_indices);
+    else
+        m_bvh.Build(m_vertices, m_face_v_indices, m_bvh.GetLeafSize());
+}
+
+const ChTriangleMeshBVH& ChTriangleMeshConnected::UpdatedBVH() const {
+    if (!m_bvh.IsBuilt() || m_bvh.GetNumTriangles() != getNumTriangles())
+        m_bvh.Build(m_vertices, m_face_v_indices, m_bvh.GetLeafSize());
+    return m_bvh;
 }
 
 bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
@@ -1168,6 +1188,7 @@ bool ChTriangleMeshConnected::ComputeWingedEdges(std::map<std::pair<int, int>, s
 }
 
 int ChTriangleMeshConnected::RepairDuplicateVertexes(const double tolerance) {
+    InvalidateBVH();
     int nmerged = 0;
     std::vector<ChVector<>> processed_verts;
     std::vector<int> new_indexes(m_vertices.size());
@@ -1221,6 +1242,7 @@ int ChTriangleMeshConnected::RepairDuplicateVertexes(const double tolerance) {
 //   Xiuzhi Qu and Brent Stucker
 
 bool ChTriangleMeshConnected::MakeOffset(const double moffset) {
+    InvalidateBVH();
     std::map<int, std::vector<int>> map_vertex_triangles;
     std::vector<ChVector<>> voffsets(this->m_vertices.size());
 
@@ -1348,6 +1370,7 @@ bool ChTriangleMeshConnected::SplitEdge (
         std::vector<std::vector<bool>*>& aux_data_bool,      ///< auxiliary buffers to interpolate (assuming indexed as vertexes: each with same size as vertex buffer)
         std::vector<std::vector<ChVector<>>*>& aux_data_vect///< auxiliary buffers to interpolate (assuming indexed as vertexes: each with same size as vertex buffer)
         ) {
+    InvalidateBVH();
     
     std::array<std::vector<ChVector<int>>*, 4> face_indexes;
     face_indexes[0]=&m_face_v_indices;
@@ -1515,6 +1538,7 @@ void ChTriangleMeshConnected::RefineMeshEdges(
         std::vector<std::vector<bool>*>& aux_data_bool,      ///< auxiliary buffers to refine (assuming indexed as vertexes: each with same size as vertex buffer)
         std::vector<std::vector<ChVector<>>*>& aux_data_vect///< auxiliary buffers to refine (assuming indexed as vertexes: each with same size as vertex buffer)
         ) {
+    InvalidateBVH();
 
     // initialize the list of triangles to refine, copying from marked triangles:
     std::list<int> S(marked_tris.begin(), marked_tris.end());
@@ -20,6 +20,7 @@
 #include <map>
 
 #include "chrono/geometry/ChTriangleMesh.h"
+#include "chrono/geometry/ChTriangleMeshBVH.h"
 
 namespace chrono {
 namespace geometry {
@@ -45,6 +46,8 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
 
     std::string m_filename;  ///< file string if loading an obj file
 
+    mutable ChTriangleMeshBVH m_bvh;  ///< bounding volume hierarchy of the triangles (built on first use)
+
   public:
     ChTriangleMeshConnected() {}
     ChTriangleMeshConnected(const ChTriangleMeshConnected& source);
@@ -74,6 +77,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
         m_vertices.push_back(vertex1);
         m_vertices.push_back(vertex2);
         m_face_v_indices.push_back(ChVector<int>(base_v, base_v + 1, base_v + 2));
+        InvalidateBVH();
     }
 
     /// Add a triangle to this triangle mesh, by specifying a ChTriangle
@@ -83,6 +87,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
         m_vertices.push_back(atriangle.p2);
         m_vertices.push_back(atriangle.p3);
         m_face_v_indices.push_back(ChVector<int>(base_v, base_v + 1, base_v + 2));
+        InvalidateBVH();
     }
 
     /// Get the number of triangles already added to this mesh
@@ -94,6 +99,41 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
                           m_vertices[m_face_v_indices[index].z()]);
     }
 
+    /// Build the bounding volume hierarchy of the triangles, used by RayHit(), ClosestPoint()
+    /// and FindOverlappingTriangles(). Leaves hold at most leaf_size triangles.
+    /// The hierarchy is otherwise built on the first query (not thread safe: build it before
+    /// concurrent queries) and rebuilt after the mesh functions that change the triangles.
+    void BuildBVH(int leaf_size = 4) { m_bvh.Build(m_vertices, m_face_v_indices, leaf_size); }
+
+    /// Update the bounding volume hierarchy after the vertices moved (ex. a deformable mesh).
+    /// Only the bounding boxes are recomputed; the hierarchy is rebuilt if the number of triangles changed.
+    void RefitBVH();
+
+    /// Discard the bounding volume hierarchy, so that it is rebuilt on the next query.
+    /// Call it after editing the vertex indices directly.
+    void InvalidateBVH() { m_bvh.Clear(); }
+
+    /// Access the bounding volume hierarchy of the triangles, built if needed.
+    const ChTriangleMeshBVH& GetBVH() const { return UpdatedBVH(); }
+
+    /// Find the first triangle hit by the segment from-to (see ChTriangleMeshBVH::RayHit).
+    bool RayHit(const ChVector<>& from, const ChVector<>& to, int& triangle, ChVector<>& point, double& t) const {
+        return UpdatedBVH().RayHit(m_vertices, m_face_v_indices, from, to, triangle, point, t);
+    }
+
+    /// Find the point of the mesh closest to p, among those closer than max_dist
+    /// (see ChTriangleMeshBVH::ClosestPoint).
+    bool ClosestPoint(const ChVector<>& p, double max_dist, int& triangle, ChVector<>& point, double& dist) const {
+        return UpdatedBVH().ClosestPoint(m_vertices, m_face_v_indices, p, max_dist, triangle, point, dist);
+    }
+
+    /// Find the triangles whose bounding boxes overlap the given box (appended to the list).
+    void FindOverlappingTriangles(const ChVector<>& aabb_min,
+                                  const ChVector<>& aabb_max,
+                                  std::vector<int>& triangles) const {
+        UpdatedBVH().FindOverlaps(m_vertices, m_face_v_indices, aabb_min, aabb_max, triangles);
+    }
+
     /// Clear all data
     virtual void Clear() override {
         this->getCoordsVertices().clear();
@@ -104,6 +144,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
         this->getIndicesNormals().clear();
         this->getIndicesUV().clear();
         this->getIndicesColors().clear();
+        InvalidateBVH();
     }
 
     /// Compute barycenter, mass, inertia tensor
@@ -112,7 +153,8 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Get the filename of the triangle mesh
     std::string GetFileName() { return m_filename; }
 
-    /// Transform all vertexes, by displacing and rotating (rotation  via matrix, so also scaling if needed)
+    /// Transform all vertexes, by displacing and rotating (rotation  via matrix, so also scaling if needed).
+    /// The bounding volume hierarchy, if up to date, is refit.
     virtual void Transform(const ChVector<> displ, const ChMatrix33<> rotscale) override;
 
     /// Create a map of neighbouring triangles, vector of:
@@ -241,7 +283,12 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
         marchive >> CHNVP(m_face_uv_indices);
         marchive >> CHNVP(m_face_col_indices);
         marchive >> CHNVP(m_filename);
+        InvalidateBVH();
     }
+
+  private:
+    /// Return the bounding volume hierarchy, rebuilt if the number of triangles changed.
+    const ChTriangleMeshBVH& UpdatedBVH() const;
 };
 
 }  // end namespace geometry
@@ -14,6 +14,7 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <unordered_map>
 
 #include "chrono/core/ChLinearAlgebra.h"
 #include "chrono/core/ChTransform.h"
@@ -21,6 +22,7 @@
 #include "chrono/physics/ChBodyAuxRef.h"
 #include "chrono/physics/ChGlobal.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChZoneProfiler.h"
 
 namespace chrono {
 
@@ -44,7 +46,9 @@ ChAssembly::ChAssembly()
       nsysvars(0),
       nsysvars_w(0),
       nbodies_sleep(0),
-      nbodies_fixed(0) {}
+      nbodies_fixed(0),
+      use_parallel_items(false),
+      use_body_store(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -61,6 +65,8 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nsysvars_w = other.nsysvars_w;
     nbodies_sleep = other.nbodies_sleep;
     nbodies_fixed = other.nbodies_fixed;
+    use_parallel_items = other.use_parallel_items;
+    use_body_store = other.use_body_store;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, linklist, otherphysicslist)
@@ -608,6 +614,21 @@ void ChAssembly::Setup() {
         }
     }
 
+    // Links are colored for parallel processing at each Setup(), since connectivity and
+    // active state of bodies may have changed.
+    if (use_parallel_items)
+        ColorLinks();
+    else {
+        link_color_list.clear();
+        link_color_ptr.clear();
+    }
+
+    // The body state store indexes the active bodies with their current offsets.
+    if (use_body_store)
+        body_store.Bind(bodylist);
+    else
+        body_store.Clear();
+
     ndoc = ndoc_w + nbodies;          // number of constraints including quaternion constraints.
     nsysvars = ncoords + ndoc;        // total number of variables (coordinates + lagrangian multipliers)
     nsysvars_w = ncoords_w + ndoc_w;  // total number of variables (with 6 dof per body)
@@ -616,6 +637,94 @@ void ChAssembly::Setup() {
         ncoords_w - ndoc_w;  // number of degrees of freedom (approximate - does not consider constr. redundancy, etc)
 }
 
+// -----------------------------------------------------------------------------
+// Parallel processing of bodies and links
+
+int ChAssembly::GetParallelItemsThreads() {
+    if (!use_parallel_items || !system)
+        return 0;
+    // Links must have been colored by Setup()
+    if (link_color_ptr.empty() || link_color_list.size() != linklist.size())
+        return 0;
+    return system->GetParallelItemsThreadNumber();
+}
+
+// Greedy coloring of the links: each link gets the smallest color not used yet by
+// another link acting on one of its two bodies. Fixed or sleeping bodies, whose
+// variables are not active, are not written by links and do not cause conflicts.
+void ChAssembly::ColorLinks() {
+    std::unordered_map<ChBodyFrame*, std::vector<int>> body_colors;
+    std::vector<int> link_color(linklist.size());
+    std::vector<int> color_count;
+    std::vector<int> color_stamp;
+
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        ChBodyFrame* mbodies[2] = {linklist[ip]->GetBody1(), linklist[ip]->GetBody2()};
+        std::vector<int>* used[2] = {nullptr, nullptr};
+        for (int i = 0; i < 2; ++i) {
+            if (mbodies[i] && mbodies[i]->Variables().IsActive())
+                used[i] = &body_colors[mbodies[i]];
+        }
+
+        // Mark colors already used by the bodies of this link, then take the first free one
+        for (int i = 0; i < 2; ++i) {
+            if (used[i]) {
+                for (auto c : *used[i])
+                    color_stamp[c] = ip + 1;
+            }
+        }
+        int color = 0;
+        while (color < (int)color_count.size() && color_stamp[color] == ip + 1)
+            ++color;
+        if (color == (int)color_count.size()) {
+            color_count.push_back(0);
+            color_stamp.push_back(0);
+        }
+
+        link_color[ip] = color;
+        color_count[color]++;
+        for (int i = 0; i < 2; ++i) {
+            if (used[i] && (i == 0 || used[1] != used[0]))
+                used[i]->push_back(color);
+        }
+    }
+
+    // Sort link indices by color (counting sort, increasing link index within a color)
+    link_color_ptr.assign(color_count.size() + 1, 0);
+    for (size_t c = 0; c < color_count.size(); ++c)
+        link_color_ptr[c + 1] = link_color_ptr[c] + color_count[c];
+    link_color_list.resize(linklist.size());
+    std::vector<int> fill(link_color_ptr.begin(), link_color_ptr.end() - 1);
+    for (int ip = 0; ip < (int)linklist.size(); ++ip)
+        link_color_list[fill[link_color[ip]]++] = ip;
+}
+
+// Apply 'func' to all bodies, in parallel.
+template <class Tfunc>
+void _ParallelBodies(std::vector<std::shared_ptr<ChBody>>& bodylist, int nthreads, Tfunc func) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        func(bodylist[ip]);
+    }
+}
+
+// Apply 'func' to all links, in parallel within each color.
+template <class Tfunc>
+void _ParallelLinks(std::vector<std::shared_ptr<ChLink>>& linklist,
+                    const std::vector<int>& color_list,
+                    const std::vector<int>& color_ptr,
+                    int nthreads,
+                    Tfunc func) {
+    for (int k = 0; k + 1 < (int)color_ptr.size(); ++k) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int j = color_ptr[k]; j < color_ptr[k + 1]; ++j) {
+            func(linklist[color_list[j]]);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // Update assemblies own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -628,12 +737,43 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // - UPDATES ALL FORCES  (AUTOMATIC, AS CHILDREN OF BODIES)
 // - UPDATES ALL MARKERS (AUTOMATIC, AS CHILDREN OF BODIES).
 void ChAssembly::Update(bool update_assets) {
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
+    UpdateBodiesAndItems(update_assets);
+    UpdateLinks(update_assets);
+}
+
+void ChAssembly::UpdateBodiesAndItems(bool update_assets) {
+    if (int nthreads = GetParallelItemsThreads()) {
+        // Assets may be shared among items: these are updated serially, after the items.
+        double mtime = ChTime;
+        _ParallelBodies(bodylist, nthreads, [mtime](std::shared_ptr<ChBody>& b) { b->Update(mtime, false); });
+        if (update_assets) {
+            for (unsigned int ip = 0; ip < bodylist.size(); ++ip)
+                bodylist[ip]->UpdateAssets();
+        }
+    } else {
+        for (int ip = 0; ip < bodylist.size(); ++ip) {
+            bodylist[ip]->Update(ChTime, update_assets);
+        }
     }
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        const ChPhysicsItem& item = *otherphysicslist[ip];
+        CH_PROFILE_ZONE(typeid(item));
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
+}
+
+void ChAssembly::UpdateLinks(bool update_assets) {
+    if (int nthreads = GetParallelItemsThreads()) {
+        double mtime = ChTime;
+        _ParallelLinks(linklist, link_color_list, link_color_ptr, nthreads,
+                       [mtime](std::shared_ptr<ChLink>& l) { l->Update(mtime, false); });
+        if (update_assets) {
+            for (unsigned int ip = 0; ip < linklist.size(); ++ip)
+                linklist[ip]->UpdateAssets();
+        }
+        return;
+    }
+
     for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
         linklist[ip]->Update(ChTime, update_assets);
     }
@@ -660,10 +800,16 @@ void ChAssembly::IntStateGather(const unsigned int off_x,  ///< offset in x stat
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
-        if (Bpointer->IsActive())
-            Bpointer->IntStateGather(displ_x + Bpointer->GetOffset_x(), x, displ_v + Bpointer->GetOffset_w(), v, T);
+    if (use_body_store) {
+        body_store.IntStateGather(displ_x, x, displ_v, v);
+        T = GetChTime();
+    } else {
+        for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
+            std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+            if (Bpointer->IsActive())
+                Bpointer->IntStateGather(displ_x + Bpointer->GetOffset_x(), x, displ_v + Bpointer->GetOffset_w(), v,
+                                         T);
+        }
     }
     for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
         std::shared_ptr<ChLink> Lpointer = linklist[ip];
@@ -797,11 +943,15 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,  ///< offset in x s
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
-        if (Bpointer->IsActive())
-            Bpointer->IntStateIncrement(displ_x + Bpointer->GetOffset_x(), x_new, x, displ_v + Bpointer->GetOffset_w(),
-                                        Dv);
+    if (use_body_store) {
+        body_store.IntStateIncrement(displ_x, x_new, x, displ_v, Dv);
+    } else {
+        for (int ip = 0; ip < bodylist.size(); ++ip) {
+            std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+            if (Bpointer->IsActive())
+                Bpointer->IntStateIncrement(displ_x + Bpointer->GetOffset_x(), x_new, x,
+                                            displ_v + Bpointer->GetOffset_w(), Dv);
+        }
     }
 
     for (int ip = 0; ip < linklist.size(); ++ip) {
@@ -823,6 +973,25 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
+    if (int nthreads = GetParallelItemsThreads()) {
+        // Bodies write in their own part of R; links of the same color do not share bodies.
+        _ParallelBodies(bodylist, nthreads, [&](std::shared_ptr<ChBody>& Bpointer) {
+            if (Bpointer->IsActive())
+                Bpointer->IntLoadResidual_F(displ_v + Bpointer->GetOffset_w(), R, c);
+        });
+        _ParallelLinks(linklist, link_color_list, link_color_ptr, nthreads, [&](std::shared_ptr<ChLink>& Lpointer) {
+            if (Lpointer->IsActive())
+                Lpointer->IntLoadResidual_F(displ_v + Lpointer->GetOffset_w(), R, c);
+        });
+        for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+            std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
+            const ChPhysicsItem& item = *Ppointer;
+            CH_PROFILE_ZONE(typeid(item));
+            Ppointer->IntLoadResidual_F(displ_v + Ppointer->GetOffset_w(), R, c);
+        }
+        return;
+    }
+
     for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
         std::shared_ptr<ChBody> Bpointer = bodylist[ip];
         if (Bpointer->IsActive())
@@ -835,6 +1004,8 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
     }
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
+        const ChPhysicsItem& item = *Ppointer;
+        CH_PROFILE_ZONE(typeid(item));
         Ppointer->IntLoadResidual_F(displ_v + Ppointer->GetOffset_w(), R, c);
     }
 }
@@ -846,10 +1017,34 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
-        if (Bpointer->IsActive())
-            Bpointer->IntLoadResidual_Mv(displ_v + Bpointer->GetOffset_w(), R, w, c);
+    if (int nthreads = GetParallelItemsThreads()) {
+        if (use_body_store) {
+            body_store.IntLoadResidual_Mv(displ_v, R, w, c);
+        } else {
+            _ParallelBodies(bodylist, nthreads, [&](std::shared_ptr<ChBody>& Bpointer) {
+                if (Bpointer->IsActive())
+                    Bpointer->IntLoadResidual_Mv(displ_v + Bpointer->GetOffset_w(), R, w, c);
+            });
+        }
+        _ParallelLinks(linklist, link_color_list, link_color_ptr, nthreads, [&](std::shared_ptr<ChLink>& Lpointer) {
+            if (Lpointer->IsActive())
+                Lpointer->IntLoadResidual_Mv(displ_v + Lpointer->GetOffset_w(), R, w, c);
+        });
+        for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+            std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
+            Ppointer->IntLoadResidual_Mv(displ_v + Ppointer->GetOffset_w(), R, w, c);
+        }
+        return;
+    }
+
+    if (use_body_store) {
+        body_store.IntLoadResidual_Mv(displ_v, R, w, c);
+    } else {
+        for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
+            std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+            if (Bpointer->IsActive())
+                Bpointer->IntLoadResidual_Mv(displ_v + Bpointer->GetOffset_w(), R, w, c);
+        }
     }
     for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
         std::shared_ptr<ChLink> Lpointer = linklist[ip];
@@ -1012,6 +1207,17 @@ void ChAssembly::VariablesFbReset() {
 }
 
 void ChAssembly::VariablesFbLoadForces(double factor) {
+    if (int nthreads = GetParallelItemsThreads()) {
+        _ParallelBodies(bodylist, nthreads,
+                        [factor](std::shared_ptr<ChBody>& b) { b->VariablesFbLoadForces(factor); });
+        _ParallelLinks(linklist, link_color_list, link_color_ptr, nthreads,
+                       [factor](std::shared_ptr<ChLink>& l) { l->VariablesFbLoadForces(factor); });
+        for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+            otherphysicslist[ip]->VariablesFbLoadForces(factor);
+        }
+        return;
+    }
+
     for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
         bodylist[ip]->VariablesFbLoadForces(factor);
     }
@@ -1144,6 +1350,16 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::ConstraintsLoadJacobians() {
+    if (int nthreads = GetParallelItemsThreads()) {
+        _ParallelBodies(bodylist, nthreads, [](std::shared_ptr<ChBody>& b) { b->ConstraintsLoadJacobians(); });
+        _ParallelLinks(linklist, link_color_list, link_color_ptr, nthreads,
+                       [](std::shared_ptr<ChLink>& l) { l->ConstraintsLoadJacobians(); });
+        for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+            otherphysicslist[ip]->ConstraintsLoadJacobians();
+        }
+        return;
+    }
+
     for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
         bodylist[ip]->ConstraintsLoadJacobians();
     }
@@ -16,6 +16,7 @@
 #define CHASSEMBLY_H
 
 #include <cmath>
+#include "chrono/physics/ChBodyStateStore.h"
 #include "chrono/physics/ChLinksAll.h"
 #include "chrono/physics/ChPhysicsItem.h"
 
@@ -217,6 +218,39 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Searches a marker from its unique ID
     std::shared_ptr<ChMarker> SearchMarker(int markID);
 
+    //
+    // PARALLEL PROCESSING
+    //
+
+    /// Enable/disable the parallel (OpenMP) processing of bodies and links in Update(),
+    /// IntLoadResidual_F(), IntLoadResidual_Mv(), ConstraintsLoadJacobians() and
+    /// VariablesFbLoadForces(). Default: false.
+    /// Bodies are processed independently. Links are colored at each Setup() so that links
+    /// of the same color do not share any active body, and colors are processed one after
+    /// the other; results are hence independent of the number of threads, although they
+    /// may differ from the serial mode by round-off. Other physics items are always
+    /// processed serially (they may use internal parallelism, as ChMesh).
+    /// Assets, which may be shared among items, are never updated from the parallel loops: bodies
+    /// and links are updated there without assets, and their assets are then updated serially.
+    /// The number of threads is that of the owner system (see ChSystem::SetParallelThreadNumber).
+    void SetUseParallelItems(bool mval) { use_parallel_items = mval; }
+    /// Tell if bodies and links are processed in parallel.
+    bool GetUseParallelItems() const { return use_parallel_items; }
+
+    /// Gets the number of link colors computed at the last Setup() (0 if not in parallel mode).
+    int GetNlinkColors() const { return link_color_ptr.empty() ? 0 : (int)link_color_ptr.size() - 1; }
+
+    /// Enable/disable the contiguous (structure-of-arrays) store of the states of bodies (default: false).
+    /// If enabled, the state gather and increment and the M*v products required by the integrators
+    /// are done at once for all active bodies, with the offsets and mass properties gathered in a
+    /// ChBodyStateStore at each Setup(). Bodies must not override the state functions of ChBody.
+    void SetUseBodyStateStore(bool mval) { use_body_store = mval; }
+    /// Tell if the body state store is used.
+    bool GetUseBodyStateStore() const { return use_body_store; }
+
+    /// Access the body state store (bound to the active bodies at the last Setup(), if in use).
+    const ChBodyStateStore& GetBodyStateStore() const { return body_store; }
+
     //
     // STATISTICS
     //
@@ -396,6 +430,29 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_D;       ///< number of scalar costraints D, when using 3 rot. dof. per body (only unilaterals)
     int nbodies_sleep;  ///< number of bodies that are sleeping
     int nbodies_fixed;  ///< number of bodies that are fixed
+
+    // Parallel processing:
+    bool use_parallel_items;           ///< process bodies and links in parallel
+    std::vector<int> link_color_list;  ///< link indices, sorted by color
+    std::vector<int> link_color_ptr;   ///< color k spans link_color_list[link_color_ptr[k]...link_color_ptr[k+1]-1]
+
+    /// Color the links so that links of the same color do not act on the same active body.
+    void ColorLinks();
+
+    /// Number of threads for the parallel processing of bodies and links
+    /// (0 if disabled, or if links were not colored yet).
+    int GetParallelItemsThreads();
+
+    /// Update the bodies and the other physics items (first part of Update()).
+    void UpdateBodiesAndItems(bool update_assets);
+
+    /// Update the links (second part of Update()). Links only read the state of the
+    /// items they connect.
+    void UpdateLinks(bool update_assets);
+
+    // Body state store:
+    bool use_body_store;          ///< use the structure-of-arrays store of body states
+    ChBodyStateStore body_store;  ///< bound at each Setup(), if in use
 };
 
 
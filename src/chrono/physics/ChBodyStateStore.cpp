@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono/physics/ChBodyStateStore.h"
+#include "chrono/physics/ChBody.h"
+
+namespace chrono {
+
+void ChBodyStateStore::Bind(const std::vector<std::shared_ptr<ChBody>>& bodylist) {
+    bodies.clear();
+    off_x.clear();
+    off_w.clear();
+    for (auto& body : bodylist) {
+        if (body->IsActive()) {
+            bodies.push_back(body.get());
+            off_x.push_back(body->GetOffset_x());
+            off_w.push_back(body->GetOffset_w());
+        }
+    }
+    nbodies = (int)bodies.size();
+
+    mass.resize(nbodies);
+    inertia.resize(9 * nbodies);
+    for (int i = 0; i < nbodies; i++) {
+        const ChMatrix33<>& J = bodies[i]->GetInertia();
+        mass[i] = bodies[i]->GetMass();
+        for (int k = 0; k < 9; k++)
+            inertia[k * nbodies + i] = J.Get33Element(k / 3, k % 3);
+    }
+}
+
+void ChBodyStateStore::Clear() {
+    bodies.clear();
+    off_x.clear();
+    off_w.clear();
+    mass.clear();
+    inertia.clear();
+    nbodies = 0;
+}
+
+void ChBodyStateStore::IntStateGather(const unsigned int displ_x,
+                                      ChState& x,
+                                      const unsigned int displ_v,
+                                      ChStateDelta& v) const {
+    double* px = x.GetAddress();
+    double* pv = v.GetAddress();
+    for (int i = 0; i < nbodies; i++) {
+        const ChCoordsys<>& coord = bodies[i]->GetCoord();
+        const ChVector<>& vel = bodies[i]->GetPos_dt();
+        ChVector<> wvel = bodies[i]->GetWvel_loc();
+        double* xi = &px[displ_x + off_x[i]];
+        double* vi = &pv[displ_v + off_w[i]];
+        for (int k = 0; k < 3; k++) {
+            xi[k] = coord.pos[k];
+            vi[k] = vel[k];
+            vi[3 + k] = wvel[k];
+        }
+        for (int k = 0; k < 4; k++)
+            xi[3 + k] = coord.rot[k];
+    }
+}
+
+void ChBodyStateStore::IntStateIncrement(const unsigned int displ_x,
+                                         ChState& x_new,
+                                         const ChState& x,
+                                         const unsigned int displ_v,
+                                         const ChStateDelta& Dv) const {
+    const double* px = x.GetAddress();
+    const double* pd = Dv.GetAddress();
+    double* pn = x_new.GetAddress();
+
+    // Positions
+    for (int i = 0; i < nbodies; i++) {
+        int ox = displ_x + off_x[i];
+        int ov = displ_v + off_w[i];
+        pn[ox + 0] = px[ox + 0] + pd[ov + 0];
+        pn[ox + 1] = px[ox + 1] + pd[ov + 1];
+        pn[ox + 2] = px[ox + 2] + pd[ov + 2];
+    }
+
+    // Rotations: rot' = delta*rot, with delta from the absolute rotation increment A*Dw,
+    // A being the current rotation matrix of the body
+    for (int i = 0; i < nbodies; i++) {
+        ChVector<> newwel_abs = bodies[i]->GetA() * Dv.ClipVector(displ_v + off_w[i] + 3, 0);
+        double mangle = newwel_abs.Length();
+        newwel_abs.Normalize();
+        ChQuaternion<> mdeltarot;
+        mdeltarot.Q_from_AngAxis(mangle, newwel_abs);
+        ChQuaternion<> mnewrot = mdeltarot * x.ClipQuaternion(displ_x + off_x[i] + 3, 0);
+        x_new.PasteQuaternion(mnewrot, displ_x + off_x[i] + 3, 0);
+    }
+}
+
+void ChBodyStateStore::IntLoadResidual_Mv(const unsigned int displ_v,
+                                          ChVectorDynamic<>& R,
+                                          const ChVectorDynamic<>& w,
+                                          const double c) const {
+    double* pR = R.GetAddress();
+    const double* pw = w.GetAddress();
+
+    for (int i = 0; i < nbodies; i++) {
+        int o = displ_v + off_w[i];
+        double cm = c * mass[i];
+        pR[o + 0] += cm * pw[o + 0];
+        pR[o + 1] += cm * pw[o + 1];
+        pR[o + 2] += cm * pw[o + 2];
+    }
+    for (int r = 0; r < 3; r++) {
+        const double* J0 = &inertia[(3 * r + 0) * nbodies];
+        const double* J1 = &inertia[(3 * r + 1) * nbodies];
+        const double* J2 = &inertia[(3 * r + 2) * nbodies];
+        for (int i = 0; i < nbodies; i++) {
+            int o = displ_v + off_w[i] + 3;
+            pR[o + r] += (J0[i] * pw[o] + J1[i] * pw[o + 1] + J2[i] * pw[o + 2]) * c;
+        }
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHBODYSTATESTORE_H
+#define CHBODYSTATESTORE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
+#include "chrono/core/ChMath.h"
+#include "chrono/core/ChVectorDynamic.h"
+#include "chrono/timestepper/ChState.h"
+
+namespace chrono {
+
+class ChBody;
+
+/// Contiguous, structure-of-arrays store of the offsets and mass properties of the active
+/// bodies of an assembly (see ChAssembly::SetUseBodyStateStore()).
+/// Offsets, masses and inertias are kept in separate aligned arrays (one entry per body, as
+/// host_data.mass_rigid etc. in Chrono::Parallel), refreshed only when bodies are bound, at each
+/// Setup(). The state gather, the state increment and the M*v products of the integrators are
+/// then done by plain loops over the arrays and the state vectors, without per-body virtual calls.
+///
+/// Positions and velocities are not copied: bodies keep owning them in their ChFrameMoving and
+/// are read in place. This assumes that the bound bodies do not override the state functions of
+/// ChBody (IntStateGather, IntStateIncrement, IntLoadResidual_Mv), and that their masses do not
+/// change between two Setup().
+class ChApi ChBodyStateStore {
+  public:
+    typedef std::vector<double, aligned_allocator<double, 64>> array_t;
+
+    ChBodyStateStore() : nbodies(0) {}
+
+    /// Index the active bodies in the given list, with their current offsets in the state vectors,
+    /// and load their mass properties. To be called after the offsets are set (Setup).
+    void Bind(const std::vector<std::shared_ptr<ChBody>>& bodylist);
+
+    /// Release the references to the bodies.
+    void Clear();
+
+    /// Number of bound bodies.
+    int GetNbodies() const { return nbodies; }
+
+    /// Gather the positions and velocities of the bodies (as ChBody::IntStateGather).
+    /// Offsets of bodies are shifted by displ_x and displ_v.
+    void IntStateGather(const unsigned int displ_x, ChState& x, const unsigned int displ_v, ChStateDelta& v) const;
+
+    /// Compute x_new = x + Dv for all bodies (as ChBody::IntStateIncrement).
+    void IntStateIncrement(const unsigned int displ_x,
+                           ChState& x_new,
+                           const ChState& x,
+                           const unsigned int displ_v,
+                           const ChStateDelta& Dv) const;
+
+    /// Compute R += c*M*w for all bodies (as ChBody::IntLoadResidual_Mv), using the stored masses.
+    void IntLoadResidual_Mv(const unsigned int displ_v,
+                            ChVectorDynamic<>& R,
+                            const ChVectorDynamic<>& w,
+                            const double c) const;
+
+    /// Direct access to the arrays, for kernels working on all bodies at once.
+    /// Components are stored one after the other, e.g. GetInertia(1)[i] is the xy inertia of the i-th body.
+    const int* GetOffset_x() const { return off_x.data(); }  ///< offsets of bodies in the x state vector
+    const int* GetOffset_w() const { return off_w.data(); }  ///< offsets of bodies in the v state vector
+    const double* GetMass() const { return mass.data(); }
+    const double* GetInertia(int k) const { return &inertia[k * nbodies]; }  ///< k-th element, row-major
+
+  private:
+    int nbodies;
+    std::vector<ChBody*> bodies;  ///< bound bodies (owned by the assembly)
+    std::vector<int> off_x;       ///< offsets of bodies in the x state vector
+    std::vector<int> off_w;       ///< offsets of bodies in the v state vector
+
+    array_t mass;     ///< nbodies
+    array_t inertia;  ///< 9 x nbodies (row-major)
+};
+
+}  // end namespace chrono
+
+#endif
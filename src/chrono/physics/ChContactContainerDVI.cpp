@@ -24,15 +24,9 @@ using namespace geometry;
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerDVI)
 
-ChContactContainerDVI::ChContactContainerDVI()
-    : n_added_6_6(0), n_added_6_3(0), n_added_3_3(0), n_added_6_6_rolling(0) {}
+ChContactContainerDVI::ChContactContainerDVI() {}
 
-ChContactContainerDVI::ChContactContainerDVI(const ChContactContainerDVI& other) : ChContactContainerBase(other) {
-    n_added_6_6 = 0;
-    n_added_6_3 = 0;
-    n_added_3_3 = 0;
-    n_added_6_6_rolling = 0;
-}
+ChContactContainerDVI::ChContactContainerDVI(const ChContactContainerDVI& other) : ChContactContainerBase(other) {}
 
 ChContactContainerDVI::~ChContactContainerDVI() {
     RemoveAllContacts();
@@ -43,80 +37,42 @@ void ChContactContainerDVI::Update(double mytime, bool update_assets) {
     ChContactContainerBase::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerDVI::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    contactlist_6_6.Clear();
+    contactlist_6_3.Clear();
+    contactlist_3_3.Clear();
+    contactlist_6_6_rolling.Clear();
 }
 
 void ChContactContainerDVI::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
-    n_added_6_6_rolling = 0;
+    contactlist_6_6.BeginAdd();
+    contactlist_6_3.BeginAdd();
+    contactlist_3_3.BeginAdd();
+    contactlist_6_6_rolling.BeginAdd();
 }
 
 void ChContactContainerDVI::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+    // Contact objects beyond the last added contact are kept in the pools and
+    // recycled at the next collision detection pass (or released if unused for long).
+    contactlist_6_6.EndAdd();
+    contactlist_6_3.EndAdd();
+    contactlist_3_3.EndAdd();
+    contactlist_6_6_rolling.EndAdd();
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,
-                           Titer& lastcontact,
-                           int& n_added,
-                           ChContactContainerBase* mcontainer,
-                           Ta* objA,  ///< collidable object A
-                           Tb* objB,  ///< collidable object B
-                           const collision::ChCollisionInfo& cinfo) {
-    if (lastcontact != contactlist.end()) {
-        // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo);
-        lastcontact++;
-
-    } else {
-        // add new contact
-        Tcont* mc = new Tcont(mcontainer, objA, objB, cinfo);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
-    }
-    n_added++;
+template <class Tcont, class Ta, class Tb>
+void _AddContact(ChContactPool<Tcont>& contactlist,
+                 ChContactContainerBase* container,
+                 Ta* objA,
+                 Tb* objB,
+                 const collision::ChCollisionInfo& cinfo) {
+    bool matched;
+    Tcont* mc = contactlist.Add(container, objA, objB, cinfo, &matched);
+
+    // A contact that did not exist at the previous step has no reactions to warm start from.
+    // The persistent cache of the collision engine, if any, is initialized by the collision engine.
+    if (!matched)
+        mc->ClearOwnReactionsCache();
 }
 
 void ChContactContainerDVI::AddContact(const collision::ChCollisionInfo& mcontact) {
@@ -156,16 +112,15 @@ void ChContactContainerDVI::AddContact(const collision::ChCollisionInfo& mcontac
         if (ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(mcontact.modelB->GetContactable())) {
             if ((mmatA->rolling_friction && mmatB->rolling_friction) ||
                 (mmatA->spinning_friction && mmatB->spinning_friction)) {
-                _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
-                                      mmboA, mmboB, mcontact);
+                _AddContact(contactlist_6_6_rolling, this, mmboA, mmboB, mcontact);
             } else {
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, mmboA, mmboB, mcontact);
+                _AddContact(contactlist_6_6, this, mmboA, mmboB, mcontact);
             }
             return;
         }
         // 6_3
         if (ChContactable_1vars<3>* mmboB = dynamic_cast<ChContactable_1vars<3>*>(mcontact.modelB->GetContactable())) {
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboA, mmboB, mcontact);
+            _AddContact(contactlist_6_3, this, mmboA, mmboB, mcontact);
             return;
         }
     }
@@ -174,12 +129,12 @@ void ChContactContainerDVI::AddContact(const collision::ChCollisionInfo& mcontac
         // 3_6 -> 6_3
         if (ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(mcontact.modelB->GetContactable())) {
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboB, mmboA, swapped_contact);
+            _AddContact(contactlist_6_3, this, mmboB, mmboA, swapped_contact);
             return;
         }
         // 3_3
         if (ChContactable_1vars<3>* mmboB = dynamic_cast<ChContactable_1vars<3>*>(mcontact.modelB->GetContactable())) {
-            _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, mmboA, mmboB, mcontact);
+            _AddContact(contactlist_3_3, this, mmboA, mmboB, mcontact);
             return;
         }
     }
@@ -194,8 +149,8 @@ void ChContactContainerDVI::ComputeContactForces() {
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->ReportContactCallback(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -209,8 +164,8 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChReportContactCallback*
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactlist, ChReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->ReportContactCallback(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -233,11 +188,11 @@ void ChContactContainerDVI::ReportAllContacts(ChReportContactCallback* mcallback
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactPool<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -255,11 +210,11 @@ void ChContactContainerDVI::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactPool<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -277,13 +232,13 @@ void ChContactContainerDVI::IntStateScatterReactions(const unsigned int off_L, c
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,
-                          std::list<Tcont*>& contactlist,
+                          ChContactPool<Tcont>& contactlist,
                           const unsigned int off_L,    ///< offset in L multipliers
                           ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,  ///< the L vector
                           const double c,              ///< a scaling factor
                           const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -305,14 +260,14 @@ void ChContactContainerDVI::IntLoadResidual_CqL(const unsigned int off_L,    ///
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,
-                          std::list<Tcont*>& contactlist,
+                          ChContactPool<Tcont>& contactlist,
                           const unsigned int off,  ///< offset in Qc residual
                           ChVectorDynamic<>& Qc,   ///< result: the Qc residual, Qc += c*C
                           const double c,          ///< a scaling factor
                           bool do_clamp,           ///< apply clamping to c*C?
                           double recovery_clamp,   ///< value for min/max clamping of c*C
                           const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -335,17 +290,20 @@ void ChContactContainerDVI::IntLoadConstraint_C(const unsigned int off,  ///< of
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactPool<Tcont>& contactlist,
                       const unsigned int off_v,  ///< offset in v, R
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
                       const unsigned int off_L,  ///< offset in L, Qc
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
-                      const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+                      const int stride,
+                      bool warm_start) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
+        if (warm_start)
+            (*itercontact)->ContWarmStart();
         coffset += stride;
         ++itercontact;
     }
@@ -357,24 +315,33 @@ void ChContactContainerDVI::IntToDescriptor(const unsigned int off_v,  ///< offs
                                             const unsigned int off_L,  ///< offset in L, Qc
                                             const ChVectorDynamic<>& L,
                                             const ChVectorDynamic<>& Qc) {
+    // Multipliers of persistent contacts are initialized with the reactions of the previous
+    // step, if the solver uses warm starting (the L vector is usually zero at this point).
+    // Only the main solve of a step (the first one) is warm started: a following solve, such
+    // as the position stabilization of a projected timestepper, solves for other multipliers.
+    bool warm_start = GetSystem() && GetSystem()->GetSolverWarmStarting() && GetSystem()->GetSolverCallsCount() == 0;
+
     unsigned int coffset = 0;
-    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6);
+    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3, warm_start);
+    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3, warm_start);
+    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3, warm_start);
+    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6, warm_start);
 }
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactPool<Tcont>& contactlist,
                         const unsigned int off_v,  ///< offset in v
                         ChStateDelta& v,
                         const unsigned int off_L,  ///< offset in L
                         ChVectorDynamic<>& L,
-                        const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+                        const int stride,
+                        bool store_cache) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
+        if (store_cache)
+            (*itercontact)->ContStoreReactionsCache();
         coffset += stride;
         ++itercontact;
     }
@@ -384,18 +351,22 @@ void ChContactContainerDVI::IntFromDescriptor(const unsigned int off_v,  ///< of
                                               ChStateDelta& v,
                                               const unsigned int off_L,  ///< offset in L
                                               ChVectorDynamic<>& L) {
+    // The reactions cache is saved only from the main solve of a step (the solver calls count
+    // is already incremented here), so that a stabilization solve does not overwrite it.
+    bool store_cache = !GetSystem() || GetSystem()->GetSolverCallsCount() <= 1;
+
     unsigned int coffset = 0;
-    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6);
+    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3, store_cache);
+    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3, store_cache);
+    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3, store_cache);
+    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6, store_cache);
 }
 
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& mdescriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(mdescriptor);
         ++itercontact;
@@ -410,8 +381,8 @@ void ChContactContainerDVI::InjectConstraints(ChSystemDescriptor& mdescriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -426,8 +397,8 @@ void ChContactContainerDVI::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -446,9 +417,9 @@ void ChContactContainerDVI::ConstraintsLoadJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
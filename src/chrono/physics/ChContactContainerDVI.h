@@ -15,9 +15,8 @@
 #ifndef CHCONTACTCONTAINERDVI_H
 #define CHCONTACTCONTAINERDVI_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainerBase.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactDVI.h"
 #include "chrono/physics/ChContactDVIrolling.h"
 #include "chrono/physics/ChContactable.h"
@@ -25,8 +24,8 @@
 namespace chrono {
 
 /// Class representing a container of many complementarity contacts.
-/// This is implemented as a typical linked list of ChContactDVI objects
-/// (that is, contacts between two ChContactable objects, with 3 reactions).
+/// This is implemented as persistent pools of ChContactDVI objects (that is, contacts
+/// between two ChContactable objects, with 3 reactions), recycled at each step.
 /// It might also contain ChContactDVIrolling objects (extended versions of ChContactDVI,
 /// with 6 reactions, that account also for rolling and spinning resistance), but also
 /// for '6dof vs 6dof' contactables.
@@ -43,20 +42,10 @@ class ChApi ChContactContainerDVI : public ChContactContainerBase {
     typedef ChContactDVIrolling<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactDVIrolling_6_6;
 
   protected:
-    std::list<ChContactDVI_6_6*> contactlist_6_6;
-    std::list<ChContactDVI_6_3*> contactlist_6_3;
-    std::list<ChContactDVI_3_3*> contactlist_3_3;
-    std::list<ChContactDVIrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactDVI_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactDVI_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactDVI_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactDVIrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactDVI_6_6> contactlist_6_6;
+    ChContactPool<ChContactDVI_6_3> contactlist_6_3;
+    ChContactPool<ChContactDVI_3_3> contactlist_3_3;
+    ChContactPool<ChContactDVIrolling_6_6> contactlist_6_6_rolling;
 
   public:
     ChContactContainerDVI();
@@ -67,24 +56,28 @@ class ChApi ChContactContainerDVI : public ChContactContainerBase {
     virtual ChContactContainerDVI* Clone() const override { return new ChContactContainerDVI(*this); }
 
     /// Tell the number of added contacts
-    virtual int GetNcontacts() const override { return n_added_6_6 + n_added_6_3 + n_added_3_3 + n_added_6_6_rolling; }
+    virtual int GetNcontacts() const override {
+        return contactlist_6_6.GetNadded() + contactlist_6_3.GetNadded() + contactlist_3_3.GetNadded() +
+               contactlist_6_6_rolling.GetNadded();
+    }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding
     /// all contacts (for example with AddContact() or similar). Instead of
-    /// simply deleting all list of the previous contacts, this optimized implementation
-    /// rewinds the link iterator to begin and tries to reuse previous contact objects
-    /// until possible, to avoid too much allocation/deallocation.
+    /// simply deleting all the previous contacts, this optimized implementation
+    /// rewinds the contact pools and recycles the previous contact objects,
+    /// preferably the one used by the same contact at the previous step.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two frames.
     virtual void AddContact(const collision::ChCollisionInfo& mcontact) override;
 
-    /// The collision system will call BeginAddContact() after adding
-    /// all contacts (for example with AddContact() or similar). This optimized version
-    /// purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddContact() after adding
+    /// all contacts (for example with AddContact() or similar). Contact objects
+    /// that were not reused are kept in the pools, for recycling at the next steps,
+    /// and are destroyed if the pools stay larger than needed for many steps.
     virtual void EndAddContact() override;
 
     /// Scans all the contacts and for each contact executes the ReportContactCallback()
@@ -94,7 +87,8 @@ class ChApi ChContactContainerDVI : public ChContactContainerBase {
     /// Tell the number of scalar bilateral constraints (actually, friction
     /// constraints aren't exactly as unilaterals, but count them too)
     virtual int GetDOC_d() override {
-        return 3 * (n_added_6_6 + n_added_6_3 + n_added_3_3) + 6 * (n_added_6_6_rolling);
+        return 3 * (contactlist_6_6.GetNadded() + contactlist_6_3.GetNadded() + contactlist_3_3.GetNadded()) +
+               6 * (contactlist_6_6_rolling.GetNadded());
     }
 
     /// In detail, it computes jacobians, violations, etc. and stores
@@ -34,7 +34,8 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
     typedef typename ChContactTuple<Ta, Tb>::typecarr_b typecarr_b;
 
   protected:
-    float* reactions_cache;  ///< N,U,V reactions which might be stored in a persistent contact manifold
+    float* reactions_cache;  ///< N,U,V (and rolling) reactions, maybe stored in a persistent contact manifold
+    float own_reactions_cache[6];  ///< used as reactions cache if the collision engine does not provide one
 
     /// The three scalar constraints, to be fed into the system solver.
     /// They contain jacobians data and special functions.
@@ -57,6 +58,9 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
     ChContactDVI() {
         Nx.SetTangentialConstraintU(&Tu);
         Nx.SetTangentialConstraintV(&Tv);
+
+        reactions_cache = own_reactions_cache;
+        ClearOwnReactionsCache();
     }
 
     ChContactDVI(ChContactContainerBase* mcontainer,      ///< contact container
@@ -68,6 +72,9 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
         Nx.SetTangentialConstraintU(&Tu);
         Nx.SetTangentialConstraintV(&Tv);
 
+        for (int i = 0; i < 6; ++i)
+            own_reactions_cache[i] = 0;
+
         Reset(mobjA, mobjB, cinfo);
     }
 
@@ -123,7 +130,10 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
         this->compliance = mat.compliance;
         this->complianceT = mat.complianceT;
 
-        this->reactions_cache = cinfo.reaction_cache;
+        // Use the persistent cache of the collision engine, if any. Otherwise the
+        // cache of this object is valid only if the owner container recycles this
+        // object for the same contact (see ChContactPool).
+        this->reactions_cache = cinfo.reaction_cache ? cinfo.reaction_cache : own_reactions_cache;
 
         // COMPUTE JACOBIANS
 
@@ -147,6 +157,13 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
     /// Set the contact friction coefficient
     virtual void SetFriction(double mf) { Nx.SetFrictionCoefficient(mf); }
 
+    /// Zero the reactions cache owned by this contact, e.g. when it is a new contact.
+    /// The cache provided by the collision engine, if any, is managed by the collision engine.
+    void ClearOwnReactionsCache() {
+        for (int i = 0; i < 6; ++i)
+            own_reactions_cache[i] = 0;
+    }
+
     //
     // UPDATING FUNCTIONS
     //
@@ -263,6 +280,22 @@ class ChContactDVI : public ChContactTuple<Ta, Tb> {
         L(off_L + 2) = Tv.Get_l_i();
     }
 
+    /// Store the multipliers of the constraints in the reactions cache, for warm starting
+    /// the next step. To be called only after the main solve of a step.
+    virtual void ContStoreReactionsCache() {
+        reactions_cache[0] = (float)Nx.Get_l_i();
+        reactions_cache[1] = (float)Tu.Get_l_i();
+        reactions_cache[2] = (float)Tv.Get_l_i();
+    }
+
+    /// Set the multipliers of the constraints from the cached reactions of the previous
+    /// step, to warm start the solver. To be called after ContIntToDescriptor().
+    virtual void ContWarmStart() {
+        Nx.Set_l_i(reactions_cache[0]);
+        Tu.Set_l_i(reactions_cache[1]);
+        Tv.Set_l_i(reactions_cache[2]);
+    }
+
     virtual void InjectConstraints(ChSystemDescriptor& mdescriptor) override {
         mdescriptor.InsertConstraint(&Nx);
         mdescriptor.InsertConstraint(&Tu);
@@ -238,6 +238,24 @@ class ChContactDVIrolling :
         L(off_L + 5) = Rv.Get_l_i();
     }
 
+    virtual void ContStoreReactionsCache() {
+        // base behaviour too
+        ChContactDVI<Ta, Tb>::ContStoreReactionsCache();
+
+        this->reactions_cache[3] = (float)Rx.Get_l_i();
+        this->reactions_cache[4] = (float)Ru.Get_l_i();
+        this->reactions_cache[5] = (float)Rv.Get_l_i();
+    }
+
+    virtual void ContWarmStart() {
+        // base behaviour too
+        ChContactDVI<Ta, Tb>::ContWarmStart();
+
+        Rx.Set_l_i(this->reactions_cache[3]);
+        Ru.Set_l_i(this->reactions_cache[4]);
+        Rv.Set_l_i(this->reactions_cache[5]);
+    }
+
     virtual void InjectConstraints(ChSystemDescriptor& mdescriptor)  {
         // base behaviour too
         ChContactDVI< Ta, Tb >::InjectConstraints(mdescriptor);
@@ -0,0 +1,329 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHCONTACTPOOL_H
+#define CHCONTACTPOOL_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionInfo.h"
+
+namespace chrono {
+
+class ChContactContainerBase;
+
+/// Persistent pool of contact objects of type Tcont (e.g. ChContactDVI<...>).
+/// Contact objects are constructed in place inside contiguous chunks of memory, the first
+/// time a slot is needed, and are then recycled (with Reset()) at each collision detection
+/// pass, so that no per-contact allocation happens in steady state. Contacts are addressed
+/// by index: the active ones are those in [0, GetNadded()).
+/// Contact objects never move in memory once constructed, since the system descriptor keeps
+/// pointers to the constraints they contain.
+///
+/// When a new contact is added, the pool first tries to reuse the same object that was used
+/// for the same contact at the previous pass. Contacts are identified by the pair of collision
+/// models, plus an ordinal for multiple contacts of the same pair (in the order they are reported).
+/// The address of the reaction cache of the collision engine is not used as identity, since the
+/// collision engine may move its persistent points (e.g. Bullet compacts the points of a manifold
+/// when one is removed). New contacts never take the object of a contact of the previous pass
+/// that was not matched yet, so that it remains available if that contact is added later.
+///
+/// At the end of each pass (EndAdd()), the objects that were not reused drop the pointers to
+/// their contactables, which may be deleted before the object is recycled. Every N passes (see
+/// SetShrinkInterval()) the objects beyond the largest number of contacts of those passes are
+/// destroyed, and the chunks of memory that do not hold any object are released.
+template <class Tcont>
+class ChContactPool {
+  public:
+    typedef typename std::vector<Tcont*>::iterator iterator;
+    typedef typename std::vector<Tcont*>::const_iterator const_iterator;
+
+    ChContactPool(int mchunk_size = 256)
+        : chunk_size(mchunk_size),
+          n_added(0),
+          n_free(0),
+          reuse_by_key(true),
+          shrink_interval(100),
+          n_passes(0),
+          high_water(0) {}
+    ~ChContactPool() { Clear(); }
+
+    /// Number of contacts added since the last call to BeginAdd().
+    int GetNadded() const { return n_added; }
+
+    /// Number of contact objects constructed so far (active plus recyclable).
+    int GetCapacity() const { return (int)slots.size(); }
+
+    /// Enable/disable matching of new contacts to the objects of the previous pass (default: true).
+    /// If disabled, slots are simply recycled in insertion order.
+    void SetReuseByKey(bool val) { reuse_by_key = val; }
+    bool GetReuseByKey() const { return reuse_by_key; }
+
+    /// Set the number of passes after which the pool is trimmed to the largest number of contacts
+    /// added in those passes (default: 100). Use 0 to never release contact objects.
+    void SetShrinkInterval(int passes) {
+        shrink_interval = passes;
+        n_passes = 0;
+        high_water = 0;
+    }
+    int GetShrinkInterval() const { return shrink_interval; }
+
+    /// Access the i-th active contact.
+    Tcont* operator[](int i) const { return slots[i]; }
+
+    /// Iterators over the active contacts.
+    iterator begin() { return slots.begin(); }
+    iterator end() { return slots.begin() + n_added; }
+    const_iterator begin() const { return slots.begin(); }
+    const_iterator end() const { return slots.begin() + n_added; }
+
+    /// Rewind the pool before a new pass of AddContact() calls.
+    /// All previously constructed objects become available for recycling.
+    void BeginAdd() {
+        // Objects used at the last pass are pending until matched (or overwritten, if unmatched)
+        prev_map.clear();
+        pending.assign(slots.size(), 0);
+        if (reuse_by_key) {
+            for (int j = 0; j < n_added; j++) {
+                prev_map[keys[j]] = j;
+                pending[j] = 1;
+            }
+        }
+        pair_count.clear();
+        n_free = n_added;
+        n_added = 0;
+    }
+
+    /// Add a contact. Returns the (reset) contact object. If 'matched' is not null, it is set to
+    /// true when the object was used by the same contact at the previous pass.
+    template <class Ta, class Tb>
+    Tcont* Add(ChContactContainerBase* container,
+               Ta* objA,
+               Tb* objB,
+               const collision::ChCollisionInfo& cinfo,
+               bool* matched = nullptr) {
+        bool found = false;
+
+        Key key;
+        if (reuse_by_key) {
+            key = MakeKey(cinfo);
+            auto prev = prev_map.find(key);
+            if (prev != prev_map.end()) {
+                // Move the object of the previous pass in the next active slot
+                Swap(prev->second, n_added);
+                prev_map.erase(prev);
+                pending[n_added] = 0;
+                found = true;
+            } else if (n_added < (int)slots.size() && pending[n_added]) {
+                // Do not overwrite an object of the previous pass which may still be matched:
+                // move it to a free slot (possibly a new one) and use the freed slot
+                if (n_free == (int)slots.size())
+                    Construct(container, objA, objB, cinfo);
+                Swap(n_added, n_free++);
+            }
+        }
+
+        Tcont* mc;
+        if (n_added < (int)slots.size()) {
+            // recycle an existing object
+            mc = slots[n_added];
+            mc->Reset(objA, objB, cinfo);
+        } else {
+            mc = Construct(container, objA, objB, cinfo);
+        }
+        if (reuse_by_key)
+            keys[n_added] = key;
+
+        n_added++;
+        n_free = std::max(n_free, n_added);
+        if (matched)
+            *matched = found;
+        return mc;
+    }
+
+    /// Close a pass of AddContact() calls. Objects that were not reused release their contactables
+    /// and, once every SetShrinkInterval() passes, unused objects are destroyed.
+    void EndAdd() {
+        for (int j = n_added; j < (int)slots.size(); j++)
+            slots[j]->ReleaseContactables();
+        n_free = n_added;
+
+        high_water = std::max(high_water, n_added);
+        if (shrink_interval > 0 && ++n_passes >= shrink_interval) {
+            Shrink(high_water);
+            n_passes = 0;
+            high_water = 0;
+        }
+    }
+
+    /// Destroy the contact objects beyond the first n (at least the active ones are kept),
+    /// and release the chunks of memory that no longer hold any object.
+    void Shrink(int n) {
+        n = std::max(n, n_added);
+        if (n >= (int)slots.size())
+            return;
+        for (int j = n; j < (int)slots.size(); j++) {
+            slots[j]->~Tcont();
+            free_storage.push_back(static_cast<storage_t*>(static_cast<void*>(slots[j])));
+        }
+        slots.resize(n);
+        keys.resize(n);
+        pending.resize(n);
+        n_free = std::min(n_free, n);
+        ReleaseFreeChunks();
+    }
+
+    /// Destroy all contact objects and release memory.
+    void Clear() {
+        for (auto mc : slots)
+            mc->~Tcont();
+        slots.clear();
+        keys.clear();
+        pending.clear();
+        chunks.clear();
+        free_storage.clear();
+        prev_map.clear();
+        pair_count.clear();
+        n_added = 0;
+        n_free = 0;
+        n_passes = 0;
+        high_water = 0;
+    }
+
+  private:
+    // Identity of a contact across passes of the collision detection
+    struct Key {
+        Key() : a(nullptr), b(nullptr), ordinal(0) {}
+        const void* a;
+        const void* b;
+        int ordinal;
+        bool operator==(const Key& other) const { return a == other.a && b == other.b && ordinal == other.ordinal; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            size_t h = std::hash<const void*>()(k.a);
+            h ^= std::hash<const void*>()(k.b) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<int>()(k.ordinal) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    Key MakeKey(const collision::ChCollisionInfo& cinfo) {
+        Key key;
+        key.a = cinfo.modelA;
+        key.b = cinfo.modelB;
+        key.ordinal = 0;
+        key.ordinal = pair_count[key]++;
+        return key;
+    }
+
+    // Construct a new object in a free storage location, and append it to the slots.
+    template <class Ta, class Tb>
+    Tcont* Construct(ChContactContainerBase* container,
+                     Ta* objA,
+                     Tb* objB,
+                     const collision::ChCollisionInfo& cinfo) {
+        if (free_storage.empty()) {
+            chunks.push_back(std::unique_ptr<storage_t[]>(new storage_t[chunk_size]));
+            // in reverse order, so that the chunk is filled from its start
+            for (int k = chunk_size - 1; k >= 0; k--)
+                free_storage.push_back(&chunks.back()[k]);
+        }
+        void* addr = free_storage.back();
+        free_storage.pop_back();
+        Tcont* mc = new (addr) Tcont(container, objA, objB, cinfo);
+        slots.push_back(mc);
+        keys.push_back(Key());
+        pending.push_back(0);
+        return mc;
+    }
+
+    // Exchange the objects in two slots, updating the slot of pending objects.
+    void Swap(int i, int j) {
+        if (i == j)
+            return;
+        std::swap(slots[i], slots[j]);
+        std::swap(keys[i], keys[j]);
+        std::swap(pending[i], pending[j]);
+        if (pending[i])
+            prev_map[keys[i]] = i;
+        if (pending[j])
+            prev_map[keys[j]] = j;
+    }
+
+    typedef typename std::aligned_storage<sizeof(Tcont), alignof(Tcont)>::type storage_t;
+
+    // Release the chunks that do not hold any object, and rebuild the list of free locations.
+    void ReleaseFreeChunks() {
+        std::less<const storage_t*> less;
+        std::vector<const storage_t*> bases;
+        for (auto& chunk : chunks)
+            bases.push_back(chunk.get());
+        std::sort(bases.begin(), bases.end(), less);
+
+        // Mark the storage locations holding an object
+        std::vector<char> used(bases.size() * chunk_size, 0);
+        for (auto mc : slots) {
+            const storage_t* addr = static_cast<const storage_t*>(static_cast<const void*>(mc));
+            size_t c = std::upper_bound(bases.begin(), bases.end(), addr, less) - bases.begin() - 1;
+            used[c * chunk_size + (addr - bases[c])] = 1;
+        }
+
+        std::vector<std::unique_ptr<storage_t[]>> kept;
+        free_storage.clear();
+        for (auto& chunk : chunks) {
+            size_t c = std::lower_bound(bases.begin(), bases.end(), chunk.get(), less) - bases.begin();
+            auto first = used.begin() + c * chunk_size;
+            if (std::find(first, first + chunk_size, 1) == first + chunk_size)
+                continue;
+            for (int k = chunk_size - 1; k >= 0; k--) {
+                if (!first[k])
+                    free_storage.push_back(&chunk[k]);
+            }
+            kept.push_back(std::move(chunk));
+        }
+        chunks.swap(kept);
+    }
+
+    int chunk_size;
+    std::vector<std::unique_ptr<storage_t[]>> chunks;  ///< contiguous storage for contact objects
+    std::vector<storage_t*> free_storage;              ///< locations in the chunks not holding an object
+    std::vector<Tcont*> slots;                         ///< constructed objects, active ones first
+    std::vector<Key> keys;                             ///< identity of the object in each slot
+    std::vector<char> pending;                         ///< object of the previous pass, not matched yet?
+    int n_added;                                       ///< number of active contacts
+    int n_free;                                        ///< slots from this one on hold no pending object
+
+    bool reuse_by_key;
+    std::unordered_map<Key, int, KeyHash> prev_map;    ///< identity -> slot, pending objects of the previous pass
+    std::unordered_map<Key, int, KeyHash> pair_count;  ///< number of contacts per model pair, current pass
+
+    int shrink_interval;  ///< passes between two trims of the pool (0: never)
+    int n_passes;         ///< passes since the last trim
+    int high_water;       ///< largest number of contacts since the last trim
+
+    // Contact objects are referenced by the system descriptor: no copies.
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -103,6 +103,13 @@ class ChContactTuple {
     /// Get the colliding object B, with point P2
     Tb* GetObjB() { return this->objB; }
 
+    /// Drop the pointers to the colliding objects, when this contact is kept for
+    /// recycling but is no longer active (the objects may be deleted meanwhile).
+    void ReleaseContactables() {
+        this->objA = nullptr;
+        this->objB = nullptr;
+    }
+
     /// Get the contact coordinate system, expressed in absolute frame.
     /// This represents the 'main' reference of the link: reaction forces
     /// are expressed in this coordinate system. Its origin is point P2.
@@ -155,6 +155,9 @@ class ChApi ChPhysicsItem : public ChObj {
     /// data. By default, calls Update(mytime) using item's current time.
     virtual void Update(bool update_assets = true) { Update(ChTime, update_assets); }
 
+    /// Update the asset tree, if any (already done by Update() if update_assets is true).
+    void UpdateAssets();
+
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     /// Child classes should impement this function if GetDOF() > 0.
     /// It is used by owner ChSystem for some static analysis.
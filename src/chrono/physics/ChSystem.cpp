@@ -18,18 +18,22 @@
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChContactContainerDVI.h"
+#include "chrono/physics/ChParticlesClones.h"
 #include "chrono/physics/ChProximityContainerBase.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverGMRES.h"
 #include "chrono/solver/ChSolverJacobi.h"
 #include "chrono/solver/ChSolverMINRES.h"
 #include "chrono/solver/ChSolverPCG.h"
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverSOR.h"
+#include "chrono/solver/ChSolverSORcolored.h"
 #include "chrono/solver/ChSolverSORmultithread.h"
 #include "chrono/solver/ChSolverSymmSOR.h"
 #include "chrono/timestepper/ChStaticAnalysis.h"
+#include "chrono/utils/ChZoneProfiler.h"
 #include "chrono/core/ChLinkedListMatrix.h"
 
 using namespace chrono::collision;
@@ -205,6 +209,9 @@ ChSystem::ChSystem(unsigned int max_objects, double scene_size, bool init_sys)
       collisionpoint_callback(NULL),
       use_sleeping(false),
       G_acc(ChVector<>(0, -9.8, 0)),
+      nislands(0),
+      pipelined_step(false),
+      pipelining(false),
       stepcount(0),
       solvecount(0),
       setupcount(0),
@@ -264,7 +271,11 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
     max_iter_solver_stab = other.max_iter_solver_stab;
     SetSolverType(GetSolverType());
     parallel_thread_number = other.parallel_thread_number;
+    pipelined_step = other.pipelined_step;
+    pipelining = false;
     use_sleeping = other.use_sleeping;
+    nislands = 0;  // islands are recomputed for the bodies of this system
+    body_island.clear();
 
     ncontacts = other.ncontacts;
 
@@ -332,6 +343,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
             solver_speed = std::make_shared<ChSolverSORmultithread>("speedSolver", parallel_thread_number);
             solver_stab = std::make_shared<ChSolverSORmultithread>("posSolver", parallel_thread_number);
             break;
+        case ChSolver::Type::SOR_COLORED:
+            solver_speed = std::make_shared<ChSolverSORcolored>(parallel_thread_number);
+            solver_stab = std::make_shared<ChSolverSORcolored>(parallel_thread_number);
+            break;
         case ChSolver::Type::PMINRES:
             solver_speed = std::make_shared<ChSolverPMINRES>();
             solver_stab = std::make_shared<ChSolverPMINRES>();
@@ -352,6 +367,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
             solver_speed = std::make_shared<ChSolverMINRES>();
             solver_stab = std::make_shared<ChSolverMINRES>();
             break;
+        case ChSolver::Type::GMRES:
+            solver_speed = std::make_shared<ChSolverGMRES>();
+            solver_stab = std::make_shared<ChSolverGMRES>();
+            break;
         default:
             solver_speed = std::make_shared<ChSolverSymmSOR>();
             solver_stab = std::make_shared<ChSolverSymmSOR>();
@@ -443,6 +462,11 @@ void ChSystem::SetParallelThreadNumber(int mthreads) {
         std::static_pointer_cast<ChSolverSORmultithread>(solver_speed)->ChangeNumberOfThreads(mthreads);
         std::static_pointer_cast<ChSolverSORmultithread>(solver_stab)->ChangeNumberOfThreads(mthreads);
     }
+
+    if (solver_speed->GetType() == ChSolver::Type::SOR_COLORED) {
+        std::static_pointer_cast<ChSolverSORcolored>(solver_speed)->SetNumThreads(mthreads);
+        std::static_pointer_cast<ChSolverSORcolored>(solver_stab)->SetNumThreads(mthreads);
+    }
 }
 
 // Plug-in components configuration
@@ -639,135 +663,155 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
     }
 }
 
-bool ChSystem::ManageSleepingBodies() {
-    if (!GetUseSleeping())
-        return 0;
+// Find the root of the island of the i-th body (with path halving).
+static int _FindIsland(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
 
-    // STEP 1:
-    // See if some body could change from no sleep-> sleep
+// Merge the islands of two bodies, unless one of them is fixed or not in the system.
+static void _JoinIslands(std::vector<int>& parent,
+                         const std::unordered_map<ChBody*, int>& index,
+                         ChBody* b1,
+                         ChBody* b2) {
+    if (!b1 || !b2 || b1->GetBodyFixed() || b2->GetBodyFixed())
+        return;
+    auto i1 = index.find(b1);
+    auto i2 = index.find(b2);
+    if (i1 == index.end() || i2 == index.end())
+        return;
+    int r1 = _FindIsland(parent, i1->second);
+    int r2 = _FindIsland(parent, i2->second);
+    if (r1 != r2)
+        parent[std::max(r1, r2)] = std::min(r1, r2);
+}
 
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        // mark as 'could sleep' candidate
-        bodylist[ip]->TrySleeping();
-    }
+void ChSystem::ComputeIslands() {
+    int n = (int)bodylist.size();
 
-    // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one,
-    // if so, set to no sleep.
+    std::vector<int> parent(n);
+    std::unordered_map<ChBody*, int> index;
+    for (int ip = 0; ip < n; ++ip) {
+        parent[ip] = ip;
+        index[bodylist[ip].get()] = ip;
+    }
 
-    // Make this class for iterating through contacts
+    // Bodies connected by links
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+        if (Lpointer->IsActive() && Lpointer->IsRequiringWaking()) {
+            _JoinIslands(parent, index, dynamic_cast<ChBody*>(Lpointer->GetBody1()),
+                         dynamic_cast<ChBody*>(Lpointer->GetBody2()));
+        }
+    }
 
-    class _wakeup_reporter_class : public ChReportContactCallback {
+    // Bodies in contact
+    class _island_reporter_class : public ChReportContactCallback {
       public:
-        // Callback, used to report contact points already added to the container.
-        // This must be implemented by a child class of ChReportContactCallback.
-        // If returns false, the contact scanning will be stopped.
-        virtual bool ReportContactCallback(
-            const ChVector<>& pA,             ///< get contact pA
-            const ChVector<>& pB,             ///< get contact pB
-            const ChMatrix33<>& plane_coord,  ///< get contact plane coordsystem (A column 'X' is contact normal)
-            const double& distance,           ///< get contact distance
-            const ChVector<>& react_forces,   ///< get react.forces (if already computed). In coordsystem 'plane_coord'
-            const ChVector<>& react_torques,  ///< get react.torques, if rolling friction (if already computed).
-            ChContactable* contactobjA,  ///< get model A (note: some containers may not support it and could be zero!)
-            ChContactable* contactobjB   ///< get model B (note: some containers may not support it and could be zero!)
-            ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->GetSleeping();
-            bool sleep2 = b2->GetSleeping();
-            bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool ground1 = b1->GetBodyFixed();
-            bool ground2 = b2->GetBodyFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            someone_sleeps = sleep1 | sleep2 | someone_sleeps;
-
+        virtual bool ReportContactCallback(const ChVector<>& pA,
+                                           const ChVector<>& pB,
+                                           const ChMatrix33<>& plane_coord,
+                                           const double& distance,
+                                           const ChVector<>& react_forces,
+                                           const ChVector<>& react_torques,
+                                           ChContactable* contactobjA,
+                                           ChContactable* contactobjB) override {
+            _JoinIslands(*parent, *index, dynamic_cast<ChBody*>(contactobjA), dynamic_cast<ChBody*>(contactobjB));
             return true;  // to continue scanning contacts
         }
 
-        // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::vector<int>* parent;
+        std::unordered_map<ChBody*, int>* index;
     };
 
-    _wakeup_reporter_class my_waker;
-    my_waker.need_Setup_A = false;
+    _island_reporter_class my_reporter;
+    my_reporter.parent = &parent;
+    my_reporter.index = &index;
+    contact_container->ReportAllContacts(&my_reporter);
+
+    // Bodies that fell asleep in the same island
+    std::unordered_map<int, ChBody*> sleeping_root;
+    for (int ip = 0; ip < n; ++ip) {
+        ChBody* body = bodylist[ip].get();
+        if (!body->GetSleeping())
+            continue;
+        auto island = sleeping_island.find(body);
+        if (island == sleeping_island.end())
+            continue;
+        auto root = sleeping_root.insert(std::make_pair(island->second, body));
+        _JoinIslands(parent, index, root.first->second, body);
+    }
 
-    bool need_Setup_L = false;
+    // Number the islands in the order of their first body
+    nislands = 0;
+    body_island.assign(n, -1);
+    for (int ip = 0; ip < n; ++ip) {
+        if (bodylist[ip]->GetBodyFixed())
+            continue;
+        int root = _FindIsland(parent, ip);
+        if (root == ip)
+            body_island[ip] = nislands++;
+        else
+            body_island[ip] = body_island[root];
+    }
+}
 
-    for (int i = 0; i < 1; i++)  //***TO DO*** reconfigurable number of wakeup cycles
-    {
-        my_waker.someone_sleeps = false;
+bool ChSystem::ManageSleepingBodies() {
+    if (!GetUseSleeping())
+        return 0;
 
-        // scan all links and wake connected bodies
-        for (unsigned int ip = 0; ip < linklist.size(); ++ip)  // ITERATE on links
-        {
-            std::shared_ptr<ChLink> Lpointer = linklist[ip];
-
-            if (Lpointer->IsRequiringWaking()) {
-                ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                if (b1 && b2) {
-                    bool sleep1 = b1->GetSleeping();
-                    bool sleep2 = b2->GetSleeping();
-                    bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                    bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                    if (sleep1 && !(sleep2 || could_sleep2)) {
-                        b1->SetSleeping(false);
-                        need_Setup_L = true;
-                    }
-                    if (sleep2 && !(sleep1 || could_sleep1)) {
-                        b2->SetSleeping(false);
-                        need_Setup_L = true;
-                    }
-                    if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                        b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                    }
-                    if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                        b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                    }
-                }
-            }
-        }
+    // STEP 1:
+    // See if some body could change from no sleep-> sleep
 
-        // scan all contacts and wake neighbouring bodies
-        contact_container->ReportAllContacts(&my_waker);
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        // mark as 'could sleep' candidate
+        bodylist[ip]->TrySleeping();
+    }
 
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker.someone_sleeps)
-            break;
+    // STEP 2:
+    // Find the islands of bodies connected by links and contacts. An island is awake
+    // if some of its bodies is neither sleeping nor a sleep candidate.
+
+    ComputeIslands();
+
+    std::vector<bool> island_awake(nislands, false);
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+        if (body_island[ip] >= 0 && !Bpointer->GetSleeping() && !Bpointer->BFlagGet(ChBody::BodyFlag::COULDSLEEP))
+            island_awake[body_island[ip]] = true;
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
+    // STEP 3:
+    // Wake up all the bodies of the awake islands, put to sleep all the bodies of the others.
+
+    bool need_Setup = false;
+    sleeping_island.clear();
     for (int ip = 0; ip < bodylist.size(); ++ip) {
-        if (bodylist[ip]->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
-            bodylist[ip]->SetSleeping(true);
-            ++need_Setup_B;
+        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+        int island = body_island[ip];
+        if (island < 0)
+            continue;
+        if (island_awake[island]) {
+            if (Bpointer->GetSleeping()) {
+                Bpointer->SetSleeping(false);
+                need_Setup = true;
+            }
+            Bpointer->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        } else {
+            if (!Bpointer->GetSleeping()) {
+                Bpointer->SetSleeping(true);
+                need_Setup = true;
+            }
+            sleeping_island[Bpointer.get()] = island;
         }
     }
 
     // if some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker.need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (need_Setup) {
         Setup();
         return true;
     }
@@ -802,7 +846,11 @@ void ChSystem::Setup() {
     // inherit the parent class (compute offsets of bodies, links, etc.)
     ChAssembly::Setup();
 
-    // also compute offsets for contact container
+    SetupContacts();
+}
+
+void ChSystem::SetupContacts() {
+    // compute offsets for contact container
     {
         contact_container->SetOffset_L(offset_L + ndoc_w);
 
@@ -865,6 +913,7 @@ void ChSystem::Setup() {
 // - updates all markers (automatic, as children of bodies).
 
 void ChSystem::Update(bool update_assets) {
+    CH_PROFILE_ZONE("ChSystem::Update");
     timer_update.start();  // Timer for profiling
 
     // Executes the "forUpdate" in all controls of controlslist
@@ -1295,6 +1344,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE_ZONE("ChSystem::SolverSetup");
         timer_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_setup.stop();
@@ -1305,9 +1355,13 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_solver.start();
-    GetSolver()->Solve(*descriptor);
-    timer_solver.stop();
+    {
+        const ChSolver& solver = *GetSolver();
+        CH_PROFILE_ZONE(typeid(solver));
+        timer_solver.start();
+        GetSolver()->Solve(*descriptor);
+        timer_solver.stop();
+    }
     solvecount++;
 
     // Dv and L vectors  <-- sparse solver structures
@@ -1404,6 +1458,7 @@ class SystemAddCollisionPointCallback : public ChAddContactCallback {
 };
 
 double ChSystem::ComputeCollisions() {
+    CH_PROFILE_ZONE("ChSystem::ComputeCollisions");
     double mretC = 0.0;
 
     timer_collision_broad.start();
@@ -1411,6 +1466,14 @@ double ChSystem::ComputeCollisions() {
     // Update all positions of collision models: delegate this to the ChAssembly
     SyncCollisionModels();
 
+    DetectCollisions();
+
+    timer_collision_broad.stop();
+
+    return mretC;
+}
+
+void ChSystem::DetectCollisions() {
     // Prepare the callback
 
     // In case there is some user callback for each added point..
@@ -1448,10 +1511,85 @@ double ChSystem::ComputeCollisions() {
 
     // Count the contacts of body-body type.
     ncontacts = contact_container->GetNcontacts();
+}
+
+bool ChSystem::PipelinedCollisionsAndUpdate() {
+    CH_PROFILE_ZONE("ChSystem::PipelinedCollisionsAndUpdate");
+
+    // One thread for the collision detection, at least one for the update
+    if (parallel_thread_number < 2)
+        return false;
 
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        // Containers among the other physics items would be filled and updated at the same time
+        if (std::dynamic_pointer_cast<ChContactContainerBase>(otherphysicslist[ip]) ||
+            std::dynamic_pointer_cast<ChProximityContainerBase>(otherphysicslist[ip]))
+            return false;
+        // Speed clamping changes the speeds read by the new contacts
+        if (auto mparticles = std::dynamic_pointer_cast<ChParticlesClones>(otherphysicslist[ip])) {
+            if (mparticles->GetLimitSpeed())
+                return false;
+        }
+    }
+    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
+        if (bodylist[ip]->GetLimitSpeed())
+            return false;
+    }
+
+    // As in the sequential step, offsets are computed before the update. Only the contacts
+    // are counted after the collision detection.
+    ChAssembly::Setup();
+
+    timer_collision_broad.start();
+    SyncCollisionModels();
     timer_collision_broad.stop();
 
-    return mretC;
+    // Run the collision detection in a task, while this thread updates bodies, other physics
+    // items and links, which do not change the positions and speeds read by the collision
+    // detection. Nested parallel regions are enabled so that the items can still be processed
+    // in parallel (see SetUseParallelItems()), with the threads left by the collision detection
+    // (see GetParallelItemsThreadNumber()).
+#ifdef _OPENMP
+    int max_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::max(max_levels, 2));
+#endif
+    pipelining = true;
+
+#pragma omp parallel num_threads(2)
+#pragma omp single
+    {
+#pragma omp task
+        {
+            CH_PROFILE_ZONE("ChSystem::ComputeCollisions");
+            timer_collision_broad.start();
+            DetectCollisions();
+            timer_collision_broad.stop();
+        }
+
+        {
+            CH_PROFILE_ZONE("ChSystem::Update");
+            timer_update.start();
+            ExecuteControlsForUpdate();
+            ChAssembly::Update(false);
+            timer_update.stop();
+        }
+
+#pragma omp taskwait
+    }
+
+    pipelining = false;
+#ifdef _OPENMP
+    omp_set_max_active_levels(max_levels);
+#endif
+
+    // Join: count the new contacts, then update them.
+    SetupContacts();
+
+    timer_update.start();
+    contact_container->Update(ChTime, false);
+    timer_update.stop();
+
+    return true;
 }
 
 // =============================================================================
@@ -1564,6 +1702,7 @@ int ChSystem::DoStepDynamics(double m_step) {
 // -----------------------------------------------------------------------------
 
 bool ChSystem::Integrate_Y() {
+    CH_PROFILE_ZONE("ChSystem::Integrate_Y");
     ResetTimers();
 
     timer_step.start();
@@ -1575,15 +1714,17 @@ bool ChSystem::Integrate_Y() {
     solvecount = 0;
     setupcount = 0;
 
-    // Compute contacts and create contact constraints
-    ComputeCollisions();
+    if (!pipelined_step || !PipelinedCollisionsAndUpdate()) {
+        // Compute contacts and create contact constraints
+        ComputeCollisions();
 
-    // Counts dofs, statistics, etc. (not needed because already in Advance()...? )
-    Setup();
+        // Counts dofs, statistics, etc. (not needed because already in Advance()...? )
+        Setup();
 
-    // Update everything - and put to sleep bodies that need it (not needed because already in Advance()...? )
-    // No need to update visualization assets here.
-    Update(false);
+        // Update everything - and put to sleep bodies that need it (not needed because already in Advance()...? )
+        // No need to update visualization assets here.
+        Update(false);
+    }
 
     // Re-wake the bodies that cannot sleep because they are in contact with
     // some body that is not in sleep state.
@@ -1601,7 +1742,11 @@ bool ChSystem::Integrate_Y() {
         timestepper->SetQcDoClamp(false);
 
     // PERFORM TIME STEP HERE!
-    timestepper->Advance(step);
+    {
+        const ChTimestepper& stepper = *timestepper;
+        CH_PROFILE_ZONE(typeid(stepper));
+        timestepper->Advance(step);
+    }
 
     // Executes custom processing at the end of step
     CustomEndOfStep();
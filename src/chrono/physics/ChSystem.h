@@ -22,6 +22,7 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/collision/ChCCollisionSystem.h"
 #include "chrono/core/ChLog.h"
@@ -272,6 +273,22 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Get the number of parallel threads.
     /// Note that not all solvers use parallel computation.
     int GetParallelThreadNumber() { return parallel_thread_number; }
+    /// Get the number of threads available to the parallel update of items (see ChAssembly::SetUseParallelItems()).
+    /// This is GetParallelThreadNumber(), less the thread running the collision detection during a pipelined step.
+    int GetParallelItemsThreadNumber() const { return pipelining ? parallel_thread_number - 1 : parallel_thread_number; }
+
+    /// Enable/disable the pipelined integration step (default: false).
+    /// If enabled, each step runs the collision detection on one OpenMP thread, concurrently with
+    /// the update of bodies, other physics items and links (markers, forces, jacobians, ...) on the
+    /// remaining GetParallelThreadNumber()-1 threads, joining before contacts are counted and
+    /// injected in the system descriptor. Collision callbacks and the Update() functions of items
+    /// must then be thread-safe with respect to each other, and Update() must not change positions
+    /// or speeds. Systems with less than two threads, with speed limits on bodies or particles, or
+    /// with contact or proximity containers among the other physics items always use the
+    /// sequential step.
+    void SetPipelinedStep(bool mval) { pipelined_step = mval; }
+    /// Tell if the pipelined integration step is enabled.
+    bool GetPipelinedStep() const { return pipelined_step; }
 
     /// Sets the G (gravity) acceleration vector, affecting all the bodies in the system.
     void Set_G_acc(const ChVector<>& m_acc) { G_acc = m_acc; }
@@ -576,6 +593,21 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// This is mostly called automatically by time integration.
     double ComputeCollisions();
 
+  protected:
+    /// Run the collision engine and report contacts to the container(s), assuming that
+    /// the collision models were already synchronized with the item positions.
+    void DetectCollisions();
+
+    /// Second part of Setup(): compute the offsets of the contact container and the totals,
+    /// once the contacts were added.
+    void SetupContacts();
+
+    /// Update the items concurrently with the collision detection, then update the
+    /// contacts (see SetPipelinedStep()). Returns false if not possible.
+    bool PipelinedCollisionsAndUpdate();
+
+  public:
+
     /// Class to be inherited by user and to use in SetCustomComputeCollisionCallback()
     class ChApi ChCustomComputeCollisionCallback {
       public:
@@ -626,8 +658,23 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Partition the bodies into islands, i.e. groups of bodies connected by links or contacts.
+    /// Fixed bodies do not belong to any island and do not connect islands. Bodies that fell asleep
+    /// together stay in the same island, since no contacts are created between sleeping bodies.
+    /// When sleeping is enabled, this is done at each step and islands sleep and wake up as a whole.
+    /// Islands are not solved separately: the solver always works on the whole system descriptor.
+    void ComputeIslands();
+
+    /// Return the number of islands found by the last call to ComputeIslands().
+    int GetNislands() const { return nislands; }
+
+    /// Return the island of the i-th body in the body list, as found by the last call to
+    /// ComputeIslands() (-1 for fixed bodies, and for bodies added after that call).
+    int GetBodyIsland(int i) const { return (i >= 0 && i < (int)body_island.size()) ? body_island[i] : -1; }
+
   private:
-    /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Put to sleep the islands whose bodies have all come to rest, and wake up all the
+    /// bodies of an island if some of them is moving.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case, also performs Setup()
     /// because the sleeping policy changed the totalDOFs and offsets.
@@ -822,6 +869,10 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    int nislands;                                      ///< number of islands found by ComputeIslands()
+    std::vector<int> body_island;                      ///< island of each body in the body list (-1 if fixed)
+    std::unordered_map<ChBody*, int> sleeping_island;  ///< island of each sleeping body when it fell asleep
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< the system descriptor
     std::shared_ptr<ChSolver> solver_speed;          ///< the solver for speed problem
     std::shared_ptr<ChSolver> solver_stab;           ///< the solver for position (stabilization) problem, if any
@@ -834,6 +885,8 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     double max_penetration_recovery_speed;  ///< limit for the speed of penetration recovery (positive, speed of exiting)
 
     int parallel_thread_number;  ///< used for multithreaded solver
+    bool pipelined_step;         ///< overlap collision detection and update in Integrate_Y()
+    bool pipelining;             ///< collision detection running, see PipelinedCollisionsAndUpdate()
 
     size_t stepcount;  ///< internal counter for steps
 
@@ -22,6 +22,8 @@
 
 namespace chrono {
 
+class ChVariables;
+
 /// Modes for constraint
 enum eChConstraintMode {
     CONSTRAINT_FREE = 0,        ///< the constraint does not enforce anything
@@ -307,6 +309,19 @@ class ChApi ChConstraint {
     /// Same as Build_Cq, but puts the _transposed_ jacobian row as a column.
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) = 0;
 
+    /// If this constraint acts on exactly two objects with 6 variables each (ex. two rigid
+    /// bodies), return true and the pointers to the two variables and to the storage of their
+    /// 1x6 jacobians [Cq_a], [Cq_b] and of the [Eq_a], [Eq_b] auxiliary vectors.
+    /// This is used to pack such constraints in a ChConstraintBatch. Default: false.
+    virtual bool GetTwoBodyJacobians(ChVariables*& var_a,
+                                     ChVariables*& var_b,
+                                     const double*& Cq_a,
+                                     const double*& Cq_b,
+                                     const double*& Eq_a,
+                                     const double*& Eq_b) {
+        return false;
+    }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(int moff) { offset = moff; }
 
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <immintrin.h>
+
+#include "chrono/ChConfig.h"
+#include "chrono/solver/ChConstraintBatch.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+bool ChConstraintBatch::Pack(const std::vector<ChConstraint*>& constraints) {
+    bool complete = true;
+
+    packed.clear();
+    for (auto c : constraints) {
+        if (!c->IsActive())
+            continue;
+        ChVariables* var_a;
+        ChVariables* var_b;
+        const double* Cq_a;
+        const double* Cq_b;
+        const double* Eq_a;
+        const double* Eq_b;
+        if (c->GetTwoBodyJacobians(var_a, var_b, Cq_a, Cq_b, Eq_a, Eq_b))
+            packed.push_back(c);
+        else
+            complete = false;
+    }
+    n = (int)packed.size();
+
+    // Padding constraints have null jacobians and act on the first variable
+    int nblocks = (n + 3) / 4;
+    jac.assign(nblocks * block_size, 0.0);
+    off_a.assign(nblocks * 4, 0);
+    off_b.assign(nblocks * 4, 0);
+
+    for (int i = 0; i < n; i++) {
+        ChVariables* var[2];
+        const double* Cq[2];
+        const double* Eq[2];
+        packed[i]->GetTwoBodyJacobians(var[0], var[1], Cq[0], Cq[1], Eq[0], Eq[1]);
+
+        double* J = &jac[(i / 4) * block_size + (i % 4)];
+        for (int j = 0; j < 2; j++) {
+            // Inactive variables are skipped, as in ChConstraintTwoBodies etc.
+            if (!var[j]->IsActive())
+                continue;
+            (j == 0 ? off_a : off_b)[i] = var[j]->GetOffset();
+            for (int k = 0; k < 6; k++) {
+                J[(CQ_A + 6 * j + k) * 4] = Cq[j][k];
+                J[(EQ_A + 6 * j + k) * 4] = Eq[j][k];
+            }
+        }
+    }
+
+    return complete;
+}
+
+void ChConstraintBatch::Clear() {
+    n = 0;
+    packed.clear();
+    jac.clear();
+    off_a.clear();
+    off_b.clear();
+}
+
+void ChConstraintBatch::Compute_Cq_q(const double* q, double* result) const {
+#if defined(CHRONO_AVX_2_0) && defined(CHRONO_HAS_FMA)
+    int nfull = n / 4;
+    for (int g = 0; g < (n + 3) / 4; g++) {
+        const double* J = &jac[g * block_size];
+        __m128i ia = _mm_loadu_si128((const __m128i*)&off_a[4 * g]);
+        __m128i ib = _mm_loadu_si128((const __m128i*)&off_b[4 * g]);
+        __m256d sa = _mm256_setzero_pd();
+        __m256d sb = _mm256_setzero_pd();
+        for (int k = 0; k < 6; k++) {
+            __m256d qa = _mm256_i32gather_pd(q + k, ia, 8);
+            __m256d qb = _mm256_i32gather_pd(q + k, ib, 8);
+            sa = _mm256_fmadd_pd(_mm256_loadu_pd(J + (CQ_A + k) * 4), qa, sa);
+            sb = _mm256_fmadd_pd(_mm256_loadu_pd(J + (CQ_B + k) * 4), qb, sb);
+        }
+        __m256d s = _mm256_add_pd(sa, sb);
+        if (g < nfull) {
+            _mm256_storeu_pd(result + 4 * g, s);
+        } else {
+            double tail[4];
+            _mm256_storeu_pd(tail, s);
+            for (int i = 4 * g; i < n; i++)
+                result[i] = tail[i - 4 * g];
+        }
+    }
+#else
+    for (int i = 0; i < n; i++)
+        result[i] = Compute_Cq_q(i, q);
+#endif
+}
+
+void ChConstraintBatch::Increment_q(double* q, const double* l) const {
+    // Constraints may share variables: increments are accumulated serially
+    for (int i = 0; i < n; i++)
+        Increment_q(i, q, l[i]);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHCONSTRAINTBATCH_H
+#define CHCONSTRAINTBATCH_H
+
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
+#include "chrono/solver/ChConstraint.h"
+
+namespace chrono {
+
+/// Packed storage of constraints acting on two objects with 6 variables each (ex. contacts
+/// and links between rigid bodies, see ChConstraint::GetTwoBodyJacobians()), with kernels that
+/// process these constraints without virtual calls.
+/// The jacobians [Cq_a], [Cq_b] and the auxiliary vectors [Eq_a], [Eq_b] are copied in blocks of
+/// 4 constraints, component by component, so that [Cq]*q is computed for 4 constraints at once
+/// with AVX2 (if available at build time; otherwise a scalar implementation is used).
+/// The kernels work on a vector 'q' with all the active variables of the system descriptor,
+/// at their offsets (see ChSystemDescriptor::FromVariablesToVector()).
+class ChApi ChConstraintBatch {
+  public:
+    ChConstraintBatch() : n(0) {}
+
+    /// Pack the active constraints of the list that act on two 6-DOF objects, in list order.
+    /// Jacobians and auxiliary data must be up to date (see ChConstraint::Update_auxiliary())
+    /// and the offsets of variables must be set. Returns true if all active constraints were packed.
+    bool Pack(const std::vector<ChConstraint*>& constraints);
+
+    /// Remove all constraints.
+    void Clear();
+
+    /// Number of packed constraints.
+    int GetNconstraints() const { return n; }
+
+    /// Access the i-th packed constraint.
+    ChConstraint* GetConstraint(int i) const { return packed[i]; }
+
+    /// Compute result[i] = [Cq_i]*q for all packed constraints.
+    void Compute_Cq_q(const double* q, double* result) const;
+
+    /// Compute q += [Eq_i]*l[i] for all packed constraints.
+    void Increment_q(double* q, const double* l) const;
+
+    /// Compute [Cq_i]*q for the i-th packed constraint.
+    double Compute_Cq_q(int i, const double* q) const {
+        const double* J = &jac[(i / 4) * block_size + (i % 4)];
+        const double* qa = q + off_a[i];
+        const double* qb = q + off_b[i];
+        double ret_a = 0;
+        double ret_b = 0;
+        for (int k = 0; k < 6; k++) {
+            ret_a += J[(CQ_A + k) * 4] * qa[k];
+            ret_b += J[(CQ_B + k) * 4] * qb[k];
+        }
+        return ret_a + ret_b;
+    }
+
+    /// Increment q += [Eq_i]*deltal for the i-th packed constraint.
+    void Increment_q(int i, double* q, const double deltal) const {
+        const double* J = &jac[(i / 4) * block_size + (i % 4)];
+        double* qa = q + off_a[i];
+        double* qb = q + off_b[i];
+        for (int k = 0; k < 6; k++)
+            qa[k] += J[(EQ_A + k) * 4] * deltal;
+        for (int k = 0; k < 6; k++)
+            qb[k] += J[(EQ_B + k) * 4] * deltal;
+    }
+
+  private:
+    // Rows of a block: each row holds one component for the 4 constraints of the block
+    enum { CQ_A = 0, CQ_B = 6, EQ_A = 12, EQ_B = 18, block_size = 24 * 4 };
+
+    int n;
+    std::vector<ChConstraint*> packed;
+    std::vector<double, aligned_allocator<double, 64>> jac;  ///< jacobians, in blocks of 4 constraints
+    std::vector<int, aligned_allocator<int, 64>> off_a;      ///< offsets of first variables (padded to 4)
+    std::vector<int, aligned_allocator<int, 64>> off_b;      ///< offsets of second variables (padded to 4)
+};
+
+}  // end namespace chrono
+
+#endif
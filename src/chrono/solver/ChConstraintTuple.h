@@ -63,6 +63,17 @@ class ChConstraintTuple_1vars {
 
     ChVariables* GetVariables() { return variables; }
 
+    /// Access the block of variables and its jacobian, if of size 6 (ex. a rigid body).
+    /// Returns false otherwise. See ChConstraint::GetTwoBodyJacobians().
+    bool GetBlock6(ChVariables*& var, const double*& mCq, const double*& mEq) {
+        if (T::nvars1 != 6)
+            return false;
+        var = variables;
+        mCq = Cq.GetAddress();
+        mEq = Eq.GetAddress();
+        return true;
+    }
+
     void SetVariables(T& m_tuple_carrier) {
         if (!m_tuple_carrier.GetVariables1()) {
             throw ChException("ERROR. SetVariables() getting null pointer. \n");
@@ -182,6 +193,9 @@ class ChConstraintTuple_2vars {
     ChVariables* GetVariables_1() { return variables_1; }
     ChVariables* GetVariables_2() { return variables_2; }
 
+    /// Not a single block of variables: returns false. See ChConstraint::GetTwoBodyJacobians().
+    bool GetBlock6(ChVariables*& var, const double*& mCq, const double*& mEq) { return false; }
+
     void SetVariables(T& m_tuple_carrier) {
         if (!m_tuple_carrier.GetVariables1() || !m_tuple_carrier.GetVariables2()) {
             throw ChException("ERROR. SetVariables() getting null pointer. \n");
@@ -347,6 +361,9 @@ class ChConstraintTuple_3vars {
     ChVariables* GetVariables_2() { return variables_2; }
     ChVariables* GetVariables_3() { return variables_3; }
 
+    /// Not a single block of variables: returns false. See ChConstraint::GetTwoBodyJacobians().
+    bool GetBlock6(ChVariables*& var, const double*& mCq, const double*& mEq) { return false; }
+
     void SetVariables(T& m_tuple_carrier) {
         if (!m_tuple_carrier.GetVariables1() || !m_tuple_carrier.GetVariables2() || !m_tuple_carrier.GetVariables3()) {
             throw ChException("ERROR. SetVariables() getting null pointer. \n");
@@ -559,6 +576,9 @@ class ChConstraintTuple_4vars {
     ChVariables* GetVariables_3() { return variables_3; }
     ChVariables* GetVariables_4() { return variables_4; }
 
+    /// Not a single block of variables: returns false. See ChConstraint::GetTwoBodyJacobians().
+    bool GetBlock6(ChVariables*& var, const double*& mCq, const double*& mEq) { return false; }
+
     void SetVariables(T& m_tuple_carrier) {
         if (!m_tuple_carrier.GetVariables1() || !m_tuple_carrier.GetVariables2() || !m_tuple_carrier.GetVariables3() || !m_tuple_carrier.GetVariables4() ) {
             throw ChException("ERROR. SetVariables() getting null pointer. \n");
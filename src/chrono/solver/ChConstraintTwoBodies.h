@@ -114,6 +114,21 @@ class ChApi ChConstraintTwoBodies : public ChConstraintTwo {
     virtual void Build_Cq(ChSparseMatrix& storage, int insrow) override;
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) override;
 
+    virtual bool GetTwoBodyJacobians(ChVariables*& var_a,
+                                     ChVariables*& var_b,
+                                     const double*& mCq_a,
+                                     const double*& mCq_b,
+                                     const double*& mEq_a,
+                                     const double*& mEq_b) override {
+        var_a = variables_a;
+        var_b = variables_b;
+        mCq_a = Cq_a.GetAddress();
+        mCq_b = Cq_b.GetAddress();
+        mEq_a = Eq_a.GetAddress();
+        mEq_b = Eq_b.GetAddress();
+        return true;
+    }
+
     /// Method to allow deserializing a persistent binary archive (ex: a file)
     /// into transient data.
     virtual void StreamIN(ChStreamInBinary& mstream) override;
@@ -123,6 +123,15 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.Build_CqT(storage, inscol);
         tuple_b.Build_CqT(storage, inscol);
     }
+
+    virtual bool GetTwoBodyJacobians(ChVariables*& var_a,
+                                     ChVariables*& var_b,
+                                     const double*& Cq_a,
+                                     const double*& Cq_b,
+                                     const double*& Eq_a,
+                                     const double*& Eq_b) override {
+        return tuple_a.GetBlock6(var_a, Cq_a, Eq_a) && tuple_b.GetBlock6(var_b, Cq_b, Eq_b);
+    }
 };
 
 }  // end namespace chrono
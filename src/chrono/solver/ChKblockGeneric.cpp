@@ -19,11 +19,12 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChKblockGeneric)
 
-ChKblockGeneric::ChKblockGeneric(std::vector<ChVariables*> mvariables) : K(NULL) {
+ChKblockGeneric::ChKblockGeneric(std::vector<ChVariables*> mvariables) : K(NULL), provider(NULL), K_stale(true) {
     SetVariables(mvariables);
 }
 
-ChKblockGeneric::ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB) : K(NULL) {
+ChKblockGeneric::ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB)
+    : K(NULL), provider(NULL), K_stale(true) {
     std::vector<ChVariables*> mvars;
     mvars.push_back(mvariableA);
     mvars.push_back(mvariableB);
@@ -45,15 +46,17 @@ ChKblockGeneric& ChKblockGeneric::operator=(const ChKblockGeneric& other) {
 
     this->variables = other.variables;
 
-    if (other.K) {
-        if (K == 0)
-            K = new ChMatrixDynamic<double>;
+    // The provider is owned by the element of the other block: the copy stores its K matrix
+    // (zero if not computed yet by the provider) until its owner calls SetMatrixProvider() again.
+    this->provider = NULL;
+    this->K_stale = true;
+
+    if (K == 0)
+        K = new ChMatrixDynamic<double>;
+    if (other.K && !(other.provider && other.K_stale))
         K->CopyFromMatrix(*other.K);
-    } else {
-        if (K)
-            delete K;
-        K = NULL;
-    }
+    else
+        K->Reset(GetMatrixSize(), GetMatrixSize());
 
     return *this;
 }
@@ -68,17 +71,39 @@ void ChKblockGeneric::SetVariables(std::vector<ChVariables*> mvariables) {
         delete K;
     K = 0;
 
+    // reallocate the K matrix
+    K = new ChMatrixDynamic<double>(GetMatrixSize(), GetMatrixSize());
+    K_stale = true;
+}
+
+void ChKblockGeneric::SetMatrixProvider(MatrixProvider* mprovider) {
+    provider = mprovider;
+    K_stale = true;
+}
+
+const ChMatrix<double>& ChKblockGeneric::GetMatrix() const {
+    assert(K);
+    if (provider && K_stale) {
+        provider->ComputeMatrix(*K);
+        K_stale = false;
+    }
+    return *K;
+}
+
+int ChKblockGeneric::GetMatrixSize() const {
     int msize = 0;
     for (unsigned int iv = 0; iv < variables.size(); iv++)
         msize += variables[iv]->Get_ndof();
-
-    // reallocate the K matrix
-    K = new ChMatrixDynamic<double>(msize, msize);
+    return msize;
 }
 
 void ChKblockGeneric::MultiplyAndAdd(ChMatrix<double>& result, const ChMatrix<double>& vect) const {
-    assert(K);
+    MultiplyAndAdd(GetMatrix(), result, vect);
+}
 
+void ChKblockGeneric::MultiplyAndAdd(const ChMatrix<double>& Kmat,
+                                     ChMatrix<double>& result,
+                                     const ChMatrix<double>& vect) const {
     int kio = 0;
     for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
         int io = this->GetVariableN(iv)->GetOffset();
@@ -95,7 +120,7 @@ void ChKblockGeneric::MultiplyAndAdd(ChMatrix<double>& result, const ChMatrix<do
                     for (int r = 0; r < in; r++) {
                         double tot = 0;
                         for (int c = 0; c < jn; c++) {
-                            tot += (*this->K)(kio + r, kjo + c) * vect(jo + c);
+                            tot += Kmat(kio + r, kjo + c) * vect(jo + c);
                         }
                         result(io + r) += tot;
                     }
@@ -111,7 +136,10 @@ void ChKblockGeneric::MultiplyAndAdd(ChMatrix<double>& result, const ChMatrix<do
 
 void ChKblockGeneric::DiagonalAdd(ChMatrix<double>& result) {
     assert(result.GetColumns() == 1);
+    DiagonalAdd(GetMatrix(), result);
+}
 
+void ChKblockGeneric::DiagonalAdd(const ChMatrix<double>& Kmat, ChMatrix<double>& result) const {
     int kio = 0;
     for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
         int io = this->GetVariableN(iv)->GetOffset();
@@ -119,8 +147,7 @@ void ChKblockGeneric::DiagonalAdd(ChMatrix<double>& result) {
 
         if (this->GetVariableN(iv)->IsActive()) {
             for (int r = 0; r < in; r++) {
-                // GetLog() << "Summing" << result(io+r) << " to " << (*this->K)(kio+r,kio+r) << "\n";
-                result(io + r) += (*this->K)(kio + r, kio + r);
+                result(io + r) += Kmat(kio + r, kio + r);
             }
         }
         kio += in;
@@ -131,6 +158,10 @@ void ChKblockGeneric::Build_K(ChSparseMatrix& storage, bool add) {
     if (!K)
         return;
 
+    Build_K(GetMatrix(), storage, add);
+}
+
+void ChKblockGeneric::Build_K(const ChMatrix<double>& Kmat, ChSparseMatrix& storage, bool add) const {
     int kio = 0;
     for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
         int io = this->GetVariableN(iv)->GetOffset();
@@ -144,9 +175,9 @@ void ChKblockGeneric::Build_K(ChSparseMatrix& storage, bool add) {
 
                 if (this->GetVariableN(jv)->IsActive()) {
                     if (add)
-                        storage.PasteSumClippedMatrix(*K, kio, kjo, in, jn, io, jo);
+                        storage.PasteSumClippedMatrix(Kmat, kio, kjo, in, jn, io, jo);
                     else
-                        storage.PasteClippedMatrix(*K, kio, kjo, in, jn, io, jo);
+                        storage.PasteClippedMatrix(Kmat, kio, kjo, in, jn, io, jo);
                 }
 
                 kjo += jn;
@@ -37,22 +37,41 @@ namespace chrono {
 /// jacobians Cq are not really assembled in large matrices, so to
 /// exploit sparsity.
 
+/// The K matrix can also be computed on demand (matrix-free mode, see SetMatrixProvider()): in this case
+/// it is evaluated by the object that owns the block when the solver first uses it.
+
 class ChApi ChKblockGeneric : public ChKblock {
 
     // Tag needed for class factory in archive (de)serialization:
     CH_FACTORY_TAG(ChKblockGeneric)
 
+  public:
+    /// Interface for the objects that compute the K matrix of a block in matrix-free mode.
+    /// The matrix may be requested concurrently for different blocks, from different threads.
+    class ChApi MatrixProvider {
+      public:
+        virtual ~MatrixProvider() {}
+
+        /// Compute the K matrix of the block in K (already sized as the block).
+        virtual void ComputeMatrix(ChMatrix<double>& K) = 0;
+    };
+
   private:
     ChMatrixDynamic<double>* K;
     std::vector<ChVariables*> variables;
+    MatrixProvider* provider;
+    mutable bool K_stale;  ///< in matrix-free mode, K must be computed by the provider before use
 
   public:
-    ChKblockGeneric() : K(NULL) {}
+    ChKblockGeneric() : K(NULL), provider(NULL), K_stale(true) {}
     ChKblockGeneric(std::vector<ChVariables*> mvariables);
     ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB);
+    ChKblockGeneric(const ChKblockGeneric& other) : K(NULL), provider(NULL), K_stale(true) { *this = other; }
     virtual ~ChKblockGeneric();
 
-    /// Assignment operator: copy from other object
+    /// Assignment operator: copy from other object.
+    /// The matrix provider is not copied (it refers to the owner of the other block): the copy
+    /// always stores its K matrix, and its owner must call SetMatrixProvider(this) to be matrix-free.
     ChKblockGeneric& operator=(const ChKblockGeneric& other);
 
     /// Set references to the constrained objects, each of ChVariables type,
@@ -66,8 +85,28 @@ class ChApi ChKblockGeneric : public ChKblock {
     ChVariables* GetVariableN(unsigned int m_var) const { return variables[m_var]; }
 
     /// Access the K stiffness matrix as a single block,
-    /// referring only to the referenced ChVariable objects
-    virtual ChMatrix<double>* Get_K() override { return K; }
+    /// referring only to the referenced ChVariable objects.
+    /// Returns null in matrix-free mode.
+    virtual ChMatrix<double>* Get_K() override { return provider ? NULL : K; }
+
+    /// Enable the matrix-free mode, if a provider is given: the K matrix is not loaded by its owner, but
+    /// computed by the provider the first time it is needed after InvalidateMatrix() (in MultiplyAndAdd(),
+    /// DiagonalAdd() or Build_K()), then reused by the following products. Since the solver processes blocks
+    /// in parallel, so is the evaluation of their matrices. Pass null to go back to a loaded K matrix.
+    void SetMatrixProvider(MatrixProvider* mprovider);
+
+    /// In matrix-free mode, discard the K matrix computed by the provider: it will be computed again when
+    /// needed. To be called by the owner each time the matrix changes (e.g. at each KRM load).
+    void InvalidateMatrix() { K_stale = true; }
+
+    /// Return the object that computes the K matrix in matrix-free mode (null if the matrix is stored).
+    MatrixProvider* GetMatrixProvider() const { return provider; }
+
+    /// Return true if the K matrix is not stored, but computed on demand.
+    bool IsMatrixFree() const { return provider != NULL; }
+
+    /// Return the number of rows (and columns) of the K matrix.
+    int GetMatrixSize() const;
 
     /// Computes the product of the corresponding blocks in the
     /// system matrix (ie. the K matrix blocks) by 'vect', and add to 'result'.
@@ -88,6 +127,14 @@ class ChApi ChKblockGeneric : public ChKblock {
     /// Most solvers do not need this: the sparse 'storage' matrix is used for testing, for
     /// direct solvers, for dumping full matrix to Matlab for checks, etc.
     virtual void Build_K(ChSparseMatrix& storage, bool add) override;
+
+  private:
+    /// Return the K matrix, computing it first if needed (matrix-free mode).
+    const ChMatrix<double>& GetMatrix() const;
+
+    void MultiplyAndAdd(const ChMatrix<double>& Kmat, ChMatrix<double>& result, const ChMatrix<double>& vect) const;
+    void DiagonalAdd(const ChMatrix<double>& Kmat, ChMatrix<double>& result) const;
+    void Build_K(const ChMatrix<double>& Kmat, ChSparseMatrix& storage, bool add) const;
 };
 
 }  // end namespace chrono
@@ -31,6 +31,8 @@ class my_enum_mappers : public ChSolver {
     CH_ENUM_VAL(Type::APGD);
     CH_ENUM_VAL(Type::MINRES);
     CH_ENUM_VAL(Type::SOLVER_DEM);
+    CH_ENUM_VAL(Type::SOR_COLORED);
+    CH_ENUM_VAL(Type::GMRES);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
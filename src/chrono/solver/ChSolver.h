@@ -58,6 +58,8 @@ class ChApi ChSolver {
           APGD,
           MINRES,
           SOLVER_DEM,
+          SOR_COLORED,
+          GMRES,
           CUSTOM,
       };
 
@@ -85,6 +85,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack the constraints for the batched ShurComplementProduct(), if enabled
+    sysd.UpdateConstraintBatch();
+
     double L, t;
     double theta;
     double thetaNew;
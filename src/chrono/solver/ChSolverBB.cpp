@@ -73,6 +73,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd  ///< system description with
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack the constraints for the batched ShurComplementProduct(), if enabled
+    sysd.UpdateConstraintBatch();
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used for the fixed point phase and/or by preconditioner.
     int j_friction_comp = 0;
@@ -0,0 +1,405 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/solver/ChSolverGMRES.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverGMRES)
+
+// Dummy matrix that collects the elements falling in the diagonal blocks of the variables.
+class _BlockDiagonalCollector : public ChSparseMatrix {
+  public:
+    _BlockDiagonalCollector(int n,
+                            int nq,
+                            const int* row_block,
+                            const int* block_rows,
+                            const int* block_values,
+                            double* values)
+        : ChSparseMatrix(n, n),
+          nq(nq),
+          row_block(row_block),
+          block_rows(block_rows),
+          block_values(block_values),
+          values(values) {}
+
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        if (insrow >= nq || inscol >= nq)
+            return;
+        int b = row_block[insrow];
+        if (row_block[inscol] != b)
+            return;
+        int start = block_rows[b];
+        int size = block_rows[b + 1] - start;
+        double& val = values[block_values[b] + (insrow - start) * size + (inscol - start)];
+        if (overwrite)
+            val = insval;
+        else
+            val += insval;
+    }
+    virtual double GetElement(int row, int col) const override { return 0; }
+    virtual void Reset(int row, int col, int nonzeros = 0) override {}
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override { return false; }
+
+  private:
+    int nq;
+    const int* row_block;
+    const int* block_rows;
+    const int* block_values;
+    double* values;
+};
+
+// Invert in place a dense n x n matrix (row-major), with Gauss-Jordan elimination and partial pivoting.
+// Return false if the matrix is singular.
+static bool InvertBlock(double* A, int n) {
+    std::vector<double> M(A, A + n * n);
+    for (int i = 0; i < n * n; i++)
+        A[i] = 0;
+    for (int i = 0; i < n; i++)
+        A[i * n + i] = 1;
+
+    for (int k = 0; k < n; k++) {
+        // pivot row
+        int p = k;
+        for (int i = k + 1; i < n; i++) {
+            if (std::abs(M[i * n + k]) > std::abs(M[p * n + k]))
+                p = i;
+        }
+        if (std::abs(M[p * n + k]) < 1e-300)
+            return false;
+        if (p != k) {
+            for (int j = 0; j < n; j++) {
+                std::swap(M[k * n + j], M[p * n + j]);
+                std::swap(A[k * n + j], A[p * n + j]);
+            }
+        }
+
+        double inv_pivot = 1.0 / M[k * n + k];
+        for (int j = 0; j < n; j++) {
+            M[k * n + j] *= inv_pivot;
+            A[k * n + j] *= inv_pivot;
+        }
+        for (int i = 0; i < n; i++) {
+            double f = M[i * n + k];
+            if (i == k || f == 0)
+                continue;
+            for (int j = 0; j < n; j++) {
+                M[i * n + j] -= f * M[k * n + j];
+                A[i * n + j] -= f * A[k * n + j];
+            }
+        }
+    }
+
+    return true;
+}
+
+ChSolverGMRES::ChSolverGMRES(int mmax_iters, bool mwarm_start, double mtolerance)
+    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance),
+      restart(50),
+      rel_tolerance(0),
+      preconditioner(Preconditioner::DIAGONAL),
+      residual(0) {}
+
+void ChSolverGMRES::SetupPreconditioner(ChSystemDescriptor& sysd, int nq, int nx) {
+    // Inverse of the diagonal of Z. For constraints, the diagonal is 0 if not compliant:
+    // do not scale these rows, assuming the dot product of jacobians is already about 1.
+    if (preconditioner == Preconditioner::BLOCK_JACOBI) {
+        // the diagonal of the variable rows is not used: only add the constraint terms
+        mDi.Reset(nx, 1);
+        for (auto con : sysd.GetConstraintsList()) {
+            if (con->IsActive())
+                mDi(nq + con->GetOffset()) = -con->Get_cfm_i();
+        }
+    } else {
+        sysd.BuildDiagonalVector(mDi);
+    }
+    for (int i = 0; i < nx; i++) {
+        if (std::abs(mDi(i)) > 1e-9)
+            mDi(i) = 1.0 / mDi(i);
+        else
+            mDi(i) = 1.0;
+    }
+
+    if (preconditioner != Preconditioner::BLOCK_JACOBI)
+        return;
+
+    // One diagonal block per active variable (the active variables have contiguous offsets)
+    block_rows.clear();
+    block_values.clear();
+    row_block.resize(nq);
+    int nvalues = 0;
+    for (auto var : sysd.GetVariablesList()) {
+        if (!var->IsActive())
+            continue;
+        int b = (int)block_rows.size();
+        int n = var->Get_ndof();
+        block_rows.push_back(var->GetOffset());
+        block_values.push_back(nvalues);
+        for (int i = 0; i < n; i++)
+            row_block[var->GetOffset() + i] = b;
+        nvalues += n * n;
+    }
+    int nblocks = (int)block_rows.size();
+    block_rows.push_back(nq);
+    block_inv.assign(nvalues, 0.0);
+
+    // Mass terms
+    _BlockDiagonalCollector collector(nx, nq, row_block.data(), block_rows.data(), block_values.data(),
+                                      block_inv.data());
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive())
+            var->Build_M(collector, var->GetOffset(), var->GetOffset(), sysd.GetMassFactor());
+    }
+
+    // Stiffness terms (computed on the fly for matrix-free blocks, so split among the threads,
+    // each collecting its terms in its own buffer)
+    std::vector<ChKblock*>& kblocks = sysd.GetKblocksList();
+    int nkblocks = (int)kblocks.size();
+    int nthreads = ChMax(1, ChMin(sysd.GetNumThreads(), nkblocks));
+    std::vector<std::vector<double>> buffers(nthreads);
+#pragma omp parallel num_threads(nthreads)
+    {
+        int tid = CHOMPfunctions::GetThreadNum();
+        buffers[tid].assign(nvalues, 0.0);
+        _BlockDiagonalCollector tcollector(nx, nq, row_block.data(), block_rows.data(), block_values.data(),
+                                           buffers[tid].data());
+#pragma omp for schedule(static)
+        for (int ik = 0; ik < nkblocks; ik++)
+            kblocks[ik]->Build_K(tcollector, true);
+    }
+    for (int t = 0; t < nthreads; t++) {
+        for (int i = 0; i < nvalues; i++)
+            block_inv[i] += buffers[t][i];
+    }
+
+    // Invert the blocks (singular blocks fall back to the inverse diagonal)
+    for (int b = 0; b < nblocks; b++) {
+        int n = block_rows[b + 1] - block_rows[b];
+        double* A = &block_inv[block_values[b]];
+        std::vector<double> diag(n);
+        for (int i = 0; i < n; i++)
+            diag[i] = A[i * n + i];
+        if (InvertBlock(A, n))
+            continue;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++)
+                A[i * n + j] = 0;
+            A[i * n + i] = (std::abs(diag[i]) > 1e-9) ? 1.0 / diag[i] : 1.0;
+        }
+    }
+}
+
+void ChSolverGMRES::ApplyPreconditioner(const ChMatrix<>& v, ChMatrix<>& z) const {
+    int nx = v.GetRows();
+
+    switch (preconditioner) {
+        case Preconditioner::NONE:
+            z.CopyFromMatrix(v);
+            break;
+        case Preconditioner::DIAGONAL:
+            for (int i = 0; i < nx; i++)
+                z(i) = mDi(i) * v(i);
+            break;
+        case Preconditioner::BLOCK_JACOBI: {
+            int nblocks = (int)block_rows.size() - 1;
+            for (int b = 0; b < nblocks; b++) {
+                int start = block_rows[b];
+                int n = block_rows[b + 1] - start;
+                const double* A = &block_inv[block_values[b]];
+                for (int i = 0; i < n; i++) {
+                    double tot = 0;
+                    for (int j = 0; j < n; j++)
+                        tot += A[i * n + j] * v(start + j);
+                    z(start + i) = tot;
+                }
+            }
+            int nq = block_rows.back();
+            for (int i = nq; i < nx; i++)
+                z(i) = mDi(i) * v(i);
+            break;
+        }
+    }
+}
+
+double ChSolverGMRES::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                            ) {
+    tot_iterations = 0;
+    residual = 0;
+
+    int nq = sysd.CountActiveVariables();
+    int nc = sysd.CountActiveConstraints();
+    int nx = nq + nc;  // total scalar unknowns, in x vector for full KKT system Z*x-d=0
+
+    if (nx == 0)
+        return 0;
+
+    if (verbose)
+        GetLog() << "\n----- GMRES, n.vars nx=" << nx << "  max.iters=" << max_iterations << "  restart=" << restart
+                 << "\n";
+
+    SetupPreconditioner(sysd, nq, nx);
+
+    // Initialize the x vector of unknowns x ={q; -l} and the d vector with {f, -b}
+    ChMatrixDynamic<> x(nx, 1);
+    if (warm_start)
+        sysd.FromUnknownsToVector(x);
+    ChMatrixDynamic<> d(nx, 1);
+    sysd.BuildDiVector(d);
+
+    double tol = ChMax(rel_tolerance * d.NormTwo(), tolerance);
+
+    // Krylov basis and Hessenberg matrix (reduced to triangular form by Givens rotations)
+    int m = ChMin(restart, nx);
+    std::vector<ChMatrixDynamic<>> V(m + 1, ChMatrixDynamic<>(nx, 1));
+    ChMatrixDynamic<> H(m + 1, m);
+    ChMatrixDynamic<> cs(m, 1);
+    ChMatrixDynamic<> sn(m, 1);
+    ChMatrixDynamic<> g(m + 1, 1);
+    ChMatrixDynamic<> y(m, 1);
+    ChMatrixDynamic<> r(nx, 1);
+    ChMatrixDynamic<> w(nx, 1);
+    ChMatrixDynamic<> z(nx, 1);
+
+    while (true) {
+        // r = d - Z*x
+        sysd.SystemProduct(r, &x);
+        r.MatrNeg();
+        r.MatrInc(d);
+
+        residual = r.NormTwo();
+        if (residual <= tol || tot_iterations >= max_iterations)
+            break;
+
+        V[0].CopyFromMatrix(r);
+        V[0].MatrScale(1.0 / residual);
+        g.FillElem(0);
+        g(0) = residual;
+
+        // Arnoldi iterations
+        int k = 0;
+        while (k < m && tot_iterations < max_iterations) {
+            // w = Z * P^-1 * v_k
+            ApplyPreconditioner(V[k], z);
+            sysd.SystemProduct(w, &z);
+
+            // modified Gram-Schmidt
+            for (int i = 0; i <= k; i++) {
+                H(i, k) = ChMatrix<>::MatrDot(w, V[i]);
+                for (int j = 0; j < nx; j++)
+                    w(j) -= H(i, k) * V[i](j);
+            }
+            double hnext = w.NormTwo();
+            H(k + 1, k) = hnext;
+            if (hnext > 0) {
+                V[k + 1].CopyFromMatrix(w);
+                V[k + 1].MatrScale(1.0 / hnext);
+            }
+
+            // apply the previous rotations to the new column, then compute the rotation that
+            // eliminates H(k+1,k)
+            for (int i = 0; i < k; i++) {
+                double tmp = cs(i) * H(i, k) + sn(i) * H(i + 1, k);
+                H(i + 1, k) = -sn(i) * H(i, k) + cs(i) * H(i + 1, k);
+                H(i, k) = tmp;
+            }
+            double den = std::sqrt(H(k, k) * H(k, k) + hnext * hnext);
+            cs(k) = (den > 0) ? H(k, k) / den : 1.0;
+            sn(k) = (den > 0) ? hnext / den : 0.0;
+            H(k, k) = den;
+            H(k + 1, k) = 0;
+            g(k + 1) = -sn(k) * g(k);
+            g(k) = cs(k) * g(k);
+
+            k++;
+            tot_iterations++;
+            residual = std::abs(g(k));
+
+            if (verbose)
+                GetLog() << "  iter=" << tot_iterations << "  |r|=" << residual << "\n";
+            if (record_violation_history)
+                AtIterationEnd(residual, 0.0, tot_iterations - 1);
+
+            if (residual <= tol || hnext == 0)
+                break;
+        }
+
+        // Solve the triangular system H*y = g, then update x = x + P^-1 * V * y
+        for (int i = k - 1; i >= 0; i--) {
+            double tot = g(i);
+            for (int j = i + 1; j < k; j++)
+                tot -= H(i, j) * y(j);
+            y(i) = (H(i, i) != 0) ? tot / H(i, i) : 0.0;
+        }
+        w.FillElem(0);
+        for (int i = 0; i < k; i++) {
+            for (int j = 0; j < nx; j++)
+                w(j) += y(i) * V[i](j);
+        }
+        ApplyPreconditioner(w, z);
+        x.MatrInc(z);
+
+        // stagnation (the Krylov space does not grow)
+        if (k == 0)
+            break;
+    }
+
+    // After having solved for unknowns x={q;-l}, now copy those values from x vector to
+    // the q values in ChVariable items and to l values in ChConstraint items
+    sysd.FromVectorToUnknowns(x);
+
+    if (verbose)
+        GetLog() << "GMRES residual: " << residual << "  iterations: " << tot_iterations << " ---\n";
+
+    return residual;
+}
+
+// Trick to avoid putting the following mapper macro inside the class definition in .h file:
+// enclose macros in local 'my_gmres_enum_mappers', just to avoid avoiding cluttering of the parent class.
+class my_gmres_enum_mappers : public ChSolverGMRES {
+  public:
+    CH_ENUM_MAPPER_BEGIN(Preconditioner);
+    CH_ENUM_VAL(Preconditioner::NONE);
+    CH_ENUM_VAL(Preconditioner::DIAGONAL);
+    CH_ENUM_VAL(Preconditioner::BLOCK_JACOBI);
+    CH_ENUM_MAPPER_END(Preconditioner);
+};
+
+void ChSolverGMRES::ArchiveOUT(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChSolverGMRES>();
+    // serialize parent class
+    ChIterativeSolver::ArchiveOUT(marchive);
+    // serialize all member data:
+    my_gmres_enum_mappers::Preconditioner_mapper mapper;
+    marchive << CHNVP(restart);
+    marchive << CHNVP(rel_tolerance);
+    marchive << CHNVP(mapper(preconditioner), "preconditioner");
+}
+
+void ChSolverGMRES::ArchiveIN(ChArchiveIn& marchive) {
+    // version number
+    int version = marchive.VersionRead<ChSolverGMRES>();
+    // deserialize parent class
+    ChIterativeSolver::ArchiveIN(marchive);
+    // stream in all member data:
+    my_gmres_enum_mappers::Preconditioner_mapper mapper;
+    marchive >> CHNVP(restart);
+    marchive >> CHNVP(rel_tolerance);
+    marchive >> CHNVP(mapper(preconditioner), "preconditioner");
+}
+
+}  // end namespace chrono
@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVERGMRES_H
+#define CHSOLVERGMRES_H
+
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolver.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// An iterative solver based on the restarted GMRES Krylov method, with right preconditioning.
+/// It solves the linear problem Z*x = d, where the KKT matrix
+///
+///  | M+K  Cq'|*| q|-| f|=|0|
+///  | Cq   E  | |-l| |-b| |0|
+///
+/// is never assembled: only products Z*x are performed (see ChSystemDescriptor::SystemProduct()).
+/// Unlike MINRES, GMRES does not require Z to be symmetric, so it also supports non-symmetric
+/// stiffness blocks (ex. follower loads, non-symmetric tangent stiffness of some materials).
+/// Besides the blocks of Z, the memory needed by the Newton iterations of implicit integrators
+/// such as ChTimestepperHHT scales with the number of unknowns: the Krylov basis (restart+1
+/// vectors) and the preconditioner. With FEA meshes in matrix-free mode (see ChMesh::SetMatrixFree()),
+/// the element matrices are evaluated in parallel by the first product.
+/// The preconditioner is also built without assembling Z:
+/// - DIAGONAL: inverse of the diagonal of Z;
+/// - BLOCK_JACOBI: inverse of the diagonal blocks of Z, one per ChVariables object (ex. the
+///   3x3 or 9x9 blocks of the nodes of a FEA mesh), which also accounts for the coupling
+///   between the DOFs of a node.
+/// The constraint rows are scaled by the inverse of their compliance, if any, or not scaled.
+/// Only linear problems are solved (all constraints are treated as bilateral).
+
+class ChApi ChSolverGMRES : public ChIterativeSolver {
+
+    // Tag needed for class factory in archive (de)serialization:
+    CH_FACTORY_TAG(ChSolverGMRES)
+
+  public:
+    /// Available preconditioners.
+    enum class Preconditioner {
+        NONE,         ///< no preconditioning
+        DIAGONAL,     ///< inverse of the diagonal of Z
+        BLOCK_JACOBI  ///< inverse of the diagonal blocks of Z, one per variable
+    };
+
+  protected:
+    int restart;                    ///< number of iterations between restarts
+    double rel_tolerance;           ///< tolerance on the residual, relative to the norm of d
+    Preconditioner preconditioner;  ///< type of preconditioner
+    double residual;                ///< norm of the residual at the end of the last solve
+
+    // Preconditioner data (inverse of the diagonal, or of the diagonal blocks)
+    ChMatrixDynamic<> mDi;          ///< inverse of the diagonal (DIAGONAL, and constraint rows of BLOCK_JACOBI)
+    std::vector<int> block_rows;    ///< first row of each diagonal block
+    std::vector<int> block_values;  ///< start of the values of each diagonal block (row-major)
+    std::vector<double> block_inv;  ///< inverses of the diagonal blocks
+    std::vector<int> row_block;     ///< block of each variable row
+
+  public:
+    ChSolverGMRES(int mmax_iters = 200,       ///< max.number of iterations
+                  bool mwarm_start = false,  ///< uses warm start?
+                  double mtolerance = 0.0    ///< tolerance for termination criterion
+                  );
+
+    virtual ~ChSolverGMRES() {}
+
+    /// Return type of the solver.
+    virtual Type GetType() const override { return Type::GMRES; }
+
+    /// Performs the solution of the problem.
+    /// \return  the norm of the residual |d - Z*x| after termination (see GetResidual()).
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Set the number of iterations between restarts of GMRES (default: 50).
+    /// The memory used by the solver is (restart + 1) vectors of unknowns.
+    void SetRestart(int mrestart) { restart = (mrestart < 1) ? 1 : mrestart; }
+    int GetRestart() const { return restart; }
+
+    /// Set the tolerance on the norm of the residual, relative to the norm of the known term d
+    /// (default: 0). The iteration stops when |d - Z*x| < max(rel_tolerance*|d|, tolerance).
+    void SetRelTolerance(double mrt) { rel_tolerance = mrt; }
+    double GetRelTolerance() const { return rel_tolerance; }
+
+    /// Set the type of preconditioner (default: DIAGONAL).
+    void SetPreconditioner(Preconditioner mp) { preconditioner = mp; }
+    Preconditioner GetPreconditioner() const { return preconditioner; }
+
+    /// Return the norm of the residual |d - Z*x| at the end of the last solve.
+    double GetResidual() const { return residual; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOUT(ChArchiveOut& marchive) override;
+
+    /// Method to allow de serialization of transient data from archives.
+    virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    void SetupPreconditioner(ChSystemDescriptor& sysd, int nq, int nx);
+    void ApplyPreconditioner(const ChMatrix<>& v, ChMatrix<>& z) const;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -58,6 +58,9 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack the constraints for the batched ShurComplementProduct(), if enabled
+    sysd.UpdateConstraintBatch();
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used as diagonal preconditioner.
     int j_friction_comp = 0;
@@ -73,6 +73,25 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
             mconstraints[ic]->Set_l_i(0.);
     }
 
+    // If all active constraints can be packed in the constraint batch, iterate with the batched
+    // kernels over a packed vector of variables (the ib-th active constraint is the ib-th packed one).
+    const ChConstraintBatch& batch = sysd.GetConstraintBatch();
+    bool batched = sysd.UpdateConstraintBatch();
+    ChMatrixDynamic<> qpacked;
+    if (batched)
+        sysd.FromVariablesToVector(qpacked, true);
+    double* q = qpacked.GetAddress();
+
+    auto Compute_Cq_q = [&](unsigned int ic, int ib) {
+        return batched ? batch.Compute_Cq_q(ib, q) : mconstraints[ic]->Compute_Cq_q();
+    };
+    auto Increment_q = [&](unsigned int ic, int ib, double deltal) {
+        if (batched)
+            batch.Increment_q(ib, q, deltal);
+        else
+            mconstraints[ic]->Increment_q(deltal);
+    };
+
     // 4)  Perform the iteration loops
     //
 
@@ -83,12 +102,13 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
         maxviolation = 0;
         maxdeltalambda = 0;
         i_friction_comp = 0;
+        int ib = 0;
 
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
             // skip computations if constraint not active.
             if (mconstraints[ic]->IsActive()) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                double mresidual = Compute_Cq_q(ic, ib) + mconstraints[ic]->Get_b_i() +
                                    mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
@@ -125,9 +145,9 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
                         double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
                         double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
                         double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->Increment_q(true_delta_0);
-                        mconstraints[ic - 1]->Increment_q(true_delta_1);
-                        mconstraints[ic - 0]->Increment_q(true_delta_2);
+                        Increment_q(ic - 2, ib - 2, true_delta_0);
+                        Increment_q(ic - 1, ib - 1, true_delta_1);
+                        Increment_q(ic - 0, ib - 0, true_delta_2);
 
                         if (this->record_violation_history) {
                             maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
@@ -158,7 +178,7 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
 
                     // For all items with variables, add the effect of incremented
                     // (and projected) lagrangian reactions:
-                    mconstraints[ic]->Increment_q(true_delta);
+                    Increment_q(ic, ib, true_delta);
 
                     if (this->record_violation_history)
                         maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
@@ -166,6 +186,7 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
 
                 maxviolation = ChMax(maxviolation, fabs(candidate_violation));
 
+                ib++;
             }  // end IsActive()
 
         }  // end loop on constraints
@@ -181,6 +202,9 @@ double ChSolverSOR::Solve(ChSystemDescriptor& sysd  ///< system description with
 
     }  // end iteration loop
 
+    if (batched)
+        sysd.FromVectorToVariables(qpacked);
+
     return maxviolation;
 }
 
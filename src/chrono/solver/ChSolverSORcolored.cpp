@@ -0,0 +1,378 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "chrono/core/ChSparseMatrix.h"
+#include "chrono/solver/ChSolverSORcolored.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverSORcolored)
+
+namespace {
+
+// A dummy sparse matrix that only records the column indices of the elements
+// pasted into it. Used to find out which variables a constraint acts upon, via
+// the generic ChConstraint::Build_Cq() interface.
+class ChColumnRecorder : public ChSparseMatrix {
+  public:
+    std::vector<int> cols;
+
+    ChColumnRecorder() : ChSparseMatrix(1, 1) {}
+
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        cols.push_back(inscol);
+    }
+    virtual double GetElement(int row, int col) const override { return 0; }
+    virtual void Reset(int row, int col, int nonzeros = 0) override { cols.clear(); }
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override {
+        cols.clear();
+        return true;
+    }
+};
+
+}  // end anonymous namespace
+
+ChSolverSORcolored::ChSolverSORcolored(int nthreads, int mmax_iters, bool mwarm_start, double mtolerance, double momega)
+    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance, momega), num_colorings(0) {
+    SetNumThreads(nthreads);
+}
+
+void ChSolverSORcolored::GatherLayout(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    layout_key.clear();
+    for (auto var : mvariables) {
+        layout_key.push_back(reinterpret_cast<std::uintptr_t>(var));
+        layout_key.push_back(var->IsActive());
+    }
+    for (auto constr : mconstraints) {
+        layout_key.push_back(reinterpret_cast<std::uintptr_t>(constr));
+        layout_key.push_back(2 * (std::uintptr_t)constr->GetMode() + constr->IsActive());
+    }
+
+    // Active variables of each active constraint. Constraints between two blocks of variables
+    // report them directly; for the others, the columns of their jacobian are recorded.
+    // CountActiveVariables() also refreshes the offsets, if the count is not frozen.
+    int n_q = sysd.CountActiveVariables();
+    std::vector<ChVariables*> col2var;
+    ChColumnRecorder recorder;
+
+    layout_vars.clear();
+    layout_vars_ptr.assign(1, 0);
+    for (auto constr : mconstraints) {
+        if (constr->IsActive()) {
+            ChVariables* var_a;
+            ChVariables* var_b;
+            const double* Cq_a;
+            const double* Cq_b;
+            const double* Eq_a;
+            const double* Eq_b;
+            if (constr->GetTwoBodyJacobians(var_a, var_b, Cq_a, Cq_b, Eq_a, Eq_b)) {
+                if (var_a->IsActive())
+                    layout_vars.push_back(var_a);
+                if (var_b->IsActive())
+                    layout_vars.push_back(var_b);
+            } else {
+                if (col2var.empty()) {
+                    col2var.assign(n_q, nullptr);
+                    for (auto var : mvariables) {
+                        if (var->IsActive()) {
+                            for (int j = 0; j < var->Get_ndof(); j++)
+                                col2var[var->GetOffset() + j] = var;
+                        }
+                    }
+                }
+                recorder.cols.clear();
+                constr->Build_Cq(recorder, 0);
+                for (auto col : recorder.cols) {
+                    if (col >= 0 && col < n_q && col2var[col])
+                        layout_vars.push_back(col2var[col]);
+                }
+            }
+        }
+        layout_vars_ptr.push_back((int)layout_vars.size());
+    }
+}
+
+void ChSolverSORcolored::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // 1) Partition the active constraints in blocks. The three consecutive
+    //    CONSTRAINT_FRIC multipliers of a contact (or of its rolling part)
+    //    must be updated together, because of the projection on the cone.
+    block_constr.clear();
+    block_ptr.clear();
+    int n_fric = 0;
+    for (int ic = 0; ic < (int)mconstraints.size(); ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            if (n_fric == 0)
+                block_ptr.push_back((int)block_constr.size());
+            n_fric = (n_fric + 1) % 3;
+        } else {
+            block_ptr.push_back((int)block_constr.size());
+        }
+        block_constr.push_back(ic);
+    }
+    int nblocks = (int)block_ptr.size();
+    block_ptr.push_back((int)block_constr.size());
+
+    // 2) Map each variables object to its index.
+    std::unordered_map<ChVariables*, int> var_index;
+    for (int iv = 0; iv < (int)mvariables.size(); iv++)
+        var_index[mvariables[iv]] = iv;
+
+    // 3) Greedy coloring of the blocks, in order: a block gets the smallest color
+    //    not already used by a block that shares any of its active variables.
+    std::vector<std::vector<int>> var_colors(mvariables.size());
+    std::vector<int> block_color(nblocks, 0);
+    std::vector<int> stamp;
+    std::vector<int> vars;
+    int ncolors = 0;
+
+    for (int ib = 0; ib < nblocks; ib++) {
+        vars.clear();
+        for (int k = block_ptr[ib]; k < block_ptr[ib + 1]; k++) {
+            int ic = block_constr[k];
+            for (int j = layout_vars_ptr[ic]; j < layout_vars_ptr[ic + 1]; j++)
+                vars.push_back(var_index[layout_vars[j]]);
+        }
+        std::sort(vars.begin(), vars.end());
+        vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+
+        for (auto iv : vars)
+            for (auto c : var_colors[iv])
+                stamp[c] = ib + 1;
+
+        int color = 0;
+        while (color < ncolors && stamp[color] == ib + 1)
+            color++;
+        if (color == ncolors) {
+            ncolors++;
+            stamp.push_back(0);
+        }
+
+        block_color[ib] = color;
+        for (auto iv : vars)
+            var_colors[iv].push_back(color);
+    }
+
+    // 4) Bucket the blocks by color (counting sort, stable in block index).
+    color_ptr.assign(ncolors + 1, 0);
+    for (int ib = 0; ib < nblocks; ib++)
+        color_ptr[block_color[ib] + 1]++;
+    for (int c = 0; c < ncolors; c++)
+        color_ptr[c + 1] += color_ptr[c];
+    color_blocks.resize(nblocks);
+    std::vector<int> fill(color_ptr.begin(), color_ptr.end() - 1);
+    for (int ib = 0; ib < nblocks; ib++)
+        color_blocks[fill[block_color[ib]]++] = ib;
+
+    block_violation.assign(nblocks, 0.0);
+    block_deltal.assign(nblocks, 0.0);
+}
+
+double ChSolverSORcolored::SolveBlock(std::vector<ChConstraint*>& mconstraints, int block, double& maxdeltalambda) {
+    int from = block_ptr[block];
+    int nc = block_ptr[block + 1] - from;
+
+    maxdeltalambda = 0;
+
+    if (nc == 3 && mconstraints[block_constr[from]]->GetMode() == CONSTRAINT_FRIC) {
+        ChConstraint* mc[3] = {mconstraints[block_constr[from]], mconstraints[block_constr[from + 1]],
+                               mconstraints[block_constr[from + 2]]};
+        double old_lambda[3];
+        double candidate_violation = 0;
+
+        for (int i = 0; i < 3; i++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = mc[i]->Compute_Cq_q() + mc[i]->Get_b_i() + mc[i]->Get_cfm_i() * mc[i]->Get_l_i();
+            if (i == 0)
+                candidate_violation = fabs(ChMin(0.0, mresidual));
+
+            // update:   lambda += delta_lambda;
+            double deltal = (omega / mc[i]->Get_g_i()) * (-mresidual);
+            old_lambda[i] = mc[i]->Get_l_i();
+            mc[i]->Set_l_i(old_lambda[i] + deltal);
+        }
+
+        mc[0]->Project();  // the N normal component will take care of N,U,V
+
+        for (int i = 0; i < 3; i++) {
+            double new_lambda = mc[i]->Get_l_i();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (shlambda != 1.0) {
+                new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda[i];
+                mc[i]->Set_l_i(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[i];
+            mc[i]->Increment_q(true_delta);
+            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+        }
+
+        return candidate_violation;
+    }
+
+    // Scalar constraint (bilateral, unilateral, or a friction group that is not a full triplet)
+    double maxviolation = 0;
+    for (int k = from; k < from + nc; k++) {
+        ChConstraint* mc = mconstraints[block_constr[k]];
+
+        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+        double mresidual = mc->Compute_Cq_q() + mc->Get_b_i() + mc->Get_cfm_i() * mc->Get_l_i();
+
+        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+        double candidate_violation = fabs(mc->Violation(mresidual));
+
+        // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+        double deltal = (omega / mc->Get_g_i()) * (-mresidual);
+
+        // update:   lambda += delta_lambda;
+        double old_lambda = mc->Get_l_i();
+        mc->Set_l_i(old_lambda + deltal);
+
+        // If new lagrangian multiplier does not satisfy inequalities, project
+        // it into an admissible orthant (or, in general, onto an admissible set)
+        mc->Project();
+
+        // After projection, the lambda may have changed a bit..
+        double new_lambda = mc->Get_l_i();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (shlambda != 1.0) {
+            new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda;
+            mc->Set_l_i(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+
+        // For all items with variables, add the effect of incremented
+        // (and projected) lagrangian reactions:
+        mc->Increment_q(true_delta);
+
+        maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+        maxviolation = ChMax(maxviolation, candidate_violation);
+    }
+
+    return maxviolation;
+}
+
+double ChSolverSORcolored::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                                 ) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    tot_iterations = 0;
+    double maxviolation = 0.;
+    double maxdeltalambda = 0.;
+
+    // 0)  Partition constraints in blocks and color them, unless the layout did not change.
+    GatherLayout(sysd);
+    if (layout_key != colored_key || layout_vars != colored_vars) {
+        ColorConstraints(sysd);
+        colored_key = layout_key;
+        colored_vars = layout_vars;
+        num_colorings++;
+    }
+
+    int nconstr = (int)mconstraints.size();
+    int nvars = (int)mvariables.size();
+    int ncolors = GetNumColors();
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int ic = 0; ic < nconstr; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    for (int ib = 0; ib < GetNumBlocks(); ib++) {
+        int from = block_ptr[ib];
+        if (block_ptr[ib + 1] - from == 3 && mconstraints[block_constr[from]]->GetMode() == CONSTRAINT_FRIC) {
+            double average_g_i = (mconstraints[block_constr[from]]->Get_g_i() +
+                                  mconstraints[block_constr[from + 1]]->Get_g_i() +
+                                  mconstraints[block_constr[from + 2]]->Get_g_i()) /
+                                 3.0;
+            mconstraints[block_constr[from]]->Set_g_i(average_g_i);
+            mconstraints[block_constr[from + 1]]->Set_g_i(average_g_i);
+            mconstraints[block_constr[from + 2]]->Set_g_i(average_g_i);
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int iv = 0; iv < nvars; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of contraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    //     Blocks of the same color never share variables, so they can increment q concurrently.
+    if (warm_start) {
+        for (int c = 0; c < ncolors; c++) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (int k = color_ptr[c]; k < color_ptr[c + 1]; k++) {
+                int ib = color_blocks[k];
+                for (int j = block_ptr[ib]; j < block_ptr[ib + 1]; j++)
+                    mconstraints[block_constr[j]]->Increment_q(mconstraints[block_constr[j]]->Get_l_i());
+            }
+        }
+    } else {
+        for (int ic = 0; ic < nconstr; ic++)
+            mconstraints[ic]->Set_l_i(0.);
+    }
+
+    // 4)  Perform the iteration loops, sweeping one color at a time
+    //
+    for (int iter = 0; iter < max_iterations; iter++) {
+        for (int c = 0; c < ncolors; c++) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (int k = color_ptr[c]; k < color_ptr[c + 1]; k++) {
+                int ib = color_blocks[k];
+                block_violation[ib] = SolveBlock(mconstraints, ib, block_deltal[ib]);
+            }
+        }
+
+        // Serial reductions, in block order
+        maxviolation = 0;
+        maxdeltalambda = 0;
+        for (int ib = 0; ib < GetNumBlocks(); ib++) {
+            maxviolation = ChMax(maxviolation, block_violation[ib]);
+            maxdeltalambda = ChMax(maxdeltalambda, block_deltal[ib]);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        tot_iterations++;
+        // Terminate the loop if violation in constraints has been succesfully limited.
+        if (maxviolation < tolerance)
+            break;
+    }
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
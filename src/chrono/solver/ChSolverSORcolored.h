@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVERSORCOLORED_H
+#define CHSOLVERSORCOLORED_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolver.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A parallel projected SOR (Gauss-Seidel) solver based on graph coloring.
+/// Constraints are grouped in blocks (a single scalar constraint, or the N,U,V
+/// triplet of a frictional contact) and blocks are colored so that no two blocks
+/// of the same color act on the same ChVariables object. The blocks of one color
+/// are then swept in parallel (OpenMP) without any write conflict on the shared
+/// q vectors, while colors are processed one after the other.
+/// Since the coloring is a deterministic function of the order of constraints and
+/// variables in the ChSystemDescriptor, results do not depend on the number of threads.
+/// The coloring is kept across calls to Solve() and redone only if the layout of the
+/// problem changes (constraints, their modes and activity, and the variables they act upon).
+/// Note that a non-fixed body with a very large number of contacts (e.g. a movable
+/// container) forces a correspondingly large number of colors.
+
+class ChApi ChSolverSORcolored : public ChIterativeSolver {
+
+    // Tag needed for class factory in archive (de)serialization:
+    CH_FACTORY_TAG(ChSolverSORcolored)
+
+  protected:
+    int nthreads;  ///< number of OpenMP threads used for the sweeps
+
+    // Constraint blocks (indices in the descriptor's constraint list)
+    std::vector<int> block_constr;  ///< constraint indices, contiguous per block
+    std::vector<int> block_ptr;     ///< block i spans block_constr[block_ptr[i]...block_ptr[i+1]-1]
+
+    // Coloring (blocks grouped by color, in increasing block index within a color)
+    std::vector<int> color_blocks;  ///< block indices, sorted by color
+    std::vector<int> color_ptr;     ///< color k spans color_blocks[color_ptr[k]...color_ptr[k+1]-1]
+
+    std::vector<double> block_violation;  ///< per-block scratch for violation reduction
+    std::vector<double> block_deltal;     ///< per-block scratch for delta lambda reduction
+
+    // Layout of the problem (constraints and variables they act upon)
+    std::vector<std::uintptr_t> layout_key;   ///< variables and constraints, with their flags
+    std::vector<ChVariables*> layout_vars;    ///< active variables of each active constraint
+    std::vector<int> layout_vars_ptr;         ///< constraint i spans layout_vars[layout_vars_ptr[i]...]
+    std::vector<std::uintptr_t> colored_key;  ///< layout_key of the current coloring
+    std::vector<ChVariables*> colored_vars;   ///< layout_vars of the current coloring
+    int num_colorings;                        ///< number of times the constraints were colored
+
+  public:
+    ChSolverSORcolored(int nthreads = 2,            ///< number of threads
+                       int mmax_iters = 50,         ///< max.number of iterations
+                       bool mwarm_start = false,    ///< uses warm start?
+                       double mtolerance = 0.0,     ///< tolerance for termination criterion
+                       double momega = 1.0          ///< overrelaxation criterion
+                       );
+
+    virtual ~ChSolverSORcolored() {}
+
+    /// Return type of the solver.
+    virtual Type GetType() const override { return Type::SOR_COLORED; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Set the number of threads used in the parallel sweeps (at least 1).
+    void SetNumThreads(int mthreads) { nthreads = (mthreads < 1) ? 1 : mthreads; }
+
+    /// Return the number of threads used in the parallel sweeps.
+    int GetNumThreads() const { return nthreads; }
+
+    /// Return the number of colors used in the last call to Solve().
+    int GetNumColors() const { return color_ptr.empty() ? 0 : (int)color_ptr.size() - 1; }
+
+    /// Return the number of constraint blocks processed in the last call to Solve().
+    int GetNumBlocks() const { return block_ptr.empty() ? 0 : (int)block_ptr.size() - 1; }
+
+    /// Return the number of times the constraints were colored, i.e. the number of calls to
+    /// Solve() that found a change in the layout of the problem.
+    int GetNumColorings() const { return num_colorings; }
+
+  protected:
+    /// Collect the layout of the problem: the constraints and variables, and the active
+    /// variables each active constraint acts upon.
+    void GatherLayout(ChSystemDescriptor& sysd);
+
+    /// Partition the active constraints in blocks and color the block graph (uses the gathered layout).
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform one projected SOR update on the given block.
+    /// Returns the constraint violation and sets the max. change in multipliers.
+    double SolveBlock(std::vector<ChConstraint*>& mconstraints, int block, double& maxdeltalambda);
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/solver/ChSolverSparseLDLT.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverSparseLDLT)
+
+ChSolverSparseLDLT::ChSolverSparseLDLT()
+    : m_mat(1, 1), m_lock(false), m_max_refinement(2), m_solve_call(0), m_setup_call(0) {}
+
+bool ChSolverSparseLDLT::Setup(ChSystemDescriptor& sysd) {
+    m_timer_setup_assembly.start();
+
+    sysd.ConvertToMatrixForm(&m_mat, nullptr);
+    m_mat.Compress();
+
+    m_timer_setup_assembly.stop();
+
+    // Factorize the KKT matrix: positive pivots for the variables, negative for the constraints.
+    m_timer_setup_solvercall.start();
+    m_engine.SetNumPositivePivots(sysd.CountActiveVariables());
+    bool success = m_engine.Factorize(m_mat);
+    m_timer_setup_solvercall.stop();
+
+    m_setup_call++;
+
+    if (verbose) {
+        GetLog() << " Sparse LDLT setup n = " << m_engine.GetSize() << "  nnz = " << m_mat.GetNNZ()
+                 << "  nnz(L) = " << m_engine.GetNNZ_L() << "  analyses = " << m_engine.GetNumAnalyses()
+                 << "  perturbed pivots = " << m_engine.GetNumPerturbedPivots() << "\n";
+        GetLog() << "  assembly: " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s"
+                 << "  solver_call: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "\n";
+    }
+
+    if (!success) {
+        GetLog() << "Sparse LDLT factorization: zero pivot\n";
+        return false;
+    }
+
+    return true;
+}
+
+double ChSolverSparseLDLT::Solve(ChSystemDescriptor& sysd) {
+    // Assemble the problem right-hand side vector.
+    m_timer_solve_assembly.start();
+    sysd.ConvertToMatrixForm(nullptr, &m_rhs);
+    m_timer_solve_assembly.stop();
+
+    m_timer_solve_solvercall.start();
+    m_engine.Solve(m_sol, m_rhs);
+    double res_norm = ComputeResidual();
+
+    // Perturbed pivots give an approximate factorization: improve the solution with
+    // iterative refinement, using the residual of the assembled system.
+    if (m_engine.GetNumPerturbedPivots() > 0) {
+        for (int k = 0; k < m_max_refinement; k++) {
+            m_engine.Solve(m_update, m_res);
+            for (int i = 0; i < m_sol.GetRows(); i++)
+                m_sol(i) += m_update(i);
+            res_norm = ComputeResidual();
+        }
+    }
+    m_timer_solve_solvercall.stop();
+
+    m_solve_call++;
+
+    if (verbose) {
+        GetLog() << " Sparse LDLT solve call " << m_solve_call << "  |residual| = " << res_norm << "\n";
+        GetLog() << "  assembly: " << m_timer_solve_assembly.GetTimeSecondsIntermediate() << "s\n"
+                 << "  solver_call: " << m_timer_solve_solvercall.GetTimeSecondsIntermediate() << "\n";
+    }
+
+    // Scatter solution vector to the system descriptor.
+    m_timer_solve_assembly.start();
+    sysd.FromVectorToUnknowns(m_sol);
+    m_timer_solve_assembly.stop();
+
+    return res_norm;
+}
+
+// Compute res = rhs - Z*sol, with the matrix of the last factorization, and return its norm.
+double ChSolverSparseLDLT::ComputeResidual() {
+    const int* Zp = m_mat.GetCSR_LeadingIndexArray();
+    const int* Zi = m_mat.GetCSR_TrailingIndexArray();
+    const double* Zx = m_mat.GetCSR_ValueArray();
+    int n = m_mat.GetNumRows();
+
+    m_res.Resize(n, 1);
+    double norm2 = 0;
+    for (int i = 0; i < n; i++) {
+        double r = m_rhs(i);
+        for (int p = Zp[i]; p < Zp[i + 1]; p++)
+            r -= Zx[p] * m_sol(Zi[p]);
+        m_res(i) = r;
+        norm2 += r * r;
+    }
+
+    return std::sqrt(norm2);
+}
+
+void ChSolverSparseLDLT::ArchiveOUT(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChSolverSparseLDLT>();
+    // serialize parent class
+    ChSolver::ArchiveOUT(marchive);
+    // serialize all member data:
+    marchive << CHNVP(m_lock);
+    marchive << CHNVP(m_max_refinement);
+}
+
+void ChSolverSparseLDLT::ArchiveIN(ChArchiveIn& marchive) {
+    // version number
+    int version = marchive.VersionRead<ChSolverSparseLDLT>();
+    // deserialize parent class
+    ChSolver::ArchiveIN(marchive);
+    // stream in all member data:
+    marchive >> CHNVP(m_lock);
+    marchive >> CHNVP(m_max_refinement);
+    m_mat.SetSparsityPatternLock(m_lock);
+}
+
+}  // end namespace chrono
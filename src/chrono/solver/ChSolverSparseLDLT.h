@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVERSPARSELDLT_H
+#define CHSOLVERSPARSELDLT_H
+
+#include "chrono/core/ChCSR3Matrix.h"
+#include "chrono/core/ChSparseLDLT.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/solver/ChSolver.h"
+
+namespace chrono {
+
+/// Built-in sparse direct solver, based on the LDL' factorization of the system matrix
+/// (see ChSparseLDLT). It does not require any external library.
+/// As ChSolverMKL, it can solve linear systems (ex. for implicit integrators such as HHT and for
+/// static analyses), but not VI and complementarity problems.
+/// The ordering and the symbolic factorization are reused as long as the sparsity pattern of the
+/// system matrix does not change; see also ChSystemDescriptor::SetUseSparsityPatternCache() for
+/// reusing the pattern in the assembly of the matrix.
+class ChApi ChSolverSparseLDLT : public ChSolver {
+
+    // Tag needed for class factory in archive (de)serialization:
+    CH_FACTORY_TAG(ChSolverSparseLDLT)
+
+  public:
+    ChSolverSparseLDLT();
+
+    virtual ~ChSolverSparseLDLT() {}
+
+    /// Get a handle to the underlying factorization engine.
+    ChSparseLDLT& GetEngine() { return m_engine; }
+
+    /// Get a handle to the underlying matrix.
+    ChCSR3Matrix& GetMatrix() { return m_mat; }
+
+    /// Enable/disable locking the sparsity pattern of the problem matrix (default: false).
+    /// If \a val is set to true, then the sparsity pattern of the problem matrix is assumed
+    /// to be unchanged from call to call.
+    void SetSparsityPatternLock(bool val) {
+        m_lock = val;
+        m_mat.SetSparsityPatternLock(m_lock);
+    }
+
+    /// Set the maximum number of iterative refinement steps (default: 2).
+    /// Iterative refinement is done only if some pivots were perturbed in the factorization.
+    void SetMaxRefinementSteps(int nsteps) { m_max_refinement = nsteps; }
+
+    /// Reset timers for internal phases in Solve and Setup.
+    void ResetTimers() {
+        m_timer_setup_assembly.reset();
+        m_timer_setup_solvercall.reset();
+        m_timer_solve_assembly.reset();
+        m_timer_solve_solvercall.reset();
+    }
+
+    /// Get cumulative time for assembly operations in Solve phase.
+    double GetTimeSolve_Assembly() const { return m_timer_solve_assembly(); }
+    /// Get cumulative time for the solution calls in Solve phase.
+    double GetTimeSolve_SolverCall() const { return m_timer_solve_solvercall(); }
+    /// Get cumulative time for assembly operations in Setup phase.
+    double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
+    /// Get cumulative time for the factorization in Setup phase.
+    double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+
+    /// Indicate whether or not the Solve() phase requires an up-to-date problem matrix.
+    /// As typical of direct solvers, this solver only requires the matrix for its Setup() phase.
+    virtual bool SolveRequiresMatrix() const override { return false; }
+
+    /// Perform the solver setup operations: assemble and factorize the system matrix.
+    /// Returns true if successful and false otherwise.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    /// Solve using the factorization obtained at the last call to Setup().
+    /// Returns the norm of the residual of the linear system.
+    virtual double Solve(ChSystemDescriptor& sysd) override;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOUT(ChArchiveOut& marchive) override;
+
+    /// Method to allow de serialization of transient data from archives.
+    virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    double ComputeResidual();
+
+    ChSparseLDLT m_engine;             ///< factorization engine
+    ChCSR3Matrix m_mat;                ///< problem matrix
+    ChMatrixDynamic<double> m_rhs;     ///< right-hand side vector
+    ChMatrixDynamic<double> m_sol;     ///< solution vector
+    ChMatrixDynamic<double> m_res;     ///< residual vector
+    ChMatrixDynamic<double> m_update;  ///< solution update of the iterative refinement
+
+    bool m_lock;           ///< is the matrix sparsity pattern locked?
+    int m_max_refinement;  ///< maximum number of iterative refinement steps
+    int m_solve_call;      ///< counter for calls to Solve
+    int m_setup_call;      ///< counter for calls to Setup
+
+    ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
+    ChTimer<> m_timer_setup_solvercall;  ///< timer for factorization
+    ChTimer<> m_timer_solve_assembly;    ///< timer for RHS assembly
+    ChTimer<> m_timer_solve_solvercall;  ///< timer for solution
+};
+
+}  // end namespace chrono
+
+#endif
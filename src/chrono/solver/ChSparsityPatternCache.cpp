@@ -0,0 +1,252 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/core/ChCSR3Matrix.h"
+#include "chrono/solver/ChSparsityPatternCache.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+// Dummy matrix that records all the elements set in it, in order.
+class _ElementRecorder : public ChSparseMatrix {
+  public:
+    _ElementRecorder(int n) : ChSparseMatrix(n, n) {}
+
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        rows.push_back(insrow);
+        cols.push_back(inscol);
+        overwrites.push_back(overwrite);
+        values.push_back(insval);
+    }
+    virtual double GetElement(int row, int col) const override { return 0; }
+    virtual void Reset(int row, int col, int nonzeros = 0) override {}
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override { return false; }
+
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<char> overwrites;
+    std::vector<double> values;
+};
+
+// Dummy matrix that stores the values of a range of recorded elements,
+// flagging any element that does not match the recorded one.
+class _ElementReplayer : public ChSparseMatrix {
+  public:
+    _ElementReplayer(int n, const int* rows, const int* cols, const char* overwrites, double* values, int start, int end)
+        : ChSparseMatrix(n, n),
+          rows(rows),
+          cols(cols),
+          overwrites(overwrites),
+          values(values),
+          cursor(start),
+          end(end),
+          mismatch(false) {}
+
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        if (cursor == end || rows[cursor] != insrow || cols[cursor] != inscol || overwrites[cursor] != overwrite) {
+            mismatch = true;
+            return;
+        }
+        values[cursor++] = insval;
+    }
+    virtual double GetElement(int row, int col) const override { return 0; }
+    virtual void Reset(int row, int col, int nonzeros = 0) override {}
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override { return false; }
+
+    bool Completed() const { return !mismatch && cursor == end; }
+
+  private:
+    const int* rows;
+    const int* cols;
+    const char* overwrites;
+    double* values;
+    int cursor;
+    int end;
+    bool mismatch;
+};
+
+ChSparsityPatternCache::ChSparsityPatternCache() : n_q(0), c_a(1), num_rebuilds(0), num_updates(0) {
+    Clear();
+}
+
+void ChSparsityPatternCache::Clear() {
+    matrix = nullptr;
+    values = nullptr;
+    n = 0;
+    nnz = 0;
+    nvariables = 0;
+    nkblocks = 0;
+    nconstraints = 0;
+    block_start.clear();
+    rows.clear();
+    cols.clear();
+    overwrite.clear();
+    slot_start.clear();
+    slot_elements.clear();
+    element_values.clear();
+}
+
+bool ChSparsityPatternCache::Assemble(ChSystemDescriptor& sysd, ChSparseMatrix& Z) {
+    auto csr = dynamic_cast<ChCSR3Matrix*>(&Z);
+    if (!csr || !csr->IsRowMajor())
+        return false;
+
+    // Collect the blocks, in the same order as ChSystemDescriptor::ConvertToMatrixForm()
+    variables.clear();
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive())
+            variables.push_back(var);
+    }
+    kblocks = sysd.GetKblocksList();
+    constraints.clear();
+    for (auto con : sysd.GetConstraintsList()) {
+        if (con->IsActive())
+            constraints.push_back(con);
+    }
+    n_q = sysd.CountActiveVariables();
+    c_a = sysd.GetMassFactor();
+
+    int n_new = n_q + (int)constraints.size();
+
+    // The recorded pattern can be reused only if the matrix was not changed since the last assembly
+    bool valid = matrix == &Z && csr->IsCompressed() && csr->GetNumRows() == n_new && csr->GetNumColumns() == n_new &&
+                 csr->GetCSR_ValueArray() == values && csr->GetNNZ() == nnz &&
+                 nvariables == (int)variables.size() && nkblocks == (int)kblocks.size() &&
+                 nconstraints == (int)constraints.size();
+
+    if (valid && Update(sysd.GetNumThreads())) {
+        num_updates++;
+    } else {
+        Rebuild(Z);
+        num_rebuilds++;
+    }
+
+    // Sum the element values into the matrix values
+    double* Zvalues = csr->GetCSR_ValueArray();
+    int nthreads = sysd.GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int s = 0; s < nnz; s++) {
+        double val = 0;
+        int k = slot_start[s];
+        if (k < slot_start[s + 1]) {
+            val = element_values[slot_elements[k]];
+            for (++k; k < slot_start[s + 1]; ++k)
+                val += element_values[slot_elements[k]];
+        }
+        Zvalues[s] = val;
+    }
+
+    return true;
+}
+
+void ChSparsityPatternCache::BuildBlock(int b, ChSparseMatrix& storage) const {
+    if (b < nvariables) {
+        int offset = variables[b]->GetOffset();
+        variables[b]->Build_M(storage, offset, offset, c_a);
+        return;
+    }
+    b -= nvariables;
+    if (b < nkblocks) {
+        kblocks[b]->Build_K(storage, true);
+        return;
+    }
+    b -= nkblocks;
+    constraints[b]->Build_Cq(storage, n_q + b);
+    constraints[b]->Build_CqT(storage, n_q + b);
+    storage.SetElement(n_q + b, n_q + b, constraints[b]->Get_cfm_i());
+}
+
+bool ChSparsityPatternCache::Update(int nthreads) {
+    int nblocks = nvariables + nkblocks + nconstraints;
+    bool completed = true;
+
+    // Each block writes its own range of element values, so blocks can be processed in parallel
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 16) reduction(&& : completed)
+    for (int b = 0; b < nblocks; b++) {
+        _ElementReplayer replayer(n, rows.data(), cols.data(), overwrite.data(), element_values.data(), block_start[b],
+                                  block_start[b + 1]);
+        BuildBlock(b, replayer);
+        completed = completed && replayer.Completed();
+    }
+
+    return completed;
+}
+
+void ChSparsityPatternCache::Rebuild(ChSparseMatrix& Z) {
+    n = n_q + (int)constraints.size();
+    nvariables = (int)variables.size();
+    nkblocks = (int)kblocks.size();
+    nconstraints = (int)constraints.size();
+    int nblocks = nvariables + nkblocks + nconstraints;
+
+    // Record the elements set by all blocks
+    _ElementRecorder recorder(n);
+    block_start.resize(nblocks + 1);
+    for (int b = 0; b < nblocks; b++) {
+        block_start[b] = (int)recorder.rows.size();
+        BuildBlock(b, recorder);
+    }
+    block_start[nblocks] = (int)recorder.rows.size();
+
+    rows.swap(recorder.rows);
+    cols.swap(recorder.cols);
+    overwrite.swap(recorder.overwrites);
+    element_values.swap(recorder.values);
+    int nelements = (int)rows.size();
+
+    // Load the sparsity pattern in the matrix (zero values included, so that the pattern does
+    // not depend on the values)
+    ChSparsityPatternLearner learner(n, n, true);
+    for (int k = 0; k < nelements; k++)
+        learner.SetElement(rows[k], cols[k], 0);
+    Z.LoadSparsityPattern(learner);
+
+    const int* leadIndex = Z.GetCSR_LeadingIndexArray();
+    const int* trailIndex = Z.GetCSR_TrailingIndexArray();
+    matrix = &Z;
+    values = Z.GetCSR_ValueArray();
+    nnz = Z.GetNNZ();
+
+    // Destination of each element in the array of values
+    std::vector<int> slot(nelements);
+    for (int k = 0; k < nelements; k++)
+        slot[k] = (int)(std::lower_bound(trailIndex + leadIndex[rows[k]], trailIndex + leadIndex[rows[k] + 1], cols[k]) -
+                        trailIndex);
+
+    // Elements set before the last overwrite of a non-zero do not contribute to it
+    std::vector<int> first(nnz, 0);
+    for (int k = 0; k < nelements; k++) {
+        if (overwrite[k])
+            first[slot[k]] = k;
+    }
+
+    // Elements contributing to each non-zero, in order of insertion
+    slot_start.assign(nnz + 1, 0);
+    for (int k = 0; k < nelements; k++) {
+        if (k >= first[slot[k]])
+            slot_start[slot[k] + 1]++;
+    }
+    for (int s = 0; s < nnz; s++)
+        slot_start[s + 1] += slot_start[s];
+    slot_elements.resize(slot_start[nnz]);
+    std::vector<int> fill(slot_start.begin(), slot_start.end() - 1);
+    for (int k = 0; k < nelements; k++) {
+        if (k >= first[slot[k]])
+            slot_elements[fill[slot[k]]++] = k;
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSPARSITYPATTERNCACHE_H
+#define CHSPARSITYPATTERNCACHE_H
+
+#include <vector>
+
+#include "chrono/core/ChSparseMatrix.h"
+
+namespace chrono {
+
+class ChSystemDescriptor;
+class ChVariables;
+class ChConstraint;
+class ChKblock;
+
+/// Cache for the incremental assembly of the system matrix Z of a ChSystemDescriptor
+/// (see ChSystemDescriptor::ConvertToMatrixForm() and ChSystemDescriptor::SetUseSparsityPatternCache()).
+///
+/// At the first assembly, the sequence of elements set by the Build_M(), Build_K() and Build_Cq()
+/// functions of the variables, stiffness blocks and constraints is recorded; the sparsity pattern
+/// is loaded in the matrix and, for each recorded element, the destination in the array of values
+/// of the compressed matrix is stored. At the following assemblies the blocks only write their
+/// values (in parallel, block by block) and these are summed into the matrix values, without any
+/// search or insertion in the sparse matrix.
+/// If the blocks set different elements than the recorded ones (ex. the active constraints changed),
+/// or if the matrix was modified elsewhere, the pattern is rebuilt from scratch.
+/// Only row-major ChCSR3Matrix objects are supported.
+class ChApi ChSparsityPatternCache {
+  public:
+    ChSparsityPatternCache();
+
+    /// Assemble the system matrix Z of the descriptor into the given matrix, reusing the
+    /// recorded pattern if possible. Offsets of variables must be up to date.
+    /// Returns false (and does nothing) if the matrix type is not supported.
+    bool Assemble(ChSystemDescriptor& sysd, ChSparseMatrix& Z);
+
+    /// Forget the recorded pattern, forcing a rebuild at the next assembly.
+    void Clear();
+
+    /// Number of assemblies that (re)built the sparsity pattern.
+    int GetNumRebuilds() const { return num_rebuilds; }
+
+    /// Number of assemblies that reused the recorded sparsity pattern.
+    int GetNumUpdates() const { return num_updates; }
+
+  private:
+    void BuildBlock(int b, ChSparseMatrix& storage) const;
+    void Rebuild(ChSparseMatrix& Z);
+    bool Update(int nthreads);
+
+    // Blocks of the current assembly: active variables, stiffness blocks, active constraints
+    std::vector<ChVariables*> variables;
+    std::vector<ChKblock*> kblocks;
+    std::vector<ChConstraint*> constraints;
+    int n_q;
+    double c_a;
+
+    // Recorded pattern
+    const ChSparseMatrix* matrix;  ///< matrix of the last assembly
+    const double* values;          ///< its array of values
+    int n;                         ///< size of the matrix
+    int nnz;                       ///< number of non-zeros
+    int nvariables;                ///< number of variable blocks
+    int nkblocks;                  ///< number of stiffness blocks
+    int nconstraints;              ///< number of constraint blocks
+    std::vector<int> block_start;  ///< first recorded element of each block
+    std::vector<int> rows;         ///< row of each recorded element
+    std::vector<int> cols;         ///< column of each recorded element
+    std::vector<char> overwrite;   ///< overwrite flag of each recorded element
+    std::vector<int> slot_start;   ///< for each non-zero, first entry in slot_elements
+    std::vector<int> slot_elements;  ///< recorded elements summed in each non-zero, in order
+    std::vector<double> element_values;  ///< values of the recorded elements
+
+    int num_rebuilds;
+    int num_updates;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -27,9 +27,15 @@ ChSystemDescriptor::ChSystemDescriptor() {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
+    kblock_group_begin = 0;
 
     c_a = 1.0;
 
+    use_constraint_batch = false;
+    constraint_batch_valid = false;
+
+    use_sparsity_pattern_cache = false;
+
     n_q = 0;
     n_c = 0;
     freeze_count = false;
@@ -106,6 +112,20 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+    constraint_batch_valid = false;
+}
+
+bool ChSystemDescriptor::UpdateConstraintBatch() {
+    constraint_batch_valid = false;
+    if (!use_constraint_batch) {
+        constraint_batch.Clear();
+        return false;
+    }
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+    constraint_batch_valid = constraint_batch.Pack(vconstraints) && n_q > 0 && vstiffness.size() == 0;
+    return constraint_batch_valid;
 }
 
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
@@ -217,7 +237,10 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs)
     n_q = this->CountActiveVariables();
 
    
-	if (Z)
+	// If enabled and supported by the matrix type, Z is assembled in the recorded sparsity pattern.
+	bool cached = Z && use_sparsity_pattern_cache && sparsity_pattern_cache.Assemble(*this, *Z);
+
+	if (Z && !cached)
 	{
 		Z->Reset(n_q + mn_c, n_q + mn_c);
 
@@ -407,10 +430,7 @@ int ChSystemDescriptor::BuildDiagonalVector(
     Diagonal_vect.Reset(n_q + n_c, 1);  // fast! Reset() method does not realloc if size doesn't change
 
     // Fill the diagonal values given by ChKblock objects , if any
-    // (This cannot be easily parallelized because of possible write concurrency).
-    for (int is = 0; is < (int)vstiffness.size(); is++) {
-        vstiffness[is]->DiagonalAdd(Diagonal_vect);
-    }
+    KblocksDiagonalAdd(Diagonal_vect);
 
     // Get the 'M' diagonal terms given by ChVariables objects
     for (int iv = 0; iv < (int)vvariables.size(); iv++) {
@@ -549,6 +569,25 @@ void ChSystemDescriptor::ShurComplementProduct(ChMatrix<>& result, ChMatrix<>* l
 
     result.Reset(n_c, 1);  // fast! Reset() method does not realloc if size doesn't change
 
+    if (constraint_batch_valid && !enabled) {
+        // Batched product: qb=[M^(-1)][Cq']*l and result=[Cq]*qb-[E]*l, over a packed 'q' vector
+        int nb = constraint_batch.GetNconstraints();
+        batch_q.assign(n_q, 0.0);
+        batch_l.resize(nb);
+        batch_r.resize(nb);
+        for (int i = 0; i < nb; i++) {
+            ChConstraint* mc = constraint_batch.GetConstraint(i);
+            batch_l[i] = lvector ? (*lvector)(mc->GetOffset(), 0) : mc->Get_l_i();
+        }
+        constraint_batch.Increment_q(batch_q.data(), batch_l.data());
+        constraint_batch.Compute_Cq_q(batch_q.data(), batch_r.data());
+        for (int i = 0; i < nb; i++) {
+            ChConstraint* mc = constraint_batch.GetConstraint(i);
+            result(mc->GetOffset(), 0) = mc->Get_cfm_i() * batch_l[i] + batch_r[i];
+        }
+        return;
+    }
+
 // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
 // in different phases:
 
@@ -641,18 +680,16 @@ void ChSystemDescriptor::SystemProduct(
 // 1.1)  do  M*x.q
     for (int iv = 0; iv < (int)vvariables.size(); iv++)
         if (vvariables[iv]->IsActive()) {
-            vvariables[iv]->MultiplyAndAdd(result, *x, this->c_a);
+            vvariables[iv]->MultiplyAndAdd(result, *vect, this->c_a);
         }
 
-    // 1.2)  add also K*x.q  (NON straight parallelizable - risk of concurrency in writing)
-    for (int ik = 0; ik < (int)vstiffness.size(); ik++) {
-        vstiffness[ik]->MultiplyAndAdd(result, *x);
-    }
+    // 1.2)  add also K*x.q  (in parallel, with per-thread buffers)
+    KblocksMultiplyAndAdd(result, *vect);
 
     // 1.3)  add also [Cq]'*x.l  (NON straight parallelizable - risk of concurrency in writing)
     for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
         if (vconstraints[ic]->IsActive()) {
-            vconstraints[ic]->MultiplyTandAdd(result, (*x)(vconstraints[ic]->GetOffset() + n_q));
+            vconstraints[ic]->MultiplyTandAdd(result, (*vect)(vconstraints[ic]->GetOffset() + n_q));
         }
     }
 
@@ -660,8 +697,8 @@ void ChSystemDescriptor::SystemProduct(
     for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
         if (vconstraints[ic]->IsActive()) {
             int s_c = vconstraints[ic]->GetOffset() + n_q;
-            vconstraints[ic]->MultiplyAndAdd(result(s_c), (*x));       // result.l_i += [C_q_i]*x.q
-            result(s_c) -= vconstraints[ic]->Get_cfm_i() * (*x)(s_c);  // result.l_i += [E]*x.l_i  NOTE:  cfm = -E
+            vconstraints[ic]->MultiplyAndAdd(result(s_c), (*vect));       // result.l_i += [C_q_i]*x.q
+            result(s_c) -= vconstraints[ic]->Get_cfm_i() * (*vect)(s_c);  // result.l_i += [E]*x.l_i  NOTE:  cfm = -E
         }
     }
 
@@ -670,6 +707,38 @@ void ChSystemDescriptor::SystemProduct(
         delete x_ql;
 }
 
+// Apply func to all the blocks: serially, except for the blocks of the groups, which do not share
+// variables and are processed in parallel.
+template <class Func>
+static void _ProcessKblocks(std::vector<ChKblock*>& vstiffness,
+                            const std::vector<std::pair<size_t, size_t>>& kblock_groups,
+                            int num_threads,
+                            Func func) {
+    int ik = 0;
+    for (auto& group : kblock_groups) {
+        for (; ik < (int)group.first; ik++)
+            func(vstiffness[ik]);
+
+        int iend = (int)group.second;
+        int nthreads = ChMin(num_threads, iend - ik);
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 4) if (nthreads > 1)
+        for (int jk = ik; jk < iend; jk++)
+            func(vstiffness[jk]);
+        ik = iend;
+    }
+    for (; ik < (int)vstiffness.size(); ik++)
+        func(vstiffness[ik]);
+}
+
+void ChSystemDescriptor::KblocksMultiplyAndAdd(ChMatrix<>& result, const ChMatrix<>& vect) {
+    _ProcessKblocks(vstiffness, kblock_groups, num_threads,
+                    [&](ChKblock* block) { block->MultiplyAndAdd(result, vect); });
+}
+
+void ChSystemDescriptor::KblocksDiagonalAdd(ChMatrix<>& result) {
+    _ProcessKblocks(vstiffness, kblock_groups, num_threads, [&](ChKblock* block) { block->DiagonalAdd(result); });
+}
+
 void ChSystemDescriptor::ConstraintsProject(
     ChMatrix<>& multipliers  ///< matrix which contains the entire vector of 'l_i' multipliers to be projected
     ) {
@@ -13,11 +13,14 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <utility>
 #include <vector>
 
 #include "chrono/solver/ChVariables.h"
 #include "chrono/solver/ChConstraint.h"
+#include "chrono/solver/ChConstraintBatch.h"
 #include "chrono/solver/ChKblock.h"
+#include "chrono/solver/ChSparsityPatternCache.h"
 #include "chrono/parallel/ChOpenMP.h"
 #include "chrono/parallel/ChThreadsSync.h"
 
@@ -72,6 +75,19 @@ class ChApi ChSystemDescriptor {
 
     double c_a;         // coefficient form M mass matrices in vvariables
 
+    bool use_constraint_batch;           // pack constraints between 6-DOF objects
+    bool constraint_batch_valid;         // the batch covers all active constraints and is up to date
+    ChConstraintBatch constraint_batch;  // packed constraints
+    std::vector<double> batch_q;         // work vectors for the batched ShurComplementProduct()
+    std::vector<double> batch_l;
+    std::vector<double> batch_r;
+
+    bool use_sparsity_pattern_cache;                // reuse the pattern of Z in ConvertToMatrixForm()
+    ChSparsityPatternCache sparsity_pattern_cache;  // recorded pattern of Z
+
+    std::vector<std::pair<size_t, size_t>> kblock_groups;  // ranges of vstiffness with blocks not sharing variables
+    size_t kblock_group_begin;                             // start of the group being inserted
+
   private:
     int n_q;            // n.active variables
     int n_c;            // n.active constraints
@@ -101,9 +117,11 @@ class ChApi ChSystemDescriptor {
 
     /// Begin insertion of items
     virtual void BeginInsertion() {
+        constraint_batch_valid = false;
         vconstraints.clear();
         vvariables.clear();
         vstiffness.clear();
+        kblock_groups.clear();
     }
 
     /// Insert reference to a ChConstraint object
@@ -115,6 +133,17 @@ class ChApi ChSystemDescriptor {
     /// Insert reference to a ChKblock object (a piece of matrix)
     virtual void InsertKblock(ChKblock* mk) { vstiffness.push_back(mk); }
 
+    /// Start a group of ChKblock objects which do not share any variable, such as the blocks of the
+    /// elements of one color of a FEA mesh: the blocks inserted until EndKblockGroup() are processed
+    /// in parallel by KblocksMultiplyAndAdd() and KblocksDiagonalAdd().
+    virtual void BeginKblockGroup() { kblock_group_begin = vstiffness.size(); }
+
+    /// End the group of ChKblock objects started by BeginKblockGroup().
+    virtual void EndKblockGroup() {
+        if (vstiffness.size() > kblock_group_begin)
+            kblock_groups.push_back(std::make_pair(kblock_group_begin, vstiffness.size()));
+    }
+
     /// End insertion of items
     virtual void EndInsertion() { UpdateCountsAndOffsets(); }
 
@@ -258,6 +287,9 @@ class ChApi ChSystemDescriptor {
     /// NOTE! currently this function does NOT support the cases that use also ChKblock
     /// objects, because it would need to invert the global M+K, that is not diagonal,
     /// for doing = [N]*l = [ [Cq][(M+K)^(-1)][Cq'] - [E] ] * l
+    /// If the constraint batch is in use and up to date (see UpdateConstraintBatch()), and no
+    /// enable flags are given, the product is done with the batched kernels, and the 'q' data
+    /// in the ChVariables are not changed.
     virtual void ShurComplementProduct(ChMatrix<>& result,   ///< matrix which contains the result of  N*l_i
                                        ChMatrix<>* lvector,  ///< optional matrix with the vector to be multiplied (if
                                        /// null, use current constr. multipliers l_i)
@@ -278,6 +310,17 @@ class ChApi ChSystemDescriptor {
         // false=disable (skip)
         );
 
+    /// Add the product of the K matrix (the ChKblock objects) by vect to result:  result += K*vect.
+    /// The blocks of each group (see BeginKblockGroup()) are processed in parallel (see SetNumThreads()),
+    /// the other blocks serially. Since the blocks of a group do not share variables, they add their
+    /// products to different entries of result, without locks or buffers.
+    /// The 'vect' and 'result' vectors must have the size of the total variables&constraints.
+    virtual void KblocksMultiplyAndAdd(ChMatrix<>& result, const ChMatrix<>& vect);
+
+    /// Add the diagonal of the K matrix (the ChKblock objects) to result, processing the blocks
+    /// in parallel as in KblocksMultiplyAndAdd().
+    virtual void KblocksDiagonalAdd(ChMatrix<>& result);
+
     /// Performs projecton of constraint multipliers onto allowed set (in case
     /// of bilateral constraints it does not affect multipliers, but for frictional
     /// constraints, for example, it projects multipliers onto the friction cones)
@@ -317,6 +360,35 @@ class ChApi ChSystemDescriptor {
     virtual void SetNumThreads(int nthreads);
     virtual int GetNumThreads() { return this->num_threads; }
 
+    /// Enable/disable packing the constraints between pairs of 6-DOF objects (ex. rigid body
+    /// contacts and links) in a ChConstraintBatch, processed without virtual calls and with
+    /// SIMD kernels (default: false). The batch is used by ShurComplementProduct() and by some
+    /// iterative solvers, only if it covers all active constraints.
+    void SetUseConstraintBatch(bool val) { use_constraint_batch = val; }
+    bool GetUseConstraintBatch() const { return use_constraint_batch; }
+
+    /// Repack the constraint batch, if in use. Solvers must call this after updating the
+    /// auxiliary data of constraints (see ChConstraint::Update_auxiliary()).
+    /// Returns true if the batch can be used, i.e. it covers all active constraints.
+    virtual bool UpdateConstraintBatch();
+
+    /// Access the constraint batch (up to date if UpdateConstraintBatch() returned true).
+    const ChConstraintBatch& GetConstraintBatch() const { return constraint_batch; }
+
+    /// Enable/disable the incremental assembly of the system matrix Z in ConvertToMatrixForm()
+    /// (default: false). If enabled, the sparsity pattern of Z and the destination of all the
+    /// elements of the variables, stiffness and constraint blocks are recorded, so that the
+    /// following assemblies only scatter the new values (in parallel) in the same pattern; the
+    /// pattern is rebuilt only if it changed. Only used if Z is a (row-major) ChCSR3Matrix.
+    void SetUseSparsityPatternCache(bool val) {
+        use_sparsity_pattern_cache = val;
+        sparsity_pattern_cache.Clear();
+    }
+    bool GetUseSparsityPatternCache() const { return use_sparsity_pattern_cache; }
+
+    /// Access the cache of the sparsity pattern of Z (ex. for statistics on rebuilds).
+    const ChSparsityPatternCache& GetSparsityPatternCache() const { return sparsity_pattern_cache; }
+
     //
     // LOGGING/OUTPUT/ETC.
     //
@@ -357,6 +429,7 @@ class ChApi ChSystemDescriptor {
                                      bool skip_contacts_uv = false);
 
     /// Create and return the assembled system matrix and RHS vector.
+    /// See SetUseSparsityPatternCache() for the incremental assembly of Z.
     virtual void ConvertToMatrixForm(ChSparseMatrix* Z,  ///< [out] assembled system matrix
                                      ChMatrix<>* rhs     ///< [out] assembled RHS vector
                                      );
@@ -34,8 +34,16 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* mintegrable)
       h_min(1e-10),
       h(1e6),
       num_successful_steps(0),
-      modified_Newton(true) {
+      modified_Newton(true),
+      jacobian_reuse(false),
+      reuse_max_rate(0.5),
+      reuse_max_h_ratio(1.5),
+      conv_norm(0),
+      h_setup(0),
+      nv_setup(0),
+      nc_setup(0) {
     SetAlpha(-0.2);  // default: some dissipation
+    ResetReuseCounters();
 }
 
 void ChTimestepperHHT::SetAlpha(double malpha) {
@@ -48,6 +56,13 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
     beta = pow((1.0 - alpha), 2) / 4.0;
 }
 
+void ChTimestepperHHT::ResetReuseCounters() {
+    num_total_setups = 0;
+    num_total_reuses = 0;
+    num_rate_refactors = 0;
+    num_stepsize_refactors = 0;
+}
+
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
     // Downcast
@@ -107,13 +122,25 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
+    // If Jacobian reuse is enabled, the matrix from the previous step is kept at the beginning of a step,
+    // unless the problem size or the stepsize changed (see SetJacobianReuse).
+    bool reuse = jacobian_reuse && modified_Newton;
     call_setup = true;
+    if (reuse && h_setup > 0 && nv_setup == mintegrable->GetNcoords_v() && nc_setup == mintegrable->GetNconstr()) {
+        if (h > h_setup * reuse_max_h_ratio || h * reuse_max_h_ratio < h_setup) {
+            num_stepsize_refactors++;
+            if (verbose)
+                GetLog() << " HHT stepsize changed, update matrix.\n";
+        } else {
+            call_setup = false;
+        }
+    }
 
     // Loop until reaching final time
     while (T < tfinal) {
         double scaling_factor = scaling ? beta * h * h : 1;
         Prepare(mintegrable, scaling_factor);
+        matrix_is_current = false;
 
         // Newton-Raphson for state at T+h
         bool converged;
@@ -131,15 +158,28 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                num_total_setups++;
+            } else {
+                num_total_reuses++;
             }
+            bool setup_called = call_setup;
 
             // If using modified Newton, do not call Setup again
             call_setup = !modified_Newton;
 
             // Check convergence
+            double prev_norm = conv_norm;
             converged = CheckConvergence(scaling_factor);
             if (converged)
                 break;
+
+            // If reusing an out-of-date matrix, update it if the convergence rate is too slow
+            if (reuse && !setup_called && it > 0 && conv_norm > reuse_max_rate * prev_norm) {
+                call_setup = true;
+                num_rate_refactors++;
+                if (verbose)
+                    GetLog() << " HHT slow convergence (rate = " << conv_norm / prev_norm << "), update matrix.\n";
+            }
         }
 
         if (converged) {
@@ -168,8 +208,7 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-        /*
-        } else if (!matrix_is_current) {
+        } else if (reuse && !matrix_is_current) {
             // ------ NR did not converge but the matrix was out-of-date
 
             // reset the count of successive successful steps
@@ -181,7 +220,6 @@ void ChTimestepperHHT::Advance(const double dt) {
             }
 
             call_setup = true;
-        */
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -348,8 +386,14 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable, double scaling
             break;
     }
 
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
+    // If Setup was called at this iteration, mark the Newton matrix as evaluated during this step attempt
+    // and record the stepsize and problem size it corresponds to
+    if (call_setup) {
+        matrix_is_current = true;
+        h_setup = h;
+        nv_setup = integrable->GetNcoords_v();
+        nc_setup = integrable->GetNconstr();
+    }
 }
 
 // Convergence test
@@ -377,6 +421,8 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
             if ((R_nrm < abstolS && Qc_nrm < abstolL) || (Da_nrm < 1 && Dl_nrm < 1))
                 converged = true;
 
+            conv_norm = ChMax(Da_nrm, Dl_nrm);
+
             break;
         }
         case POSITION: {
@@ -397,6 +443,8 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
             if (Dx_nrm < 1 && Dl_nrm < 1)
                 converged = true;
 
+            conv_norm = ChMax(Dx_nrm, Dl_nrm);
+
             break;
         }
     }
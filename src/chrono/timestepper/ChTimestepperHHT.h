@@ -64,9 +64,21 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     int num_successful_steps;     ///< number of successful steps
 
     bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
+    bool matrix_is_current;  ///< was the Newton matrix evaluated during the current step attempt?
     bool call_setup;         ///< should the solver's Setup function be called?
 
+    bool jacobian_reuse;         ///< reuse the Newton matrix across steps?
+    double reuse_max_rate;       ///< maximum Newton convergence rate with an out-of-date matrix
+    double reuse_max_h_ratio;    ///< maximum stepsize change ratio with an out-of-date matrix
+    double conv_norm;            ///< norm of the last Newton update (used to estimate the convergence rate)
+    double h_setup;              ///< stepsize at the last Setup call (0 if none)
+    int nv_setup;                ///< number of velocity coordinates at the last Setup call
+    int nc_setup;                ///< number of constraints at the last Setup call
+    int num_total_setups;        ///< cumulative number of calls to the solver's Setup function
+    int num_total_reuses;        ///< cumulative number of solves with a matrix from a previous iteration or step
+    int num_rate_refactors;      ///< cumulative number of Setup calls triggered by slow convergence
+    int num_stepsize_refactors;  ///< cumulative number of Setup calls triggered by a stepsize change
+
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
 
@@ -120,6 +132,45 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Modified Newton iteration is enabled by default.
     void SetModifiedNewton(bool val) { modified_Newton = val; }
 
+    /// Enable/disable reuse of the Newton matrix across steps (default: false).
+    /// If enabled (and if using modified Newton), the Newton matrix evaluated, assembled, and factorized
+    /// at a previous step is kept for the following steps, and re-evaluated only if:
+    ///   - the Newton convergence rate |D_k|/|D_(k-1)| exceeds the threshold set with SetJacobianReuseRate();
+    ///   - the stepsize changed, relative to the one used for the matrix, by more than the ratio set with
+    ///     SetJacobianReuseStepRatio();
+    ///   - the number of unknowns changed;
+    ///   - the Newton iteration does not converge with an out-of-date matrix (the step is then re-attempted).
+    /// This pays off with direct solvers (ex. ChSolverMKL) for slowly varying problems, such as quasi-static
+    /// FEA, where most factorizations can be skipped.
+    void SetJacobianReuse(bool val) { jacobian_reuse = val; }
+
+    /// Set the maximum Newton convergence rate accepted with an out-of-date matrix (default: 0.5).
+    void SetJacobianReuseRate(double rate) { reuse_max_rate = rate; }
+
+    /// Set the maximum change ratio of the stepsize accepted with an out-of-date matrix (default: 1.5).
+    /// The matrix is re-evaluated if the stepsize is larger than ratio*h or smaller than h/ratio, where
+    /// h is the stepsize used when the matrix was evaluated. Must be a value larger than 1.
+    void SetJacobianReuseStepRatio(double ratio) { reuse_max_h_ratio = ratio; }
+
+    /// Force the evaluation of the Newton matrix at the next step.
+    /// To be called if the solver was used for another analysis since the last step, if Jacobian reuse is enabled.
+    void ForceMatrixUpdate() { h_setup = 0; }
+
+    /// Return the cumulative number of calls to the solver's Setup function.
+    int GetTotalSetupCalls() const { return num_total_setups; }
+
+    /// Return the cumulative number of solves which reused the matrix of a previous iteration or step.
+    int GetTotalReuses() const { return num_total_reuses; }
+
+    /// Return the cumulative number of matrix re-evaluations triggered by slow Newton convergence.
+    int GetNumRateRefactorizations() const { return num_rate_refactors; }
+
+    /// Return the cumulative number of matrix re-evaluations triggered by a stepsize change.
+    int GetNumStepRefactorizations() const { return num_stepsize_refactors; }
+
+    /// Reset the cumulative counters of calls to Setup and of matrix reuses.
+    void ResetReuseCounters();
+
     /// Perform an integration timestep.
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
@@ -0,0 +1,252 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Thread-safe profiler of named code zones, with per-thread ring buffers and
+// export to Chrome trace (chrome://tracing) and CSV summary formats.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+#include "chrono/utils/ChZoneProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+// Events and statistics recorded by a single thread.
+struct ChZoneProfiler::ThreadBuffer {
+    struct Event {
+        const char* name;
+        bool is_type;
+        int depth;
+        double start;     // [us] since epoch
+        double duration;  // [us]
+    };
+    struct OpenZone {
+        const char* name;
+        bool is_type;
+        double start;
+        double child;  // time spent in nested zones [us]
+    };
+    struct Stats {
+        bool is_type;
+        int calls;
+        double total;
+        double self;
+        double max;
+    };
+
+    int tid;
+    std::vector<Event> ring;
+    size_t head;   // next slot to write
+    size_t count;  // number of valid events
+    std::vector<OpenZone> stack;
+    std::unordered_map<const char*, Stats> stats;
+
+    ThreadBuffer(int id, size_t size) : tid(id) { Clear(size); }
+
+    Stats& GetStats(const char* name, bool is_type) {
+        auto found = stats.find(name);
+        if (found == stats.end()) {
+            Stats zero = {is_type, 0, 0, 0, 0};
+            found = stats.insert(std::make_pair(name, zero)).first;
+        }
+        return found->second;
+    }
+
+    void Clear(size_t size) {
+        ring.assign(size, Event());
+        head = 0;
+        count = 0;
+        stack.clear();
+        stats.clear();
+    }
+};
+
+// Readable name of a zone (type names are demangled, when possible).
+static std::string ZoneName(const char* name, bool is_type) {
+#ifdef __GNUC__
+    if (is_type) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        if (demangled && status == 0) {
+            std::string result(demangled);
+            std::free(demangled);
+            return result;
+        }
+        std::free(demangled);
+    }
+#endif
+    return std::string(name);
+}
+
+ChZoneProfiler& ChZoneProfiler::GetInstance() {
+    static ChZoneProfiler profiler;
+    return profiler;
+}
+
+ChZoneProfiler::ChZoneProfiler() : enabled(false), buffer_size(65536), epoch(0) {
+    epoch = Now();
+}
+
+double ChZoneProfiler::Now() const {
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double, std::micro>(t).count() - epoch;
+}
+
+ChZoneProfiler::ThreadBuffer* ChZoneProfiler::GetThreadBuffer() {
+    // The profiler is a singleton: a single buffer pointer per thread is needed.
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        threads.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer((int)threads.size(), buffer_size)));
+        buffer = threads.back().get();
+    }
+    return buffer;
+}
+
+void ChZoneProfiler::Reset() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto& buffer : threads)
+        buffer->Clear(buffer_size);
+    epoch = 0;
+    epoch = Now();
+}
+
+void ChZoneProfiler::BeginZone(const char* name, bool is_type) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    ThreadBuffer::OpenZone zone = {name, is_type, Now(), 0};
+    buffer->stack.push_back(zone);
+}
+
+void ChZoneProfiler::EndZone() {
+    double end = Now();
+    ThreadBuffer* buffer = GetThreadBuffer();
+    if (buffer->stack.empty())
+        return;  // zone opened before a Reset()
+
+    ThreadBuffer::OpenZone zone = buffer->stack.back();
+    buffer->stack.pop_back();
+    double duration = end - zone.start;
+    if (!buffer->stack.empty())
+        buffer->stack.back().child += duration;
+
+    // Store the event, overwriting the oldest one if the ring buffer is full
+    ThreadBuffer::Event& event = buffer->ring[buffer->head];
+    event.name = zone.name;
+    event.is_type = zone.is_type;
+    event.depth = (int)buffer->stack.size();
+    event.start = zone.start;
+    event.duration = duration;
+    buffer->head = (buffer->head + 1) % buffer->ring.size();
+    buffer->count = std::min(buffer->count + 1, buffer->ring.size());
+
+    // Accumulate statistics
+    ThreadBuffer::Stats& stats = buffer->GetStats(zone.name, zone.is_type);
+    stats.calls++;
+    stats.total += duration;
+    stats.self += duration - zone.child;
+    stats.max = std::max(stats.max, duration);
+}
+
+void ChZoneProfiler::RecordZoneStats(const std::type_info& type, int calls, double total, double max) {
+    ThreadBuffer::Stats& stats = GetThreadBuffer()->GetStats(type.name(), true);
+    stats.calls += calls;
+    stats.total += total * 1e3;
+    stats.self += total * 1e3;
+    stats.max = std::max(stats.max, max * 1e3);
+}
+
+std::vector<ChZoneProfiler::ZoneSummary> ChZoneProfiler::GetSummary() const {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    // Merge the statistics of all threads, by zone name
+    std::map<std::string, ZoneSummary> merged;
+    for (auto& buffer : threads) {
+        for (auto& entry : buffer->stats) {
+            std::string name = ZoneName(entry.first, entry.second.is_type);
+            auto found = merged.find(name);
+            if (found == merged.end()) {
+                ZoneSummary summary = {name, 0, 0, 0, 0};
+                found = merged.insert(std::make_pair(name, summary)).first;
+            }
+            ZoneSummary& summary = found->second;
+            summary.calls += entry.second.calls;
+            summary.total += entry.second.total * 1e-3;
+            summary.self += entry.second.self * 1e-3;
+            summary.max = std::max(summary.max, entry.second.max * 1e-3);
+        }
+    }
+
+    std::vector<ZoneSummary> result;
+    for (auto& entry : merged)
+        result.push_back(entry.second);
+    std::sort(result.begin(), result.end(),
+              [](const ZoneSummary& a, const ZoneSummary& b) { return a.total > b.total; });
+    return result;
+}
+
+bool ChZoneProfiler::WriteChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.good())
+        return false;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (auto& buffer : threads) {
+        size_t size = buffer->ring.size();
+        for (size_t i = 0; i < buffer->count; i++) {
+            const ThreadBuffer::Event& event = buffer->ring[(buffer->head + size - buffer->count + i) % size];
+            std::string name = ZoneName(event.name, event.is_type);
+            std::replace(name.begin(), name.end(), '"', '\'');
+            std::replace(name.begin(), name.end(), '\\', '/');
+            file << (first ? "" : ",\n") << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid
+                 << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+            first = false;
+        }
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return file.good();
+}
+
+bool ChZoneProfiler::WriteSummaryCSV(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.good())
+        return false;
+
+    file << "zone,calls,total_ms,self_ms,mean_ms,max_ms\n";
+    for (auto& summary : GetSummary()) {
+        std::string name = summary.name;
+        std::replace(name.begin(), name.end(), '"', '\'');
+        file << "\"" << name << "\"," << summary.calls << "," << summary.total << "," << summary.self << ","
+             << summary.total / summary.calls << "," << summary.max << "\n";
+    }
+
+    return file.good();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
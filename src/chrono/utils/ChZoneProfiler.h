@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Thread-safe profiler of named code zones, with per-thread ring buffers and
+// export to Chrome trace (chrome://tracing) and CSV summary formats.
+//
+// =============================================================================
+
+#ifndef CH_ZONE_PROFILER_H
+#define CH_ZONE_PROFILER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Hierarchical profiler of named code zones (e.g. the phases of a time step).
+/// Zones are opened and closed by the thread that runs them, typically through the
+/// CH_PROFILE_ZONE macro, and can be nested. Each thread records the completed zones in its
+/// own ring buffer (the oldest events are overwritten when full) and accumulates per-zone
+/// statistics, so that recording needs no locking. When the profiler is disabled (default),
+/// opening a zone costs a single atomic load.
+/// Zone names must be persistent strings (e.g. literals) or type names; these are stored
+/// by pointer and only copied at export time.
+/// Export and Reset() must be called when no zone is being recorded (e.g. between steps).
+class ChApi ChZoneProfiler {
+  public:
+    /// Statistics of a zone, accumulated over all its calls and all threads.
+    struct ZoneSummary {
+        std::string name;  ///< zone name
+        int calls;         ///< number of calls
+        double total;      ///< total time [ms]
+        double self;       ///< total time not spent in nested zones [ms]
+        double max;        ///< longest call [ms]
+    };
+
+    /// Access the global profiler.
+    static ChZoneProfiler& GetInstance();
+
+    /// Enable/disable recording (default: false).
+    void Enable(bool val) { enabled.store(val, std::memory_order_relaxed); }
+    /// Tell if recording is enabled.
+    bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity of the per-thread ring buffers, in number of events (default: 65536).
+    /// Applies to the buffers of threads that did not record anything yet, and after Reset().
+    void SetBufferSize(size_t n) { buffer_size = (n < 1) ? 1 : n; }
+    size_t GetBufferSize() const { return buffer_size; }
+
+    /// Discard all recorded events and statistics, and restart the clock.
+    void Reset();
+
+    /// Open a zone in the calling thread.
+    void BeginZone(const char* name, bool is_type = false);
+    /// Open a zone named after the given type (e.g. the dynamic type of a physics item).
+    void BeginZone(const std::type_info& type) { BeginZone(type.name(), true); }
+    /// Close the last zone opened by the calling thread.
+    void EndZone();
+
+    /// Add to the statistics of the zone named after the given type a number of calls timed by the
+    /// caller (e.g. accumulated over the iterations of a parallel loop). Times are in milliseconds.
+    /// No event is stored in the trace, and the time is not subtracted from the enclosing zone.
+    void RecordZoneStats(const std::type_info& type, int calls, double total, double max);
+
+    /// Return the statistics of all zones, sorted by decreasing total time.
+    std::vector<ZoneSummary> GetSummary() const;
+
+    /// Write the events still in the ring buffers in Chrome trace JSON format.
+    /// Returns false if the file could not be written.
+    bool WriteChromeTrace(const std::string& filename) const;
+
+    /// Write the zone statistics (see GetSummary()) in CSV format.
+    /// Returns false if the file could not be written.
+    bool WriteSummaryCSV(const std::string& filename) const;
+
+  private:
+    struct ThreadBuffer;
+
+    ChZoneProfiler();
+    ThreadBuffer* GetThreadBuffer();
+    double Now() const;
+
+    std::atomic<bool> enabled;
+    size_t buffer_size;
+    double epoch;  ///< clock origin [us]
+
+    mutable std::mutex registry_mutex;                   ///< protects thread registration
+    std::vector<std::unique_ptr<ThreadBuffer>> threads;  ///< one buffer per recording thread
+};
+
+/// Scoped zone: opens a zone of the global profiler at construction, closes it at destruction.
+/// Nothing is recorded if the profiler was disabled when the zone was opened.
+class ChApi ChProfileZone {
+  public:
+    explicit ChProfileZone(const char* name) : active(ChZoneProfiler::GetInstance().IsEnabled()) {
+        if (active)
+            ChZoneProfiler::GetInstance().BeginZone(name);
+    }
+    explicit ChProfileZone(const std::type_info& type) : active(ChZoneProfiler::GetInstance().IsEnabled()) {
+        if (active)
+            ChZoneProfiler::GetInstance().BeginZone(type);
+    }
+    ~ChProfileZone() {
+        if (active)
+            ChZoneProfiler::GetInstance().EndZone();
+    }
+
+  private:
+    bool active;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_PROFILE_ZONE_CAT2(a, b) a##b
+#define CH_PROFILE_ZONE_CAT(a, b) CH_PROFILE_ZONE_CAT2(a, b)
+
+#ifndef CH_NO_PROFILE
+/// Profile the enclosing scope as a zone with the given name (a string literal or a std::type_info).
+#define CH_PROFILE_ZONE(name) \
+    ::chrono::utils::ChProfileZone CH_PROFILE_ZONE_CAT(ch_profile_zone_, __LINE__)(name)
+#else
+#define CH_PROFILE_ZONE(name)
+#endif
+
+#endif
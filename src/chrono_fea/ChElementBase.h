@@ -119,6 +119,14 @@ class ChApiFea ChElementBase {
     /// values Kfactor, Rfactor, Mfactor.
     virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) = 0;
 
+    /// Enable/disable the matrix-free mode: if enabled, the KRM matrices are not computed when
+    /// loaded, but the first time the solver uses them (see ChMesh::SetMatrixFree()).
+    /// By default, this is not supported.
+    virtual void SetMatrixFree(bool val) {}
+
+    /// Return true if the KRM matrices are computed on demand (matrix-free mode).
+    virtual bool IsMatrixFree() const { return false; }
+
     /// Adds the internal forces, expressed as nodal forces, into the
     /// encapsulated ChVariables, in the 'fb' part: qf+=forces*factor
     /// WILL BE DEPRECATED - see EleIntLoadResidual_F
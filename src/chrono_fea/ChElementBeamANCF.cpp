@@ -73,7 +73,24 @@ void ChElementBeamANCF::SetupInitial(ChSystem* system) {
     m_GaussScaling = (m_lenX * m_thicknessY * m_thicknessZ) / 8;
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
-    // Cache the scaling factor (due to change of integration intervals)
+
+    // Cache the shape functions and initial configuration at the Gauss points used for the internal forces.
+    // The shape functions of the positions scale as 1 and those of the slopes along y and z as the thicknesses;
+    // the derivatives along x are further divided by the length.
+    ChShapeFunctionScales<9> scales;
+    double thickness[3] = {1, m_thicknessY, m_thicknessZ};
+    for (int i = 0; i < 9; i++) {
+        scales.N[i] = thickness[i % 3];
+        scales.Nx[i] = thickness[i % 3] / m_lenX;
+        scales.Ny[i] = 1;
+        scales.Nz[i] = 1;
+    }
+    m_quadrature.Setup(typeid(ChElementBeamANCF), 3, m_d0, scales, [this](ChQuadraturePoint<9>& point) {
+        ShapeFunctions(point.N, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeX(point.Nx, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeY(point.Ny, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeZ(point.Nz, point.x, point.y, point.z);
+    });
 }
 
 // State update.
@@ -247,32 +264,37 @@ void ChElementBeamANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 // for one layer of an ANCF shell element.
 // The 27 entries in the integrand represent the internal force.
 
-class MyForceBeam : public ChIntegrable3D<ChMatrixNM<double, 27, 1> > {
+class MyForceBeam {
   public:
     MyForceBeam(ChElementBeamANCF* element)  // Containing element
         : m_element(element) {}
     ~MyForceBeam() {}
 
+    /// Evaluate (strainD'*strain) at the specified quadrature point.
+    void Evaluate(ChMatrixNM<double, 27, 1>& result,
+                  const ChQuadraturePoint<9>& point,
+                  const ChMatrixNM<double, 3, 3>& j0,
+                  double detJ0);
+
   private:
     ChElementBeamANCF* m_element;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChMatrixNM<double, 27, 1>& result, const double x, const double y, const double z) override;
 };
 
-void MyForceBeam::Evaluate(ChMatrixNM<double, 27, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 9> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 9> Nx;
-    ChMatrixNM<double, 1, 9> Ny;
-    ChMatrixNM<double, 1, 9> Nz;
+void MyForceBeam::Evaluate(ChMatrixNM<double, 27, 1>& result,
+                           const ChQuadraturePoint<9>& point,
+                           const ChMatrixNM<double, 3, 3>& j0,
+                           double detJ0) {
+    // Shape functions and initial configuration (cached)
+    const ChMatrixNM<double, 1, 9>& N = point.N;
+    const ChMatrixNM<double, 1, 9>& Nx = point.Nx;
+    const ChMatrixNM<double, 1, 9>& Ny = point.Ny;
+    const ChMatrixNM<double, 1, 9>& Nz = point.Nz;
+
+    // Initial position vector gradient (for the tangent frame)
     ChMatrixNM<double, 1, 3> Nx_d0;
     ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+    Nx_d0.MatrMultiply(Nx, m_element->m_d0);
+    Ny_d0.MatrMultiply(Ny, m_element->m_d0);
 
     // Transformation : Orthogonal transformation (A and J)
     ChVector<double> G1xG2;  // Cross product of first and second column of
@@ -303,22 +325,11 @@ void MyForceBeam::Evaluate(ChMatrixNM<double, 27, 1>& result, const double x, co
     AA3 = A3;
 
     /// Beta
-    ChMatrixNM<double, 3, 3> j0;
+    // Inverse of rd0 (j0) (position vector gradient: Initial Configuration)
     ChVector<double> j01;
     ChVector<double> j02;
     ChVector<double> j03;
     ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
 
     j01[0] = j0(0, 0);
     j02[0] = j0(1, 0);
@@ -782,13 +793,7 @@ void ChElementBeamANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
     ChMatrixNM<double, 27, 1> Finternal0;
     ChMatrixNM<double, 27, 1> result;
     MyForceBeam formula(this);
-    ChQuadrature::Integrate3D<ChMatrixNM<double, 27, 1> >(result,   // result of integration
-                                                          formula,  // integrand formula
-                                                          -1, 1,    // x limits
-                                                          -1, 1,    // y limits
-                                                          -1, 1,    // z limits
-                                                          3         // order of integration
-                                                          );
+    m_quadrature.Integrate(result, formula);
 
     // Extract vectors and matrices from result of integration
     Finternal0.PasteClippedMatrix(result, 0, 0, 27, 1, 0, 0);
@@ -830,7 +835,7 @@ void ChElementBeamANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
 // The 729 entries in the integrated vector represent the 27x27 Jacobian
 //      Kfactor * [K] + Rfactor * [R]
 
-class MyJacobianBeam : public ChIntegrable3D<ChMatrixNM<double, 729, 1> > {
+class MyJacobianBeam {
   public:
     MyJacobianBeam(ChElementBeamANCF* element,  // Containing element
                    double Kfactor,              // Scaling coefficient for stiffness component
@@ -838,28 +843,33 @@ class MyJacobianBeam : public ChIntegrable3D<ChMatrixNM<double, 729, 1> > {
                    )
         : m_element(element), m_Kfactor(Kfactor), m_Rfactor(Rfactor) {}
 
+    // Evaluate integrand at the specified quadrature point.
+    void Evaluate(ChMatrixNM<double, 729, 1>& result,
+                  const ChQuadraturePoint<9>& point,
+                  const ChMatrixNM<double, 3, 3>& j0,
+                  double detJ0);
+
   private:
     ChElementBeamANCF* m_element;
     double m_Kfactor;
     double m_Rfactor;
-
-    // Evaluate integrand at the specified point.
-    virtual void Evaluate(ChMatrixNM<double, 729, 1>& result, const double x, const double y, const double z) override;
 };
 
-void MyJacobianBeam::Evaluate(ChMatrixNM<double, 729, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 9> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 9> Nx;
-    ChMatrixNM<double, 1, 9> Ny;
-    ChMatrixNM<double, 1, 9> Nz;
+void MyJacobianBeam::Evaluate(ChMatrixNM<double, 729, 1>& result,
+                              const ChQuadraturePoint<9>& point,
+                              const ChMatrixNM<double, 3, 3>& j0,
+                              double detJ0) {
+    // Shape functions and initial configuration (cached)
+    const ChMatrixNM<double, 1, 9>& N = point.N;
+    const ChMatrixNM<double, 1, 9>& Nx = point.Nx;
+    const ChMatrixNM<double, 1, 9>& Ny = point.Ny;
+    const ChMatrixNM<double, 1, 9>& Nz = point.Nz;
+
+    // Initial position vector gradient (for the tangent frame)
     ChMatrixNM<double, 1, 3> Nx_d0;
     ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+    Nx_d0.MatrMultiply(Nx, m_element->m_d0);
+    Ny_d0.MatrMultiply(Ny, m_element->m_d0);
 
     // Transformation : Orthogonal transformation (A and J)
     ChVector<double> G1xG2;  // Cross product of first and second column of
@@ -891,22 +901,11 @@ void MyJacobianBeam::Evaluate(ChMatrixNM<double, 729, 1>& result, const double x
     AA3 = A3;
 
     /// Beta
-    ChMatrixNM<double, 3, 3> j0;
+    // Inverse of rd0 (j0) (position vector gradient: Initial Configuration)
     ChVector<double> j01;
     ChVector<double> j02;
     ChVector<double> j03;
     ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
 
     j01[0] = j0(0, 0);
     j02[0] = j0(1, 0);
@@ -1514,13 +1513,7 @@ void ChElementBeamANCF::ComputeInternalJacobians(double Kfactor, double Rfactor)
     // Jacobian from diagonal terms D0 (three-dimensional)
     ChMatrixNM<double, 729, 1> result;
     MyJacobianBeam formula(this, Kfactor, Rfactor);
-    ChQuadrature::Integrate3D<ChMatrixNM<double, 729, 1> >(result,   // result of integration
-                                                           formula,  // integrand formula
-                                                           -1, 1,    // x limits
-                                                           -1, 1,    // y limits
-                                                           -1, 1,    // z limits
-                                                           3         // order of integration
-                                                           );
+    m_quadrature.Integrate(result, formula);
 
     // Extract matrices from result of integration
     ChMatrixNM<double, 27, 27> KTE;
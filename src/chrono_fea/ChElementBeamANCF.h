@@ -27,6 +27,7 @@
 #include "chrono_fea/ChApiFEA.h"
 #include "chrono_fea/ChElementBeam.h"
 #include "chrono_fea/ChNodeFEAxyzDD.h"
+#include "chrono_fea/ChQuadratureCache.h"
 #include "chrono_fea/ChUtilsFEA.h"
 
 namespace chrono {
@@ -198,6 +199,7 @@ class ChApiFea ChElementBeamANCF : public ChElementBeam, public ChLoadableU, pub
     ChMatrixNM<double, 9, 3> m_d;                           ///< current nodal coordinates
     ChMatrixNM<double, 9, 9> m_ddT;                         ///< matrix m_d * m_d^T
     ChMatrixNM<double, 27, 1> m_d_dt;                       ///< current nodal velocities
+    ChQuadratureCache3D<9> m_quadrature;                    ///< shape functions and initial configuration at Gauss points
     std::shared_ptr<ChMaterialBeamANCF> m_material;         ///< beam material
     StrainFormulation m_strain_form;                        ///< Strain formulation
 
@@ -88,6 +88,31 @@ void ChElementBrick_9::SetupInitial(ChSystem* system) {
 
     m_GaussScaling = (GetDimensions().x() * GetDimensions().y() * GetDimensions().z()) / 8;
 
+    // Cache the shape functions and initial configuration at the Gauss points used for the internal forces.
+    // The shape functions scale with the element dimensions: corner nodes as 1 (derivatives as 1/a, 1/b, 1/c),
+    // curvature terms as a^2, b^2, c^2 (derivatives as a, b, c).
+    double a = GetDimensions().x();
+    double b = GetDimensions().y();
+    double c = GetDimensions().z();
+    ChShapeFunctionScales<11> scales;
+    for (int i = 0; i < 8; i++) {
+        scales.N[i] = 1;
+        scales.Nx[i] = 1 / a;
+        scales.Ny[i] = 1 / b;
+        scales.Nz[i] = 1 / c;
+    }
+    double curvature[3] = {a, b, c};
+    for (int i = 8; i < 11; i++) {
+        scales.N[i] = curvature[i - 8] * curvature[i - 8];
+        scales.Nx[i] = scales.Ny[i] = scales.Nz[i] = curvature[i - 8];
+    }
+    m_quadrature.Setup(typeid(ChElementBrick_9), 2, m_d0, scales, [this](ChQuadraturePoint<11>& point) {
+        ShapeFunctions(point.N, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeX(point.Nx, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeY(point.Ny, point.x, point.y, point.z);
+        ShapeFunctionsDerivativeZ(point.Nz, point.x, point.y, point.z);
+    });
+
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
 }
@@ -285,55 +310,42 @@ void ChElementBrick_9::ComputeGravityForce(const ChVector<>& g_acc) {
 // -----------------------------------------------------------------------------
 
 // Private class for quadrature of internal forces
-class MyForceBrick9 : public ChIntegrable3D<ChMatrixNM<double, 33, 1>> {
+class MyForceBrick9 {
   public:
     MyForceBrick9(ChElementBrick_9* element) : m_element(element) {}
     ~MyForceBrick9() {}
 
+    /// Evaluate integrand at the specified quadrature point.
+    void Evaluate(ChMatrixNM<double, 33, 1>& result,
+                  const ChQuadraturePoint<11>& point,
+                  const ChMatrixNM<double, 3, 3>& j0,
+                  double detJ0);
+
   private:
     ChElementBrick_9* m_element;
-    virtual void Evaluate(ChMatrixNM<double, 33, 1>& result, const double x, const double y, const double z) override;
 };
 
 // Evaluate integrand at the specified point
-void MyForceBrick9::Evaluate(ChMatrixNM<double, 33, 1>& result, const double x, const double y, const double z) {
-    ChMatrixNM<double, 1, 11> N;
-    m_element->ShapeFunctions(N, x, y, z);
+void MyForceBrick9::Evaluate(ChMatrixNM<double, 33, 1>& result,
+                             const ChQuadraturePoint<11>& point,
+                             const ChMatrixNM<double, 3, 3>& j0,
+                             double detJ0) {
+    // Shape functions and initial configuration (cached)
+    const ChMatrixNM<double, 1, 11>& Nx = point.Nx;
+    const ChMatrixNM<double, 1, 11>& Ny = point.Ny;
+    const ChMatrixNM<double, 1, 11>& Nz = point.Nz;
 
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 11> Nx;
-    ChMatrixNM<double, 1, 11> Ny;
-    ChMatrixNM<double, 1, 11> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
     ChMatrixNM<double, 1, 3> Nx_d;
     ChMatrixNM<double, 1, 3> Ny_d;
     ChMatrixNM<double, 1, 3> Nz_d;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    Nx_d = Nx * m_element->m_d;
-    Ny_d = Ny * m_element->m_d;
-    Nz_d = Nz * m_element->m_d;
+    Nx_d.MatrMultiply(Nx, m_element->m_d);
+    Ny_d.MatrMultiply(Ny, m_element->m_d);
+    Nz_d.MatrMultiply(Nz, m_element->m_d);
 
     double detJ = Nx_d(0, 0) * Ny_d(0, 1) * Nz_d(0, 2) + Ny_d(0, 0) * Nz_d(0, 1) * Nx_d(0, 2) +
                   Nz_d(0, 0) * Nx_d(0, 1) * Ny_d(0, 2) - Nx_d(0, 2) * Ny_d(0, 1) * Nz_d(0, 0) -
                   Ny_d(0, 2) * Nz_d(0, 1) * Nx_d(0, 0) - Nz_d(0, 2) * Nx_d(0, 1) * Ny_d(0, 0);
 
-    ChMatrixNM<double, 3, 3> j0;
-
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0(0, 1) * Nz_d0(0, 2) - Nz_d0(0, 1) * Ny_d0(0, 2);
-    j0(0, 1) = Ny_d0(0, 2) * Nz_d0(0, 0) - Ny_d0(0, 0) * Nz_d0(0, 2);
-    j0(0, 2) = Ny_d0(0, 0) * Nz_d0(0, 1) - Nz_d0(0, 0) * Ny_d0(0, 1);
-    j0(1, 0) = Nz_d0(0, 1) * Nx_d0(0, 2) - Nx_d0(0, 1) * Nz_d0(0, 2);
-    j0(1, 1) = Nz_d0(0, 2) * Nx_d0(0, 0) - Nx_d0(0, 2) * Nz_d0(0, 0);
-    j0(1, 2) = Nz_d0(0, 0) * Nx_d0(0, 1) - Nz_d0(0, 1) * Nx_d0(0, 0);
-    j0(2, 0) = Nx_d0(0, 1) * Ny_d0(0, 2) - Ny_d0(0, 1) * Nx_d0(0, 2);
-    j0(2, 1) = Ny_d0(0, 0) * Nx_d0(0, 2) - Nx_d0(0, 0) * Ny_d0(0, 2);
-    j0(2, 2) = Nx_d0(0, 0) * Ny_d0(0, 1) - Ny_d0(0, 0) * Nx_d0(0, 1);
-    j0.MatrDivScale(detJ0);
-
     // Do we need to account for deformed initial configuration in DefF?
     ChMatrixNM<double, 3, 3> DefF;
     DefF(0, 0) = Nx_d(0, 0);
@@ -1287,13 +1299,7 @@ void ChElementBrick_9::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
     m_InteCounter = 0;
     ChMatrixNM<double, 33, 1> result;
     MyForceBrick9 formula(this);
-    ChQuadrature::Integrate3D<ChMatrixNM<double, 33, 1>>(result,   // result of integration
-                                                         formula,  // integrand formula
-                                                         -1, 1,    // x limits
-                                                         -1, 1,    // y limits
-                                                         -1, 1,    // z limits
-                                                         2         // order of integration
-                                                         );
+    m_quadrature.Integrate(result, formula);
     Fi -= result;
     if (m_gravity_on) {
         Fi += m_GravForce;
@@ -1305,7 +1311,7 @@ void ChElementBrick_9::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
 // -----------------------------------------------------------------------------
 
 // Private class for quadrature of the Jacobian of internal forces
-class MyJacobianBrick9 : public ChIntegrable3D<ChMatrixNM<double, 33, 33>> {
+class MyJacobianBrick9 {
   public:
     MyJacobianBrick9(ChElementBrick_9* element,  // Associated element
                      double Kfactor,             // Scaling coefficient for stiffness component
@@ -1313,54 +1319,41 @@ class MyJacobianBrick9 : public ChIntegrable3D<ChMatrixNM<double, 33, 33>> {
                      )
         : m_element(element), m_Kfactor(Kfactor), m_Rfactor(Rfactor) {}
 
+    /// Evaluate integrand at the specified quadrature point.
+    void Evaluate(ChMatrixNM<double, 33, 33>& result,
+                  const ChQuadraturePoint<11>& point,
+                  const ChMatrixNM<double, 3, 3>& j0,
+                  double detJ0);
+
   private:
     ChElementBrick_9* m_element;
     double m_Kfactor;
     double m_Rfactor;
     ChMatrixNM<double, 33, 33> m_KTE1;
     ChMatrixNM<double, 33, 33> m_KTE2;
-
-    virtual void Evaluate(ChMatrixNM<double, 33, 33>& result, const double x, const double y, const double z) override;
 };
 
 // Evaluate integrand at the specified point
-void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result, const double x, const double y, const double z) {
-    ChMatrixNM<double, 1, 11> N;
-    m_element->ShapeFunctions(N, x, y, z);
+void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result,
+                                const ChQuadraturePoint<11>& point,
+                                const ChMatrixNM<double, 3, 3>& j0,
+                                double detJ0) {
+    // Shape functions and initial configuration (cached)
+    const ChMatrixNM<double, 1, 11>& Nx = point.Nx;
+    const ChMatrixNM<double, 1, 11>& Ny = point.Ny;
+    const ChMatrixNM<double, 1, 11>& Nz = point.Nz;
 
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 11> Nx;
-    ChMatrixNM<double, 1, 11> Ny;
-    ChMatrixNM<double, 1, 11> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
     ChMatrixNM<double, 1, 3> Nx_d;
     ChMatrixNM<double, 1, 3> Ny_d;
     ChMatrixNM<double, 1, 3> Nz_d;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    Nx_d = Nx * m_element->m_d;
-    Ny_d = Ny * m_element->m_d;
-    Nz_d = Nz * m_element->m_d;
+    Nx_d.MatrMultiply(Nx, m_element->m_d);
+    Ny_d.MatrMultiply(Ny, m_element->m_d);
+    Nz_d.MatrMultiply(Nz, m_element->m_d);
 
     double detJ = Nx_d(0, 0) * Ny_d(0, 1) * Nz_d(0, 2) + Ny_d(0, 0) * Nz_d(0, 1) * Nx_d(0, 2) +
                   Nz_d(0, 0) * Nx_d(0, 1) * Ny_d(0, 2) - Nx_d(0, 2) * Ny_d(0, 1) * Nz_d(0, 0) -
                   Ny_d(0, 2) * Nz_d(0, 1) * Nx_d(0, 0) - Nz_d(0, 2) * Nx_d(0, 1) * Ny_d(0, 0);
 
-    ChMatrixNM<double, 3, 3> j0;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0(0, 1) * Nz_d0(0, 2) - Nz_d0(0, 1) * Ny_d0(0, 2);
-    j0(0, 1) = Ny_d0(0, 2) * Nz_d0(0, 0) - Ny_d0(0, 0) * Nz_d0(0, 2);
-    j0(0, 2) = Ny_d0(0, 0) * Nz_d0(0, 1) - Nz_d0(0, 0) * Ny_d0(0, 1);
-    j0(1, 0) = Nz_d0(0, 1) * Nx_d0(0, 2) - Nx_d0(0, 1) * Nz_d0(0, 2);
-    j0(1, 1) = Nz_d0(0, 2) * Nx_d0(0, 0) - Nx_d0(0, 2) * Nz_d0(0, 0);
-    j0(1, 2) = Nz_d0(0, 0) * Nx_d0(0, 1) - Nz_d0(0, 1) * Nx_d0(0, 0);
-    j0(2, 0) = Nx_d0(0, 1) * Ny_d0(0, 2) - Ny_d0(0, 1) * Nx_d0(0, 2);
-    j0(2, 1) = Ny_d0(0, 0) * Nx_d0(0, 2) - Nx_d0(0, 0) * Ny_d0(0, 2);
-    j0(2, 2) = Nx_d0(0, 0) * Ny_d0(0, 1) - Ny_d0(0, 0) * Nx_d0(0, 1);
-    j0.MatrDivScale(detJ0);
-
     // Current deformation gradient matrix
     ChMatrixNM<double, 3, 3> DefF;
 
@@ -2571,13 +2564,7 @@ void ChElementBrick_9::ComputeInternalJacobians(double Kfactor, double Rfactor)
     m_InteCounter = 0;
     ChMatrixNM<double, 33, 33> result;
     MyJacobianBrick9 formula(this, Kfactor, Rfactor);
-    ChQuadrature::Integrate3D<ChMatrixNM<double, 33, 33>>(result,   // result of integration
-                                                          formula,  // integrand formula
-                                                          -1, 1,    // x limits
-                                                          -1, 1,    // y limits
-                                                          -1, 1,    // z limits
-                                                          2         // order of integration
-                                                          );
+    m_quadrature.Integrate(result, formula);
     // Accumulate Jacobian
     m_JacobianMatrix += result;
 }
@@ -22,6 +22,7 @@
 #include "chrono_fea/ChElementGeneric.h"
 #include "chrono_fea/ChNodeFEAcurv.h"
 #include "chrono_fea/ChNodeFEAxyz.h"
+#include "chrono_fea/ChQuadratureCache.h"
 
 namespace chrono {
 namespace fea {
@@ -257,6 +258,7 @@ class ChApiFea ChElementBrick_9 : public ChElementGeneric, public ChLoadableUVW
     ChMatrixNM<double, 8, 1> m_Alpha_Plast;   ///< hardening alpha parameter
     ChMatrixNM<double, 9, 8> m_CCPinv_Plast;  ///< strain tensor for each integration point
     int m_InteCounter;                        ///< Integration point counter (up to 8)
+    ChQuadratureCache3D<11> m_quadrature;     ///< shape functions and initial configuration at integration points
 
     ChVectorDynamic<double> m_DPVector1;  /// xtab of hardening parameter look-up table
     ChVectorDynamic<double> m_DPVector2;  /// ytab of hardening parameter look-up table
@@ -32,17 +32,47 @@ namespace fea {
 /// This means that most FEA elements inherited from ChElementGeneric
 /// need to implement at most the following two fundamental methods:
 ///	ComputeKRMmatricesGlobal(), ComputeInternalForces()
-class ChApiFea ChElementGeneric : public ChElementBase {
+/// In matrix-free mode, the KRM matrix is computed with ComputeKRMmatricesGlobal() by the ChKblock,
+/// the first time the solver uses it after each KRMmatricesLoad().
+class ChApiFea ChElementGeneric : public ChElementBase, protected ChKblockGeneric::MatrixProvider {
   protected:
     ChKblockGeneric Kmatr;
 
+  private:
+    double m_Kfactor;  ///< scaling of K in the KRM matrix (matrix-free mode)
+    double m_Rfactor;  ///< scaling of R in the KRM matrix (matrix-free mode)
+    double m_Mfactor;  ///< scaling of M in the KRM matrix (matrix-free mode)
+
   public:
-    ChElementGeneric(){};
+    ChElementGeneric() : m_Kfactor(0), m_Rfactor(0), m_Mfactor(0){};
+    ChElementGeneric(const ChElementGeneric& other) : ChElementBase(other), Kmatr(other.Kmatr) {
+        m_Kfactor = other.m_Kfactor;
+        m_Rfactor = other.m_Rfactor;
+        m_Mfactor = other.m_Mfactor;
+        SetMatrixFree(other.IsMatrixFree());
+    }
     virtual ~ChElementGeneric(){};
 
+    /// Assignment operator: the KRM block of a matrix-free element is provided by this element.
+    ChElementGeneric& operator=(const ChElementGeneric& other) {
+        ChElementBase::operator=(other);
+        Kmatr = other.Kmatr;
+        m_Kfactor = other.m_Kfactor;
+        m_Rfactor = other.m_Rfactor;
+        m_Mfactor = other.m_Mfactor;
+        SetMatrixFree(other.IsMatrixFree());
+        return *this;
+    }
+
     /// Access the proxy to stiffness, for sparse solver
     ChKblockGeneric& Kstiffness() { return Kmatr; }
 
+    /// Enable/disable the matrix-free mode (see ChKblockGeneric::SetMatrixProvider()).
+    virtual void SetMatrixFree(bool val) override { Kmatr.SetMatrixProvider(val ? this : nullptr); }
+
+    /// Return true if the KRM matrix is computed when the solver first uses it.
+    virtual bool IsMatrixFree() const override { return Kmatr.IsMatrixFree(); }
+
     //
     // Functions for interfacing to the state bookkeeping
     //
@@ -75,7 +105,15 @@ class ChApiFea ChElementGeneric : public ChElementBase {
     /// Adds the current stiffness K and damping R and mass M matrices in encapsulated
     /// ChKblock item(s), if any. The K, R, M matrices are load with scaling
     /// values Kfactor, Rfactor, Mfactor.
+    /// In matrix-free mode, only the scaling values are recorded, and the matrix of the last load is discarded.
     virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) override {
+        if (Kmatr.IsMatrixFree()) {
+            m_Kfactor = Kfactor;
+            m_Rfactor = Rfactor;
+            m_Mfactor = Mfactor;
+            Kmatr.InvalidateMatrix();
+            return;
+        }
         this->ComputeKRMmatricesGlobal(*this->Kmatr.Get_K(), Kfactor, Rfactor, Mfactor);
     }
 
@@ -91,6 +129,12 @@ class ChApiFea ChElementGeneric : public ChElementBase {
     /// (This is a default (VERY UNOPTIMAL) book keeping so that in children classes you can avoid
     /// implementing this VariablesFbIncrementMq function, unless you need faster code.)
     virtual void VariablesFbIncrementMq() override;
+
+  protected:
+    /// Compute the KRM matrix, with the scaling values of the last KRMmatricesLoad() (matrix-free mode).
+    virtual void ComputeMatrix(ChMatrix<double>& K) override {
+        this->ComputeKRMmatricesGlobal(K, m_Kfactor, m_Rfactor, m_Mfactor);
+    }
 };
 
 /// @} fea_elements
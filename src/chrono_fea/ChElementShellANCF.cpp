@@ -110,6 +110,9 @@ void ChElementShellANCF::SetupInitial(ChSystem* system) {
     // Cache the scaling factor (due to change of integration intervals)
     m_GaussScaling = (m_lenX * m_lenY * m_thickness) / 8;
 
+    // Cache the shape functions and initial configuration data at the Gauss points
+    ComputeGaussPoints();
+
     // Compute mass matrix and gravitational forces (constant)
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
@@ -280,161 +283,184 @@ void ChElementShellANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 }
 
 // -----------------------------------------------------------------------------
-// Elastic force calculation
+// Gauss point data
 // -----------------------------------------------------------------------------
 
-// The class MyForce provides the integrand for the calculation of the internal forces
-// for one layer of an ANCF shell element.
-// The first 24 entries in the integrand represent the internal force.
-// The next 5 entries represent the residual of the EAS nonlinear system.
-// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
-// Capabilities of this class include: application of enhanced assumed strain (EAS) and
-// assumed natural strain (ANS) formulations to avoid thickness and (tranvese and in-plane)
-// shear locking. This implementation also features a composite material implementation
-// that allows for selecting a number of layers over the element thickness; each of which
-// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class MyForce : public ChIntegrable3D<ChMatrixNM<double, 54, 1> > {
-  public:
-    MyForce(ChElementShellANCF* element,         // Containing element
-            size_t kl,                           // Current layer index
-            ChMatrixNM<double, 5, 1>* alpha_eas  // Vector of internal parameters for EAS formulation
-            )
-        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
-    ~MyForce() {}
-
-  private:
-    ChElementShellANCF* m_element;
-    size_t m_kl;
-    ChMatrixNM<double, 5, 1>* m_alpha_eas;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) override;
-};
-
-void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 8> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 8> Nx;
-    ChMatrixNM<double, 1, 8> Ny;
-    ChMatrixNM<double, 1, 8> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
-    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
-    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
-    G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0[0][0];
-    A1.y() = Nx_d0[0][1];
-    A1.z() = Nx_d0[0][2];
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
+// Calculate the quantities at the Gauss points (2x2x2 per layer) which depend only on the initial
+// configuration: shape functions and their derivatives, orthotropic transformation coefficients,
+// EAS matrix and integration weights. These were previously evaluated at each internal force and
+// Jacobian calculation (and at each iteration of the EAS Newton loop).
+void ChElementShellANCF::ComputeGaussPoints() {
+    const std::vector<double>& roots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weights = ChQuadrature::GetStaticTables()->Weight[1];
 
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
+    m_gaussPoints.resize(m_numLayers);
 
-    // Coefficients of contravariant transformation
-    beta(0, 0) = Vdot(AA1, j01);
-    beta(1, 0) = Vdot(AA2, j01);
-    beta(2, 0) = Vdot(AA3, j01);
-    beta(3, 0) = Vdot(AA1, j02);
-    beta(4, 0) = Vdot(AA2, j02);
-    beta(5, 0) = Vdot(AA3, j02);
-    beta(6, 0) = Vdot(AA1, j03);
-    beta(7, 0) = Vdot(AA2, j03);
-    beta(8, 0) = Vdot(AA3, j03);
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        // Change of integration interval in the z direction (for this layer)
+        double zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+
+        double theta = m_layers[kl].Get_theta();
+        const ChMatrixNM<double, 6, 6>& T0 = m_layers[kl].Get_T0();
+        double detJ0C = m_layers[kl].Get_detJ0C();
+
+        m_gaussPoints[kl].clear();
+        for (size_t ix = 0; ix < roots.size(); ix++) {
+            for (size_t iy = 0; iy < roots.size(); iy++) {
+                for (size_t iz = 0; iz < roots.size(); iz++) {
+                    double x = roots[ix];
+                    double y = roots[iy];
+                    double z = zc1 * roots[iz] + zc2;
+
+                    GaussPoint gp;
+                    ShapeFunctions(gp.N, x, y, z);
+
+                    // Determinant of position vector gradient matrix: Initial configuration
+                    ChMatrixNM<double, 1, 3> Nx_d0;
+                    ChMatrixNM<double, 1, 3> Ny_d0;
+                    ChMatrixNM<double, 1, 3> Nz_d0;
+                    double detJ0 = Calc_detJ0(x, y, z, gp.Nx, gp.Ny, gp.Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                    // ANS and EAS shape functions
+                    ChMatrixNM<double, 6, 5> M;
+                    ShapeFunctionANSbilinearShell(gp.S_ANS, x, y);
+                    Basis_M(M, x, y, z);
+
+                    // Tangent frame
+                    ChVector<double> A1(Nx_d0(0, 0), Nx_d0(0, 1), Nx_d0(0, 2));
+                    ChVector<double> A3 = Vcross(A1, ChVector<double>(Ny_d0(0, 0), Ny_d0(0, 1), Ny_d0(0, 2)));
+                    A1.Normalize();
+                    A3.Normalize();
+                    ChVector<double> A2 = Vcross(A3, A1);
+
+                    // Direction for orthotropic material
+                    ChVector<double> AA1 = A1 * cos(theta) + A2 * sin(theta);
+                    ChVector<double> AA2 = -A1 * sin(theta) + A2 * cos(theta);
+                    ChVector<double> AA3 = A3;
+
+                    // Inverse of the initial position vector gradient (j0)
+                    ChMatrixNM<double, 3, 3> j0;
+                    j0(0, 0) = Ny_d0(0, 1) * Nz_d0(0, 2) - Nz_d0(0, 1) * Ny_d0(0, 2);
+                    j0(0, 1) = Ny_d0(0, 2) * Nz_d0(0, 0) - Ny_d0(0, 0) * Nz_d0(0, 2);
+                    j0(0, 2) = Ny_d0(0, 0) * Nz_d0(0, 1) - Nz_d0(0, 0) * Ny_d0(0, 1);
+                    j0(1, 0) = Nz_d0(0, 1) * Nx_d0(0, 2) - Nx_d0(0, 1) * Nz_d0(0, 2);
+                    j0(1, 1) = Nz_d0(0, 2) * Nx_d0(0, 0) - Nx_d0(0, 2) * Nz_d0(0, 0);
+                    j0(1, 2) = Nz_d0(0, 0) * Nx_d0(0, 1) - Nz_d0(0, 1) * Nx_d0(0, 0);
+                    j0(2, 0) = Nx_d0(0, 1) * Ny_d0(0, 2) - Ny_d0(0, 1) * Nx_d0(0, 2);
+                    j0(2, 1) = Ny_d0(0, 0) * Nx_d0(0, 2) - Nx_d0(0, 0) * Ny_d0(0, 2);
+                    j0(2, 2) = Nx_d0(0, 0) * Ny_d0(0, 1) - Ny_d0(0, 0) * Nx_d0(0, 1);
+                    j0.MatrDivScale(detJ0);
+
+                    ChVector<double> j01(j0(0, 0), j0(0, 1), j0(0, 2));
+                    ChVector<double> j02(j0(1, 0), j0(1, 1), j0(1, 2));
+                    ChVector<double> j03(j0(2, 0), j0(2, 1), j0(2, 2));
+
+                    // Coefficients of contravariant transformation
+                    gp.beta(0) = Vdot(AA1, j01);
+                    gp.beta(1) = Vdot(AA2, j01);
+                    gp.beta(2) = Vdot(AA3, j01);
+                    gp.beta(3) = Vdot(AA1, j02);
+                    gp.beta(4) = Vdot(AA2, j02);
+                    gp.beta(5) = Vdot(AA3, j02);
+                    gp.beta(6) = Vdot(AA1, j03);
+                    gp.beta(7) = Vdot(AA2, j03);
+                    gp.beta(8) = Vdot(AA3, j03);
+
+                    // Shape function derivatives with respect to the initial coordinates
+                    for (int ii = 0; ii < 8; ii++) {
+                        for (int k = 0; k < 3; k++) {
+                            gp.Nj0(k, ii) = j0(0, k) * gp.Nx(0, ii) + j0(1, k) * gp.Ny(0, ii) + j0(2, k) * gp.Nz(0, ii);
+                        }
+                    }
+
+                    // Enhanced Assumed Strain
+                    gp.G.MatrMultiply(T0, M);
+                    gp.G.MatrScale(detJ0C / detJ0);
+
+                    gp.weight = detJ0 * m_GaussScaling * zc1 * weights[ix] * weights[iy] * weights[iz];
+
+                    m_gaussPoints[kl].push_back(gp);
+                }
+            }
+        }
+    }
+}
 
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
+// -----------------------------------------------------------------------------
+// Elastic force calculation
+// -----------------------------------------------------------------------------
 
-    // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-    ChMatrixNM<double, 6, 1> strain_EAS = G * (*m_alpha_eas);
+// Calculate the strain and its derivatives with respect to the nodal coordinates at a Gauss point.
+// Capabilities include: application of enhanced assumed strain (EAS) and assumed natural strain (ANS)
+// formulations to avoid thickness and (tranvese and in-plane) shear locking. This implementation also
+// features a composite material implementation that allows for selecting a number of layers over the
+// element thickness; each of which has an independent, user-selected fiber angle (direction for
+// orthotropic constitutive behavior).
+// The EAS contribution (G * alpha) is not included, since it changes during the EAS Newton iterations.
+void ChElementShellANCF::CalcStrain(const GaussPoint& gp,
+                                    ChMatrixNM<double, 6, 1>& strain,
+                                    ChMatrixNM<double, 6, 24>& strainD) {
+    const ChMatrixNM<double, 1, 8>& N = gp.N;
+    const ChMatrixNM<double, 1, 8>& Nx = gp.Nx;
+    const ChMatrixNM<double, 1, 8>& Ny = gp.Ny;
+    const ChMatrixNM<double, 1, 4>& S_ANS = gp.S_ANS;
+    const ChMatrixNM<double, 9, 1>& beta = gp.beta;
 
     ChMatrixNM<double, 8, 1> ddNx;
     ChMatrixNM<double, 8, 1> ddNy;
-    ChMatrixNM<double, 8, 1> ddNz;
-    ddNx.MatrMultiplyT(m_element->m_ddT, Nx);
-    ddNy.MatrMultiplyT(m_element->m_ddT, Ny);
-    ddNz.MatrMultiplyT(m_element->m_ddT, Nz);
+    ddNx.MatrMultiplyT(m_ddT, Nx);
+    ddNy.MatrMultiplyT(m_ddT, Ny);
 
     ChMatrixNM<double, 8, 1> d0d0Nx;
     ChMatrixNM<double, 8, 1> d0d0Ny;
-    ChMatrixNM<double, 8, 1> d0d0Nz;
-    d0d0Nx.MatrMultiplyT(m_element->m_d0d0T, Nx);
-    d0d0Ny.MatrMultiplyT(m_element->m_d0d0T, Ny);
-    d0d0Nz.MatrMultiplyT(m_element->m_d0d0T, Nz);
+    d0d0Nx.MatrMultiplyT(m_d0d0T, Nx);
+    d0d0Ny.MatrMultiplyT(m_d0d0T, Ny);
 
     // Strain component
+    double xddx = 0, xddy = 0, yddy = 0, xd0x = 0, xd0y = 0, yd0y = 0;
+    for (int i = 0; i < 8; i++) {
+        xddx += Nx(0, i) * ddNx(i, 0);
+        xddy += Nx(0, i) * ddNy(i, 0);
+        yddy += Ny(0, i) * ddNy(i, 0);
+        xd0x += Nx(0, i) * d0d0Nx(i, 0);
+        xd0y += Nx(0, i) * d0d0Ny(i, 0);
+        yd0y += Ny(0, i) * d0d0Ny(i, 0);
+    }
+
     ChMatrixNM<double, 6, 1> strain_til;
-    strain_til(0, 0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
-    strain_til(1, 0) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
-    strain_til(2, 0) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3, 0) = N(0, 0) * m_element->m_strainANS(0, 0) + N(0, 2) * m_element->m_strainANS(1, 0) +
-                       N(0, 4) * m_element->m_strainANS(2, 0) + N(0, 6) * m_element->m_strainANS(3, 0);
-    strain_til(4, 0) = S_ANS(0, 2) * m_element->m_strainANS(6, 0) + S_ANS(0, 3) * m_element->m_strainANS(7, 0);
-    strain_til(5, 0) = S_ANS(0, 0) * m_element->m_strainANS(4, 0) + S_ANS(0, 1) * m_element->m_strainANS(5, 0);
+    strain_til(0, 0) = 0.5 * (xddx - xd0x);
+    strain_til(1, 0) = 0.5 * (yddy - yd0y);
+    strain_til(2, 0) = xddy - xd0y;
+    strain_til(3, 0) = N(0, 0) * m_strainANS(0, 0) + N(0, 2) * m_strainANS(1, 0) + N(0, 4) * m_strainANS(2, 0) +
+                       N(0, 6) * m_strainANS(3, 0);
+    strain_til(4, 0) = S_ANS(0, 2) * m_strainANS(6, 0) + S_ANS(0, 3) * m_strainANS(7, 0);
+    strain_til(5, 0) = S_ANS(0, 0) * m_strainANS(4, 0) + S_ANS(0, 1) * m_strainANS(5, 0);
 
-    // For orthotropic material
-    ChMatrixNM<double, 6, 1> strain;
+    // Strain derivative component
+    ChMatrixNM<double, 6, 24> strainD_til;
+    ChMatrixNM<double, 1, 3> tempB3;
+    ChMatrixNM<double, 1, 3> tempB31;
+    tempB3.MatrMultiply(Nx, m_d);
+    tempB31.MatrMultiply(Ny, m_d);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 3; j++) {
+            strainD_til(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
+            strainD_til(1, i * 3 + j) = tempB31(0, j) * Ny(0, i);
+            strainD_til(2, i * 3 + j) = tempB31(0, j) * Nx(0, i) + tempB3(0, j) * Ny(0, i);
+        }
+    }
+    for (int ii = 0; ii < 24; ii++) {
+        // strainD for zz
+        strainD_til(3, ii) = N(0, 0) * m_strainANS_D(0, ii) + N(0, 2) * m_strainANS_D(1, ii) +
+                             N(0, 4) * m_strainANS_D(2, ii) + N(0, 6) * m_strainANS_D(3, ii);
+        // strainD for xz
+        strainD_til(4, ii) = S_ANS(0, 2) * m_strainANS_D(6, ii) + S_ANS(0, 3) * m_strainANS_D(7, ii);
+        // strainD for yz
+        strainD_til(5, ii) = S_ANS(0, 0) * m_strainANS_D(4, ii) + S_ANS(0, 1) * m_strainANS_D(5, ii);
+    }
 
+    // For orthotropic material
     strain(0, 0) = strain_til(0, 0) * beta(0) * beta(0) + strain_til(1, 0) * beta(3) * beta(3) +
                    strain_til(2, 0) * beta(0) * beta(3) + strain_til(3, 0) * beta(6) * beta(6) +
                    strain_til(4, 0) * beta(0) * beta(6) + strain_til(5, 0) * beta(3) * beta(6);
@@ -460,67 +486,6 @@ void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const
                    strain_til(4, 0) * (beta(2) * beta(7) + beta(1) * beta(8)) +
                    strain_til(5, 0) * (beta(5) * beta(7) + beta(4) * beta(8));
 
-    // Strain derivative component
-
-    ChMatrixNM<double, 6, 24> strainD_til;
-    ChMatrixNM<double, 1, 24> tempB;
-    ChMatrixNM<double, 1, 24> tempBB;
-    ChMatrixNM<double, 1, 3> tempB3;
-    ChMatrixNM<double, 1, 3> tempB31;
-    strainD_til.Reset();
-    tempB3.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 0, 0);
-    tempB3.MatrMultiply(Ny, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 1, 0);
-    tempB31.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 2, 0);
-
-    tempBB.Reset();
-    for (int i = 0; i < 4; i++) {
-        int ij = i * 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, i, 0, 1, 24, 0, 0);
-        tempB *= N(0, ij);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 3, 0);  // strainD for zz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 6;
-        int ij1 = i + 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 4, 0);  // strainD for xz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 4;
-        int ij1 = i;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 5, 0);  // strainD for yz
-
-    // For orthotropic material
-    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates. Includes orthotropy
     for (int ii = 0; ii < 24; ii++) {
         strainD(0, ii) = strainD_til(0, ii) * beta(0) * beta(0) + strainD_til(1, ii) * beta(3) * beta(3) +
                          strainD_til(2, ii) * beta(0) * beta(3) + strainD_til(3, ii) * beta(6) * beta(6) +
@@ -535,7 +500,7 @@ void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const
                          strainD_til(5, ii) * (beta(4) * beta(6) + beta(3) * beta(7));
         strainD(3, ii) = strainD_til(0, ii) * beta(2) * beta(2) + strainD_til(1, ii) * beta(5) * beta(5) +
                          strainD_til(2, ii) * beta(2) * beta(5) + strainD_til(3, ii) * beta(8) * beta(8) +
-                         strainD_til(4, ii) * beta(2) * beta(8) + strainD_til(5) * beta(5) * beta(8);
+                         strainD_til(4, ii) * beta(2) * beta(8) + strainD_til(5, ii) * beta(5) * beta(8);
         strainD(4, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(2) + strainD_til(1, ii) * 2.0 * beta(3) * beta(5) +
                          strainD_til(2, ii) * (beta(2) * beta(3) + beta(0) * beta(5)) +
                          strainD_til(3, ii) * 2.0 * beta(6) * beta(8) +
@@ -548,42 +513,15 @@ void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const
                          strainD_til(5, ii) * (beta(5) * beta(7) + beta(4) * beta(8));
     }
 
-    // Enhanced Assumed Strain 2nd
-    strain += strain_EAS;
-
-    // Strain time derivative for structural damping
-    ChMatrixNM<double, 6, 1> DEPS;
-    DEPS.Reset();
-    for (int ii = 0; ii < 24; ii++) {
-        DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+    // Add structural damping (strain time derivative)
+    if (m_Alpha != 0) {
+        for (int k = 0; k < 6; k++) {
+            double deps = 0;
+            for (int ii = 0; ii < 24; ii++)
+                deps += strainD(k, ii) * m_d_dt(ii, 0);
+            strain(k, 0) += m_Alpha * deps;
+        }
     }
-
-    // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
-
-    // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
-
-    // Internal force calculation
-    ChMatrixNM<double, 24, 6> tempC;
-    tempC.MatrTMultiply(strainD, E_eps);
-    ChMatrixNM<double, 24, 1> Fint = (tempC * strain) * (detJ0 * m_element->m_GaussScaling);
-
-    // EAS terms
-    ChMatrixNM<double, 5, 6> temp56;
-    temp56.MatrTMultiply(G, E_eps);
-    ChMatrixNM<double, 5, 1> HE = (temp56 * strain) * (detJ0 * m_element->m_GaussScaling);  // EAS residual
-    ChMatrixNM<double, 5, 5> KALPHA = (temp56 * G) * (detJ0 * m_element->m_GaussScaling);   // EAS Jacobian
-
-    /// Total result vector
-    result.PasteClippedMatrix(Fint, 0, 0, 24, 1, 0, 0);
-    result.PasteClippedMatrix(HE, 0, 0, 5, 1, 24, 0);
-    result.PasteClippedMatrixToVector(KALPHA, 0, 0, 5, 5, 29);
 }
 
 void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
@@ -597,29 +535,45 @@ void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
     Fi.Reset();
 
     for (size_t kl = 0; kl < m_numLayers; kl++) {
-        ChMatrixNM<double, 24, 1> Finternal;
-        ChMatrixNM<double, 5, 1> HE;
+        const std::vector<GaussPoint>& points = m_gaussPoints[kl];
+        size_t num_points = points.size();
+
+        // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
+
+        // The strains (without EAS) and strain derivatives do not depend on the EAS parameters:
+        // evaluate them once, before the Newton loop for EAS. Same for the EAS Jacobian.
+        std::vector<ChMatrixNM<double, 6, 1> > strain0(num_points);
+        std::vector<ChMatrixNM<double, 6, 24> > strainD(num_points);
+        std::vector<ChMatrixNM<double, 5, 6> > GE(num_points);
         ChMatrixNM<double, 5, 5> KALPHA;
+        ChMatrixNM<double, 5, 5> temp55;
+        for (size_t ip = 0; ip < num_points; ip++) {
+            CalcStrain(points[ip], strain0[ip], strainD[ip]);
+            GE[ip].MatrTMultiply(points[ip].G, E_eps);
+            GE[ip].MatrScale(points[ip].weight);
+            temp55.MatrMultiply(GE[ip], points[ip].G);
+            KALPHA += temp55;
+        }
 
         // Initial guess for EAS parameters
         ChMatrixNM<double, 5, 1> alphaEAS = m_alphaEAS[kl];
+        ChMatrixNM<double, 5, 1> alphaEval = alphaEAS;
+
+        ChMatrixNM<double, 6, 1> strain;
+        ChMatrixNM<double, 5, 1> temp51;
 
         // Newton loop for EAS
         for (int count = 0; count < m_maxIterationsEAS; count++) {
-            ChMatrixNM<double, 54, 1> result;
-            MyForce formula(this, kl, &alphaEAS);
-            ChQuadrature::Integrate3D<ChMatrixNM<double, 54, 1> >(result,   // result of integration
-                                                                  formula,  // integrand formula
-                                                                  -1, 1,    // x limits
-                                                                  -1, 1,    // y limits
-                                                                  m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                                  2  // order of integration
-                                                                  );
-
-            // Extract vectors and matrices from result of integration
-            Finternal.PasteClippedMatrix(result, 0, 0, 24, 1, 0, 0);
-            HE.PasteClippedMatrix(result, 24, 0, 5, 1, 0, 0);
-            KALPHA.PasteClippedVectorToMatrix(result, 0, 0, 5, 5, 29);
+            // EAS residual
+            ChMatrixNM<double, 5, 1> HE;
+            for (size_t ip = 0; ip < num_points; ip++) {
+                strain.MatrMultiply(points[ip].G, alphaEAS);
+                strain += strain0[ip];
+                temp51.MatrMultiply(GE[ip], strain);
+                HE += temp51;
+            }
+            alphaEval = alphaEAS;
 
             // Check convergence (residual check)
             double norm_HE = HE.NormTwo();
@@ -639,8 +593,17 @@ void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
                 GetLog() << "  count " << count << "  NormHE " << norm_HE << "\n";
         }
 
-        // Accumulate internal force
-        Fi -= Finternal;
+        // Accumulate internal force (with the EAS parameters of the last residual evaluation)
+        ChMatrixNM<double, 6, 1> stress;
+        ChMatrixNM<double, 24, 1> temp241;
+        for (size_t ip = 0; ip < num_points; ip++) {
+            strain.MatrMultiply(points[ip].G, alphaEval);
+            strain += strain0[ip];
+            stress.MatrMultiply(E_eps, strain);
+            stress.MatrScale(points[ip].weight);
+            temp241.MatrTMultiply(strainD[ip], stress);
+            Fi -= temp241;
+        }
 
         // Cache alphaEAS and KALPHA for use in Jacobian calculation
         m_alphaEAS[kl] = alphaEAS;
@@ -657,395 +620,9 @@ void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
 
-// The class MyJacobian provides the integrand for the calculation of the Jacobians
-// (stiffness and damping matrices) of the internal forces for one layer of an ANCF
-// shell element.
-// The first 576 entries in the integrated vector represent the 24x24 Jacobian
-//      Kfactor * [K] + Rfactor * [R]
-// where K does not include the EAS contribution.
-// The last 120 entries represent the 5x24 cross-dependency matrix.
-class MyJacobian : public ChIntegrable3D<ChMatrixNM<double, 696, 1> > {
-  public:
-    MyJacobian(ChElementShellANCF* element,  // Containing element
-               double Kfactor,               // Scaling coefficient for stiffness component
-               double Rfactor,               // Scaling coefficient for damping component
-               size_t kl                     // Current layer index
-               )
-        : m_element(element), m_Kfactor(Kfactor), m_Rfactor(Rfactor), m_kl(kl) {}
-
-  private:
-    ChElementShellANCF* m_element;
-    double m_Kfactor;
-    double m_Rfactor;
-    size_t m_kl;
-
-    // Evaluate integrand at the specified point.
-    virtual void Evaluate(ChMatrixNM<double, 696, 1>& result, const double x, const double y, const double z) override;
-};
-
-void MyJacobian::Evaluate(ChMatrixNM<double, 696, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 8> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 8> Nx;
-    ChMatrixNM<double, 1, 8> Ny;
-    ChMatrixNM<double, 1, 8> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
-    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
-    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
-    G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0[0][0];
-    A1.y() = Nx_d0[0][1];
-    A1.z() = Nx_d0[0][2];
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
-
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
-
-    // Coefficients of contravariant transformation
-    beta(0, 0) = Vdot(AA1, j01);
-    beta(1, 0) = Vdot(AA2, j01);
-    beta(2, 0) = Vdot(AA3, j01);
-    beta(3, 0) = Vdot(AA1, j02);
-    beta(4, 0) = Vdot(AA2, j02);
-    beta(5, 0) = Vdot(AA3, j02);
-    beta(6, 0) = Vdot(AA1, j03);
-    beta(7, 0) = Vdot(AA2, j03);
-    beta(8, 0) = Vdot(AA3, j03);
-
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
-
-// Enhanced Assumed Strain
-#ifdef CHRONO_HAS_AVX
-    // Referring to test_AVX, expected speed up Vs. non-AVX operation: 1.7x
-    ChMatrixNM<double, 6, 5> G;
-    G.MatrMultiplyAVX(T0, M);
-    G = G * (detJ0C / detJ0);
-#else
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-#endif
-
-    ChMatrixNM<double, 6, 1> strain_EAS = G * m_element->m_alphaEAS[m_kl];
-    ChMatrixNM<double, 8, 1> ddNx;
-    ChMatrixNM<double, 8, 1> ddNy;
-    ChMatrixNM<double, 8, 1> ddNz;
-    ddNx.MatrMultiplyT(m_element->m_ddT, Nx);
-    ddNy.MatrMultiplyT(m_element->m_ddT, Ny);
-    ddNz.MatrMultiplyT(m_element->m_ddT, Nz);
-
-    ChMatrixNM<double, 8, 1> d0d0Nx;
-    ChMatrixNM<double, 8, 1> d0d0Ny;
-    ChMatrixNM<double, 8, 1> d0d0Nz;
-    d0d0Nx.MatrMultiplyT(m_element->m_d0d0T, Nx);
-    d0d0Ny.MatrMultiplyT(m_element->m_d0d0T, Ny);
-    d0d0Nz.MatrMultiplyT(m_element->m_d0d0T, Nz);
-
-    // Strain component
-    ChMatrixNM<double, 6, 1> strain_til;
-    strain_til(0, 0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
-    strain_til(1, 0) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
-    strain_til(2, 0) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3, 0) = N(0, 0) * m_element->m_strainANS(0, 0) + N(0, 2) * m_element->m_strainANS(1, 0) +
-                       N(0, 4) * m_element->m_strainANS(2, 0) + N(0, 6) * m_element->m_strainANS(3, 0);
-    strain_til(4, 0) = S_ANS(0, 2) * m_element->m_strainANS(6, 0) + S_ANS(0, 3) * m_element->m_strainANS(7, 0);
-    strain_til(5, 0) = S_ANS(0, 0) * m_element->m_strainANS(4, 0) + S_ANS(0, 1) * m_element->m_strainANS(5, 0);
-
-    // For orthotropic material
-    ChMatrixNM<double, 6, 1> strain;
-
-    strain(0, 0) = strain_til(0, 0) * beta(0) * beta(0) + strain_til(1, 0) * beta(3) * beta(3) +
-                   strain_til(2, 0) * beta(0) * beta(3) + strain_til(3, 0) * beta(6) * beta(6) +
-                   strain_til(4, 0) * beta(0) * beta(6) + strain_til(5, 0) * beta(3) * beta(6);
-    strain(1, 0) = strain_til(0, 0) * beta(1) * beta(1) + strain_til(1, 0) * beta(4) * beta(4) +
-                   strain_til(2, 0) * beta(1) * beta(4) + strain_til(3, 0) * beta(7) * beta(7) +
-                   strain_til(4, 0) * beta(1) * beta(7) + strain_til(5, 0) * beta(4) * beta(7);
-    strain(2, 0) = strain_til(0, 0) * 2.0 * beta(0) * beta(1) + strain_til(1, 0) * 2.0 * beta(3) * beta(4) +
-                   strain_til(2, 0) * (beta(1) * beta(3) + beta(0) * beta(4)) +
-                   strain_til(3, 0) * 2.0 * beta(6) * beta(7) +
-                   strain_til(4, 0) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                   strain_til(5, 0) * (beta(4) * beta(6) + beta(3) * beta(7));
-    strain(3, 0) = strain_til(0, 0) * beta(2) * beta(2) + strain_til(1, 0) * beta(5) * beta(5) +
-                   strain_til(2, 0) * beta(2) * beta(5) + strain_til(3, 0) * beta(8) * beta(8) +
-                   strain_til(4, 0) * beta(2) * beta(8) + strain_til(5, 0) * beta(5) * beta(8);
-    strain(4, 0) = strain_til(0, 0) * 2.0 * beta(0) * beta(2) + strain_til(1, 0) * 2.0 * beta(3) * beta(5) +
-                   strain_til(2, 0) * (beta(2) * beta(3) + beta(0) * beta(5)) +
-                   strain_til(3, 0) * 2.0 * beta(6) * beta(8) +
-                   strain_til(4, 0) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                   strain_til(5, 0) * (beta(5) * beta(6) + beta(3) * beta(8));
-    strain(5, 0) = strain_til(0, 0) * 2.0 * beta(1) * beta(2) + strain_til(1, 0) * 2.0 * beta(4) * beta(5) +
-                   strain_til(2, 0) * (beta(2) * beta(4) + beta(1) * beta(5)) +
-                   strain_til(3, 0) * 2.0 * beta(7) * beta(8) +
-                   strain_til(4, 0) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                   strain_til(5, 0) * (beta(5) * beta(7) + beta(4) * beta(8));
-
-    // Strain derivative component
-
-    ChMatrixNM<double, 6, 24> strainD_til;
-    ChMatrixNM<double, 1, 24> tempB;
-    ChMatrixNM<double, 1, 24> tempBB;
-    ChMatrixNM<double, 1, 3> tempB3;
-    ChMatrixNM<double, 1, 3> tempB31;
-    strainD_til.Reset();
-    // Expected speed up for AVX operation = 1.1x
-    tempB3.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 0, 0);
-    tempB3.MatrMultiply(Ny, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 1, 0);
-    tempB31.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 2, 0);
-
-    tempBB.Reset();
-    for (int i = 0; i < 4; i++) {
-        int ij = i * 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, i, 0, 1, 24, 0, 0);
-        tempB *= N(0, ij);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 3, 0);  // strainD for zz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 6;
-        int ij1 = i + 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 4, 0);  // strainD for xz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 4;
-        int ij1 = i;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 5, 0);  // strainD for yz
-
-    //// For orthotropic material
-    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates. Includes orthotropy
-    for (int ii = 0; ii < 24; ii++) {
-        strainD(0, ii) = strainD_til(0, ii) * beta(0) * beta(0) + strainD_til(1, ii) * beta(3) * beta(3) +
-                         strainD_til(2, ii) * beta(0) * beta(3) + strainD_til(3, ii) * beta(6) * beta(6) +
-                         strainD_til(4, ii) * beta(0) * beta(6) + strainD_til(5, ii) * beta(3) * beta(6);
-        strainD(1, ii) = strainD_til(0, ii) * beta(1) * beta(1) + strainD_til(1, ii) * beta(4) * beta(4) +
-                         strainD_til(2, ii) * beta(1) * beta(4) + strainD_til(3, ii) * beta(7) * beta(7) +
-                         strainD_til(4, ii) * beta(1) * beta(7) + strainD_til(5, ii) * beta(4) * beta(7);
-        strainD(2, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(1) + strainD_til(1, ii) * 2.0 * beta(3) * beta(4) +
-                         strainD_til(2, ii) * (beta(1) * beta(3) + beta(0) * beta(4)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(7) +
-                         strainD_til(4, ii) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                         strainD_til(5, ii) * (beta(4) * beta(6) + beta(3) * beta(7));
-        strainD(3, ii) = strainD_til(0, ii) * beta(2) * beta(2) + strainD_til(1, ii) * beta(5) * beta(5) +
-                         strainD_til(2, ii) * beta(2) * beta(5) + strainD_til(3, ii) * beta(8) * beta(8) +
-                         strainD_til(4, ii) * beta(2) * beta(8) + strainD_til(5) * beta(5) * beta(8);
-        strainD(4, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(2) + strainD_til(1, ii) * 2.0 * beta(3) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(3) + beta(0) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(6) + beta(3) * beta(8));
-        strainD(5, ii) = strainD_til(0, ii) * 2.0 * beta(1) * beta(2) + strainD_til(1, ii) * 2.0 * beta(4) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(4) + beta(1) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(7) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(7) + beta(4) * beta(8));
-    }
-
-    /// Gd : Jacobian (w.r.t. coordinates) of the initial position vector gradient matrix
-    ChMatrixNM<double, 9, 24> Gd;
-
-    for (int ii = 0; ii < 8; ii++) {
-        Gd(0, 3 * (ii)) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-        Gd(1, 3 * (ii) + 1) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-        Gd(2, 3 * (ii) + 2) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-
-        Gd(3, 3 * (ii)) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-        Gd(4, 3 * (ii) + 1) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-        Gd(5, 3 * (ii) + 2) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-
-        Gd(6, 3 * (ii)) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-        Gd(7, 3 * (ii) + 1) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-        Gd(8, 3 * (ii) + 2) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-    }
-
-    // Enhanced Assumed Strain 2nd
-    strain += strain_EAS;
-
-    // Structural damping
-    // Strain time derivative for structural damping
-    ChMatrixNM<double, 6, 1> DEPS;
-    DEPS.Reset();
-    for (int ii = 0; ii < 24; ii++) {
-        DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
-    }
-
-    // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
-
-    // Matrix of elastic coefficients: The input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
-
-    // Stress tensor calculation
-    ChMatrixNM<double, 6, 1> stress;
-    stress.MatrMultiply(E_eps, strain);
-
-    // Declaration and computation of Sigm, to be removed
-    ChMatrixNM<double, 9, 9> Sigm;  ///< Rearrangement of stress vector (not always needed)
-
-    Sigm(0, 0) = stress(0, 0);  // XX
-    Sigm(1, 1) = stress(0, 0);
-    Sigm(2, 2) = stress(0, 0);
-
-    Sigm(0, 3) = stress(2, 0);  // XY
-    Sigm(1, 4) = stress(2, 0);
-    Sigm(2, 5) = stress(2, 0);
-
-    Sigm(0, 6) = stress(4, 0);  // XZ
-    Sigm(1, 7) = stress(4, 0);
-    Sigm(2, 8) = stress(4, 0);
-
-    Sigm(3, 0) = stress(2, 0);  // XY
-    Sigm(4, 1) = stress(2, 0);
-    Sigm(5, 2) = stress(2, 0);
-
-    Sigm(3, 3) = stress(1, 0);  // YY
-    Sigm(4, 4) = stress(1, 0);
-    Sigm(5, 5) = stress(1, 0);
-
-    Sigm(3, 6) = stress(5, 0);  // YZ
-    Sigm(4, 7) = stress(5, 0);
-    Sigm(5, 8) = stress(5, 0);
-
-    Sigm(6, 0) = stress(4, 0);  // XZ
-    Sigm(7, 1) = stress(4, 0);
-    Sigm(8, 2) = stress(4, 0);
-
-    Sigm(6, 3) = stress(5, 0);  // YZ
-    Sigm(7, 4) = stress(5, 0);
-    Sigm(8, 5) = stress(5, 0);
-
-    Sigm(6, 6) = stress(3, 0);  // ZZ
-    Sigm(7, 7) = stress(3, 0);
-    Sigm(8, 8) = stress(3, 0);
-
-    // Jacobian of internal forces (excluding the EAS contribution).
-    ChMatrixNM<double, 24, 6> temp246;
-    ChMatrixNM<double, 24, 9> temp249;
-    temp246.MatrTMultiply(strainD, E_eps);
-    temp249.MatrTMultiply(Gd, Sigm);
-    ChMatrixNM<double, 24, 24> KTE;
-
-#ifdef CHRONO_HAS_AVX
-    ChMatrixNM<double, 24, 24> KTE_temp1;
-    ChMatrixNM<double, 24, 24> KTE_temp2;
-    KTE_temp1.MatrMultiplyAVX(temp246, strainD);
-    KTE_temp2.MatrMultiplyAVX(temp249, Gd);
-    KTE = KTE_temp1 * (m_Kfactor + m_Rfactor * m_element->m_Alpha) + KTE_temp2 * m_Kfactor;
-#else
-    KTE = (temp246 * strainD) * (m_Kfactor + m_Rfactor * m_element->m_Alpha) + (temp249 * Gd) * m_Kfactor;
-#endif
-
-    KTE *= detJ0 * (m_element->m_GaussScaling);
-
-    // EAS cross-dependency matrix.
-    ChMatrixNM<double, 5, 6> temp56;
-    temp56.MatrTMultiply(G, E_eps);
-
-#ifdef CHRONO_HAS_AVX
-    ChMatrixNM<double, 5, 24> GDEPSP;
-    GDEPSP.MatrMultiplyAVX(temp56, strainD);
-    GDEPSP = GDEPSP * (detJ0 * m_element->m_GaussScaling);
-#else
-    ChMatrixNM<double, 5, 24> GDEPSP = (temp56 * strainD) * (detJ0 * m_element->m_GaussScaling);
-#endif
-
-    // Load result vector (integrand)
-    result.PasteClippedMatrixToVector(KTE, 0, 0, 24, 24, 0);
-    result.PasteClippedMatrixToVector(GDEPSP, 0, 0, 5, 24, 576);
-}
-
+// The Jacobian (stiffness and damping matrices) of the internal forces of each layer is
+//      Kfactor * [K] + Rfactor * [R] - Kfactor * GDEPSP' * inv(KALPHA) * GDEPSP
+// where K does not include the EAS contribution and GDEPSP is the 5x24 cross-dependency matrix.
 void ChElementShellANCF::ComputeInternalJacobians(double Kfactor, double Rfactor) {
     // Note that the matrices with current nodal coordinates and velocities are
     // already available in m_d and m_d_dt (as set in ComputeInternalForces).
@@ -1056,30 +633,82 @@ void ChElementShellANCF::ComputeInternalJacobians(double Kfactor, double Rfactor
 
     // Loop over all layers.
     for (size_t kl = 0; kl < m_numLayers; kl++) {
-        ChMatrixNM<double, 696, 1> result;
-        MyJacobian formula(this, Kfactor, Rfactor, kl);
-        ChQuadrature::Integrate3D<ChMatrixNM<double, 696, 1> >(result,                          // result of integration
-                                                               formula,                         // integrand formula
-                                                               -1, 1,                           // x limits
-                                                               -1, 1,                           // y limits
-                                                               m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                               2                                // order of integration
-                                                               );
+        const std::vector<GaussPoint>& points = m_gaussPoints[kl];
+
+        // Matrix of elastic coefficients: The input assumes the material *could* be orthotropic
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
 
-        // Extract matrices from result of integration
         ChMatrixNM<double, 24, 24> KTE;
         ChMatrixNM<double, 5, 24> GDEPSP;
-        KTE.PasteClippedVectorToMatrix(result, 0, 0, 24, 24, 0);
-        GDEPSP.PasteClippedVectorToMatrix(result, 0, 0, 5, 24, 576);
+
+        ChMatrixNM<double, 6, 1> strain;
+        ChMatrixNM<double, 6, 24> strainD;
+        ChMatrixNM<double, 6, 1> stress;
+        ChMatrixNM<double, 6, 24> EstrainD;
+        ChMatrixNM<double, 24, 24> temp2424;
+        ChMatrixNM<double, 5, 6> temp56;
+        ChMatrixNM<double, 5, 24> temp524;
+
+        for (size_t ip = 0; ip < points.size(); ip++) {
+            const GaussPoint& gp = points[ip];
+
+            // Strain, including EAS
+            ChMatrixNM<double, 6, 1> strain_EAS;
+            CalcStrain(gp, strain, strainD);
+            strain_EAS.MatrMultiply(gp.G, m_alphaEAS[kl]);
+            strain += strain_EAS;
+
+            // Stress tensor calculation
+            stress.MatrMultiply(E_eps, strain);
+
+            // Material stiffness (and damping): strainD' * E * strainD
+            EstrainD.MatrMultiply(E_eps, strainD);
+            temp2424.MatrTMultiply(strainD, EstrainD);
+            temp2424.MatrScale((Kfactor + Rfactor * m_Alpha) * gp.weight);
+            KTE += temp2424;
+
+            // Geometric stiffness: Gd' * Sigm * Gd, where Gd (9x24) is the Jacobian of the position vector
+            // gradient and Sigm (9x9) the rearranged stress. Both are block-structured, so that the result is
+            // the 8x8 matrix Nj0' * S * Nj0 (with S the 3x3 stress tensor) repeated on each coordinate.
+            double S[3][3] = {{stress(0, 0), stress(2, 0), stress(4, 0)},
+                              {stress(2, 0), stress(1, 0), stress(5, 0)},
+                              {stress(4, 0), stress(5, 0), stress(3, 0)}};
+            ChMatrixNM<double, 3, 8> SNj0;
+            for (int a = 0; a < 3; a++) {
+                for (int jj = 0; jj < 8; jj++) {
+                    SNj0(a, jj) = S[a][0] * gp.Nj0(0, jj) + S[a][1] * gp.Nj0(1, jj) + S[a][2] * gp.Nj0(2, jj);
+                }
+            }
+            double scale = Kfactor * gp.weight;
+            for (int ii = 0; ii < 8; ii++) {
+                for (int jj = 0; jj < 8; jj++) {
+                    double kg = scale * (gp.Nj0(0, ii) * SNj0(0, jj) + gp.Nj0(1, ii) * SNj0(1, jj) +
+                                         gp.Nj0(2, ii) * SNj0(2, jj));
+                    KTE(3 * ii, 3 * jj) += kg;
+                    KTE(3 * ii + 1, 3 * jj + 1) += kg;
+                    KTE(3 * ii + 2, 3 * jj + 2) += kg;
+                }
+            }
+
+            // EAS cross-dependency matrix.
+            temp56.MatrTMultiply(gp.G, E_eps);
+            temp524.MatrMultiply(temp56, strainD);
+            temp524.MatrScale(gp.weight);
+            GDEPSP += temp524;
+        }
 
         // Include EAS contribution to the stiffness component (hence scaled by Kfactor)
         ChMatrixNM<double, 5, 5> KalphaEAS_inv;
         Inverse55_Analytical(KalphaEAS_inv, m_KalphaEAS[kl]);
+        ChMatrixNM<double, 5, 24> temp;
+        temp.MatrMultiply(KalphaEAS_inv, GDEPSP);
         ChMatrixNM<double, 24, 24> EAS;
-        EAS.MatrTMultiply(GDEPSP, KalphaEAS_inv * GDEPSP);
+        EAS.MatrTMultiply(GDEPSP, temp);
 
         // Accumulate Jacobian
-        m_JacobianMatrix += KTE - EAS * Kfactor;
+        EAS.MatrScale(Kfactor);
+        m_JacobianMatrix += KTE;
+        m_JacobianMatrix -= EAS;
     }
 }
 
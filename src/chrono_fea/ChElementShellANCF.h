@@ -116,8 +116,6 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
         ChMatrixNM<double, 6, 6> m_T0;
 
         friend class ChElementShellANCF;
-        friend class MyForce;
-        friend class MyJacobian;
     };
 
     /// Get the number of nodes used by this element.
@@ -209,6 +207,20 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
     ChVector<> EvaluateSectionStrains();
 
   private:
+    /// Data at a Gauss point which depends only on the initial configuration.
+    /// Calculated once in SetupInitial() and used by the internal force and Jacobian calculations.
+    struct GaussPoint {
+        ChMatrixNM<double, 1, 8> N;      ///< shape functions
+        ChMatrixNM<double, 1, 8> Nx;     ///< shape function derivatives with respect to X
+        ChMatrixNM<double, 1, 8> Ny;     ///< shape function derivatives with respect to Y
+        ChMatrixNM<double, 1, 8> Nz;     ///< shape function derivatives with respect to Z
+        ChMatrixNM<double, 3, 8> Nj0;    ///< shape function derivatives with respect to the initial coordinates
+        ChMatrixNM<double, 1, 4> S_ANS;  ///< ANS shape functions
+        ChMatrixNM<double, 9, 1> beta;   ///< coefficients of the contravariant transformation
+        ChMatrixNM<double, 6, 5> G;      ///< EAS matrix (T0 * M * detJ0C / detJ0)
+        double weight;                   ///< integration weight (includes detJ0 and interval scaling)
+    };
+
     std::vector<std::shared_ptr<ChNodeFEAxyzD> > m_nodes;  ///< element nodes
     std::vector<Layer> m_layers;                           ///< element layers
     size_t m_numLayers;                                    ///< number of layers for this element
@@ -231,6 +243,7 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
     ChMatrixNM<double, 8, 24> m_strainANS_D;               ///< ANS strain derivatives
     std::vector<ChMatrixNM<double, 5, 1> > m_alphaEAS;     ///< EAS parameters (5 per layer)
     std::vector<ChMatrixNM<double, 5, 5> > m_KalphaEAS;    ///< EAS Jacobians (a 5x5 matrix per layer)
+    std::vector<std::vector<GaussPoint> > m_gaussPoints;   ///< Gauss point data (8 points per layer)
 
     static const double m_toleranceEAS;   ///< tolerance for nonlinear EAS solver (on residual)
     static const int m_maxIterationsEAS;  ///< maximum number of nonlinear EAS iterations
@@ -317,6 +330,13 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
     // [ANS] Calculate the ANS strain and strain derivatives.
     void CalcStrainANSbilinearShell();
 
+    // Calculate the initial configuration data at the Gauss points of all layers.
+    void ComputeGaussPoints();
+
+    // Calculate the strain (including structural damping, but not EAS) and the strain derivatives
+    // at the specified Gauss point, in the local orthotropic frame.
+    void CalcStrain(const GaussPoint& gp, ChMatrixNM<double, 6, 1>& strain, ChMatrixNM<double, 6, 24>& strainD);
+
     // [EAS] Basis function of M for Enhanced Assumed Strain.
     void Basis_M(ChMatrixNM<double, 6, 5>& M, double x, double y, double z);
 
@@ -420,8 +440,6 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
 
     friend class MyMass;
     friend class MyGravity;
-    friend class MyForce;
-    friend class MyJacobian;
 };
 
 /// @} fea_elements
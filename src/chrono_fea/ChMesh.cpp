@@ -13,16 +13,21 @@
 // =============================================================================
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChZoneProfiler.h"
 
 #include "chrono_fea/ChElementTetra_4.h"
 #include "chrono_fea/ChMesh.h"
@@ -46,6 +51,9 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    matrix_free = other.matrix_free;
+    num_colored_elements = 0;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -65,7 +73,34 @@ void ChMesh::SetupInitial() {
     for (unsigned int i = 0; i < velements.size(); i++) {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
+        if (matrix_free)
+            velements[i]->SetMatrixFree(true);
     }
+
+    ColorElements();
+}
+
+void ChMesh::ColorElements() {
+    element_colors.clear();
+
+    // Greedy coloring: assign each element the first color not used by the elements sharing one of its nodes.
+    std::unordered_map<ChNodeFEAbase*, std::vector<unsigned int>> node_colors;
+    std::vector<bool> used;
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        used.assign(element_colors.size(), false);
+        for (int in = 0; in < velements[ie]->GetNnodes(); in++) {
+            for (auto color : node_colors[velements[ie]->GetNodeN(in).get()])
+                used[color] = true;
+        }
+        unsigned int color = (unsigned int)(std::find(used.begin(), used.end(), false) - used.begin());
+        if (color == element_colors.size())
+            element_colors.push_back(std::vector<unsigned int>());
+        element_colors[color].push_back(ie);
+        for (int in = 0; in < velements[ie]->GetNnodes(); in++)
+            node_colors[velements[ie]->GetNodeN(in).get()].push_back(color);
+    }
+
+    num_colored_elements = (unsigned int)velements.size();
 }
 
 void ChMesh::Relax() {
@@ -90,15 +125,25 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
 }
 
+void ChMesh::SetMatrixFree(bool val) {
+    matrix_free = val;
+    for (unsigned int i = 0; i < velements.size(); i++)
+        velements[i]->SetMatrixFree(matrix_free);
+}
+
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    element_colors.clear();
+    num_colored_elements = 0;
 }
 
 void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    element_colors.clear();
+    num_colored_elements = 0;
 }
 
 void ChMesh::AddContactSurface(std::shared_ptr<ChContactSurface> m_surf) {
@@ -136,6 +181,8 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_PROFILE_ZONE("ChMesh::Update");
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -247,6 +294,8 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,  // offset in R residual
                                ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                const double c           // a scaling factor
                                ) {
+    CH_PROFILE_ZONE("ChMesh::IntLoadResidual_F");
+
     // applied nodal forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -256,31 +305,98 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,  // offset in R residual
         }
     }
 
+    // Update the element coloring if elements were added after SetupInitial
+    if (num_colored_elements != velements.size())
+        ColorElements();
+
     // internal forces
+    // Elements of the same color do not share nodes, hence they can write their forces in R concurrently.
     timer_internal_forces.start();
+    {
+        CH_PROFILE_ZONE("ChMesh::ElementsInternalForces");
+
+        // Per element type statistics: accumulated by each thread, recorded once per type after the loop
+        struct TypeStats {
+            const std::type_info* type;
+            int calls;
+            double total;
+            double max;
+        };
+        typedef std::unordered_map<std::type_index, TypeStats> TypeStatsMap;
+        bool profile = utils::ChZoneProfiler::GetInstance().IsEnabled();
+        std::vector<TypeStatsMap> thread_stats(profile ? CHOMPfunctions::GetMaxThreads() : 0);
+
+        for (unsigned int ic = 0; ic < element_colors.size(); ic++) {
+            const std::vector<unsigned int>& elements = element_colors[ic];
 #pragma omp parallel for schedule(dynamic, 4)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+            for (int i = 0; i < elements.size(); i++) {
+                if (!profile) {
+                    velements[elements[i]]->EleIntLoadResidual_F(R, c);
+                    continue;
+                }
+                auto start = std::chrono::steady_clock::now();
+                velements[elements[i]]->EleIntLoadResidual_F(R, c);
+                auto end = std::chrono::steady_clock::now();
+                double duration = std::chrono::duration<double, std::milli>(end - start).count();
+
+                const ChElementBase& element = *velements[elements[i]];
+                TypeStats& stats = thread_stats[CHOMPfunctions::GetThreadNum()][std::type_index(typeid(element))];
+                stats.type = &typeid(element);
+                stats.calls++;
+                stats.total += duration;
+                stats.max = std::max(stats.max, duration);
+            }
+        }
+
+        TypeStatsMap merged;
+        for (auto& stats_map : thread_stats) {
+            for (auto& entry : stats_map) {
+                auto inserted = merged.insert(entry);
+                if (inserted.second)
+                    continue;
+                TypeStats& stats = inserted.first->second;
+                stats.calls += entry.second.calls;
+                stats.total += entry.second.total;
+                stats.max = std::max(stats.max, entry.second.max);
+            }
+        }
+        for (auto& entry : merged) {
+            const TypeStats& stats = entry.second;
+            utils::ChZoneProfiler::GetInstance().RecordZoneStats(*stats.type, stats.calls, stats.total, stats.max);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // Apply gravity loads without the need of adding
-    // a ChLoad object to each element: just instance here a single ChLoad and reuse
+    // a ChLoad object to each element: just instance here a ChLoad per thread and reuse
     // it for all 'volume' objects.
     if (automatic_gravity_load) {
-        std::shared_ptr<ChLoadableUVW> mloadable;  // still null
-        auto common_gravity_loader = std::make_shared<ChLoad<ChLoaderGravity>>(mloadable);
-        common_gravity_loader->loader.Set_G_acc(GetSystem()->Get_G_acc());
-        common_gravity_loader->loader.SetNumIntPoints(num_points_gravity);
-
-        for (unsigned int ie = 0; ie < velements.size(); ie++) {
-            if ((mloadable = std::dynamic_pointer_cast<ChLoadableUVW>(velements[ie]))) {
-                if (mloadable->GetDensity()) {
+        if (gravity_loaders.size() < (size_t)CHOMPfunctions::GetMaxThreads()) {
+            gravity_loaders.resize(CHOMPfunctions::GetMaxThreads());
+            for (auto& loader : gravity_loaders) {
+                if (!loader)
+                    loader = std::make_shared<ChLoad<ChLoaderGravity>>(std::shared_ptr<ChLoadableUVW>());
+            }
+        }
+        for (auto& loader : gravity_loaders) {
+            loader->loader.Set_G_acc(GetSystem()->Get_G_acc());
+            loader->loader.SetNumIntPoints(num_points_gravity);
+        }
+
+        for (unsigned int ic = 0; ic < element_colors.size(); ic++) {
+            const std::vector<unsigned int>& elements = element_colors[ic];
+#pragma omp parallel for schedule(dynamic, 4)
+            for (int i = 0; i < elements.size(); i++) {
+                auto mloadable = std::dynamic_pointer_cast<ChLoadableUVW>(velements[elements[i]]);
+                if (mloadable && mloadable->GetDensity()) {
                     // temporary set loader target and compute generalized forces term
-                    common_gravity_loader->loader.loadable = mloadable;
-                    common_gravity_loader->ComputeQ(0, 0);
-                    common_gravity_loader->LoadIntLoadResidual_F(R, c);
+                    auto& gravity_loader = gravity_loaders[CHOMPfunctions::GetThreadNum()];
+                    gravity_loader->loader.loadable = mloadable;
+                    gravity_loader->ComputeQ(0, 0);
+                    gravity_loader->LoadIntLoadResidual_F(R, c);
+                    // do not keep the element alive after it is removed from the mesh
+                    gravity_loader->loader.loadable.reset();
                 }
             }
         }
@@ -359,11 +475,23 @@ void ChMesh::IntFromDescriptor(const unsigned int off_v,  ///< offset in v
 //// SOLVER FUNCTIONS
 
 void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
+    // The elements of a color do not share nodes: their blocks can be processed in parallel by the solver
+    if (num_colored_elements == velements.size()) {
+        for (auto& color : element_colors) {
+            mdescriptor.BeginKblockGroup();
+            for (auto ie : color)
+                velements[ie]->InjectKRMmatrices(mdescriptor);
+            mdescriptor.EndKblockGroup();
+        }
+        return;
+    }
+
     for (unsigned int ie = 0; ie < velements.size(); ie++)
         velements[ie]->InjectKRMmatrices(mdescriptor);
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_PROFILE_ZONE("ChMesh::KRMmatricesLoad");
     timer_KRMload.start();
 #pragma omp parallel for
     for (int ie = 0; ie < velements.size(); ie++)
@@ -29,6 +29,10 @@
 
 namespace chrono {
 
+template <class Tloader>
+class ChLoad;
+class ChLoaderGravity;
+
 namespace fea {
 
 /// @addtogroup fea_module
@@ -54,6 +58,13 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    bool matrix_free;  ///< element KRM matrices computed when first used by the solver
+
+    std::vector<std::vector<unsigned int>> element_colors;  ///< element indices, by groups not sharing nodes
+    unsigned int num_colored_elements;                       ///< number of elements when the coloring was computed
+
+    std::vector<std::shared_ptr<ChLoad<ChLoaderGravity>>> gravity_loaders;  ///< per-thread gravity loads
+
     ChTimer<> timer_internal_forces;
     ChTimer<> timer_KRMload;
     int ncalls_internal_forces;
@@ -65,6 +76,8 @@ class ChApiFea ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          matrix_free(false),
+          num_colored_elements(0),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -96,6 +109,12 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     /// Get the number of elements in the mesh.
     unsigned int GetNelements() { return (unsigned int)velements.size(); }
 
+    /// Get the number of element colors.
+    /// Elements are split in groups (colors) of elements which do not share any node, so that the internal forces
+    /// of the elements of a group can be loaded in parallel, and their KRM matrices multiplied in parallel by the
+    /// solver (see ChSystemDescriptor::BeginKblockGroup()). The coloring is computed in SetupInitial.
+    unsigned int GetNumElementColors() const { return (unsigned int)element_colors.size(); }
+
     virtual int GetDOF() override { return n_dofs; }
     virtual int GetDOF_w() override { return n_dofs_w; }
 
@@ -175,6 +194,17 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     /// Tell if this mesh will add automatically a gravity load to all contained elements
     bool GetAutomaticGravity() { return automatic_gravity_load; }
 
+    /// Enable/disable the matrix-free mode for all elements (default: false).
+    /// If enabled, the KRM matrices of the elements are not computed when loaded (KRMmatricesLoad()), but
+    /// the first time the solver uses them (ex. at the first matrix-vector product of a Krylov solver such as
+    /// ChSolverMINRES or ChSolverGMRES, or during the assembly of a direct solver), and reused until the next
+    /// load. The system matrix is never assembled, and the element matrices are evaluated in parallel by the
+    /// products, color by color (see GetNumElementColors()). Solvers that do not use the KRM matrices do not
+    /// evaluate them at all. The setting also applies to elements added later, at the next SetupInitial().
+    void SetMatrixFree(bool val);
+    /// Tell if the KRM matrices of the elements are not stored (matrix-free mode).
+    bool GetMatrixFree() const { return matrix_free; }
+
     /// Get ChMesh mass properties
     void ComputeMassProperties(double& mass,          ///< ChMesh object mass
                                ChVector<>& com,       ///< ChMesh center of gravity
@@ -270,11 +300,15 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
 
   private:
+    /// Split the elements in groups not sharing any node (greedy coloring).
+    void ColorElements();
+
     /// Initial setup (before analysis).
     /// This function is called from ChSystem::SetupInitial, marking a point where system
     /// construction is completed.
     /// - Computes the total number of degrees of freedom
     /// - Precompute auxiliary data, such as (local) stiffness matrices Kl, if any, for each element.
+    /// - Compute the element coloring used in the parallel load of the internal forces.
     virtual void SetupInitial() override;
 };
 
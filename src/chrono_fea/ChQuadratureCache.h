@@ -0,0 +1,230 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+// Cache of shape functions and initial configuration data at the quadrature
+// points of an element.
+// =============================================================================
+
+#ifndef CHQUADRATURECACHE_H
+#define CHQUADRATURECACHE_H
+
+#include <cassert>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChMatrixNM.h"
+#include "chrono/core/ChQuadrature.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_math
+/// @{
+
+/// Shape functions at a quadrature point of an element with NSF shape functions.
+template <int NSF>
+struct ChQuadraturePoint {
+    double x, y, z;                 ///< natural coordinates of the point
+    double weight;                  ///< quadrature weight (including the change of integration interval)
+    ChMatrixNM<double, 1, NSF> N;   ///< shape functions
+    ChMatrixNM<double, 1, NSF> Nx;  ///< shape function derivatives with respect to x
+    ChMatrixNM<double, 1, NSF> Ny;  ///< shape function derivatives with respect to y
+    ChMatrixNM<double, 1, NSF> Nz;  ///< shape function derivatives with respect to z
+};
+
+/// Factors relating the shape functions of an element (and their derivatives) to functions of the natural
+/// coordinates only: each shape function is such a function, times a factor that depends on the element
+/// dimensions. The factors must not be zero.
+template <int NSF>
+struct ChShapeFunctionScales {
+    double N[NSF];   ///< factors of the shape functions
+    double Nx[NSF];  ///< factors of the shape function derivatives with respect to x
+    double Ny[NSF];  ///< factors of the shape function derivatives with respect to y
+    double Nz[NSF];  ///< factors of the shape function derivatives with respect to z
+};
+
+/// Cache of the shape functions and of the initial configuration data at the points of a 3D Gauss-Legendre
+/// quadrature rule. Elements build it once (in SetupInitial) and use it in the calculation of the internal forces
+/// and of their Jacobians, instead of evaluating the shape functions at each call.
+/// The shape functions are stored, divided by their dimension factors (see ChShapeFunctionScales), in tables
+/// shared by all the elements of the same type, whatever their dimensions; each element only keeps its factors
+/// and the inverse and the determinant of its initial position vector gradient at each point. The points are
+/// stored in the same order in which ChQuadrature::Integrate3D visits them.
+template <int NSF>
+class ChQuadratureCache3D {
+  public:
+    typedef ChQuadraturePoint<NSF> Point;
+    typedef ChShapeFunctionScales<NSF> Scales;
+
+    /// Set up the cache for the quadrature rule of given order over [-1,1]^3, for an element of the given type with
+    /// initial nodal coordinates d0 and dimension factors 'scales'. The function 'eval' must fill the shape
+    /// functions of the element and their derivatives (N, Nx, Ny, Nz) at the natural coordinates of the point it
+    /// receives. It is called only if no other element of the same type was set up with the same order before.
+    template <class Eval>
+    void Setup(const std::type_info& type,
+               int order,
+               const ChMatrixNM<double, NSF, 3>& d0,
+               const Scales& scales,
+               Eval eval) {
+        m_scales = scales;
+        m_table = GetTable(type, order, scales, eval);
+
+        m_j0.resize(9 * m_table->size());
+        m_detJ0.resize(m_table->size());
+        Point p;
+        ChMatrixNM<double, 1, 3> Nx_d0;
+        ChMatrixNM<double, 1, 3> Ny_d0;
+        ChMatrixNM<double, 1, 3> Nz_d0;
+        for (size_t i = 0; i < m_table->size(); i++) {
+            GetPoint(i, p);
+            Nx_d0.MatrMultiply(p.Nx, d0);
+            Ny_d0.MatrMultiply(p.Ny, d0);
+            Nz_d0.MatrMultiply(p.Nz, d0);
+            CalcInverse(Nx_d0, Ny_d0, Nz_d0, &m_j0[9 * i], m_detJ0[i]);
+        }
+    }
+
+    /// Return true if the cache was not set up.
+    bool IsEmpty() const { return !m_table || m_table->empty(); }
+
+    /// Return the number of quadrature points.
+    size_t GetNumPoints() const { return m_table ? m_table->size() : 0; }
+
+    /// Return the shape functions of this element at the specified quadrature point.
+    void GetPoint(size_t i, Point& point) const {
+        const Point& natural = (*m_table)[i];
+        point.x = natural.x;
+        point.y = natural.y;
+        point.z = natural.z;
+        point.weight = natural.weight;
+        for (int j = 0; j < NSF; j++) {
+            point.N(0, j) = natural.N(0, j) * m_scales.N[j];
+            point.Nx(0, j) = natural.Nx(0, j) * m_scales.Nx[j];
+            point.Ny(0, j) = natural.Ny(0, j) * m_scales.Ny[j];
+            point.Nz(0, j) = natural.Nz(0, j) * m_scales.Nz[j];
+        }
+    }
+
+    /// Return the determinant of the initial position vector gradient at the specified quadrature point.
+    double GetDetJ0(size_t i) const { return m_detJ0[i]; }
+
+    /// Integrate over the cached points: result = sum_i (w_i * f(point_i)).
+    /// The integrand must provide a function Evaluate(T& val, const ChQuadraturePoint<NSF>& point,
+    /// const ChMatrixNM<double, 3, 3>& j0, double detJ0), where j0 is the inverse of the initial position vector
+    /// gradient and detJ0 is its determinant.
+    template <class T, class Integrand>
+    void Integrate(T& result, Integrand& integrand) const {
+        assert(!IsEmpty());  // Setup() not called (e.g. missing SetupInitial)
+        result *= 0;
+        T val;
+        Point point;
+        ChMatrixNM<double, 3, 3> j0;
+        for (size_t i = 0; i < m_table->size(); i++) {
+            GetPoint(i, point);
+            for (int k = 0; k < 9; k++)
+                j0.GetAddress()[k] = m_j0[9 * i + k];
+            integrand.Evaluate(val, point, j0, m_detJ0[i]);
+            val *= point.weight;
+            result += val;
+        }
+    }
+
+  private:
+    typedef std::vector<Point> Table;
+
+    // Return the table of shape functions divided by their factors for the given element type and quadrature
+    // order, building it if necessary. The tables no longer used by any element are discarded.
+    template <class Eval>
+    static std::shared_ptr<const Table> GetTable(const std::type_info& type,
+                                                 int order,
+                                                 const Scales& scales,
+                                                 Eval& eval) {
+        typedef std::pair<std::type_index, int> Key;
+        static std::map<Key, std::weak_ptr<const Table>> tables;
+        static std::mutex tables_mutex;
+
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        Key key(std::type_index(type), order);
+        for (auto it = tables.begin(); it != tables.end();) {
+            if (it->second.expired())
+                it = tables.erase(it);
+            else
+                ++it;
+        }
+        auto found = tables.find(key);
+        if (found != tables.end())
+            return found->second.lock();
+
+        const std::vector<double>& roots = ChQuadrature::GetStaticTables()->Lroots[order - 1];
+        const std::vector<double>& weights = ChQuadrature::GetStaticTables()->Weight[order - 1];
+        auto table = std::make_shared<Table>();
+        table->reserve(roots.size() * roots.size() * roots.size());
+        for (size_t ix = 0; ix < roots.size(); ix++) {
+            for (size_t iy = 0; iy < roots.size(); iy++) {
+                for (size_t iz = 0; iz < roots.size(); iz++) {
+                    Point point;
+                    point.x = roots[ix];
+                    point.y = roots[iy];
+                    point.z = roots[iz];
+                    point.weight = weights[ix] * weights[iy] * weights[iz];
+                    eval(point);
+                    for (int j = 0; j < NSF; j++) {
+                        point.N(0, j) /= scales.N[j];
+                        point.Nx(0, j) /= scales.Nx[j];
+                        point.Ny(0, j) /= scales.Ny[j];
+                        point.Nz(0, j) /= scales.Nz[j];
+                    }
+                    table->push_back(point);
+                }
+            }
+        }
+        tables[key] = table;
+        return table;
+    }
+
+    // Calculate the inverse (row-major) and the determinant of the initial position vector gradient.
+    static void CalcInverse(const ChMatrixNM<double, 1, 3>& Nx_d0,
+                            const ChMatrixNM<double, 1, 3>& Ny_d0,
+                            const ChMatrixNM<double, 1, 3>& Nz_d0,
+                            double* j0,
+                            double& detJ0) {
+        detJ0 = Nx_d0(0, 0) * Ny_d0(0, 1) * Nz_d0(0, 2) + Ny_d0(0, 0) * Nz_d0(0, 1) * Nx_d0(0, 2) +
+                Nz_d0(0, 0) * Nx_d0(0, 1) * Ny_d0(0, 2) - Nx_d0(0, 2) * Ny_d0(0, 1) * Nz_d0(0, 0) -
+                Ny_d0(0, 2) * Nz_d0(0, 1) * Nx_d0(0, 0) - Nz_d0(0, 2) * Nx_d0(0, 1) * Ny_d0(0, 0);
+        j0[0] = (Ny_d0(0, 1) * Nz_d0(0, 2) - Nz_d0(0, 1) * Ny_d0(0, 2)) / detJ0;
+        j0[1] = (Ny_d0(0, 2) * Nz_d0(0, 0) - Ny_d0(0, 0) * Nz_d0(0, 2)) / detJ0;
+        j0[2] = (Ny_d0(0, 0) * Nz_d0(0, 1) - Nz_d0(0, 0) * Ny_d0(0, 1)) / detJ0;
+        j0[3] = (Nz_d0(0, 1) * Nx_d0(0, 2) - Nx_d0(0, 1) * Nz_d0(0, 2)) / detJ0;
+        j0[4] = (Nz_d0(0, 2) * Nx_d0(0, 0) - Nx_d0(0, 2) * Nz_d0(0, 0)) / detJ0;
+        j0[5] = (Nz_d0(0, 0) * Nx_d0(0, 1) - Nz_d0(0, 1) * Nx_d0(0, 0)) / detJ0;
+        j0[6] = (Nx_d0(0, 1) * Ny_d0(0, 2) - Ny_d0(0, 1) * Nx_d0(0, 2)) / detJ0;
+        j0[7] = (Ny_d0(0, 0) * Nx_d0(0, 2) - Nx_d0(0, 0) * Ny_d0(0, 2)) / detJ0;
+        j0[8] = (Nx_d0(0, 0) * Ny_d0(0, 1) - Ny_d0(0, 0) * Nx_d0(0, 1)) / detJ0;
+    }
+
+    std::shared_ptr<const Table> m_table;  ///< shape functions divided by their factors, shared by the element type
+    Scales m_scales;                       ///< dimension factors of the shape functions of this element
+    std::vector<double> m_j0;              ///< inverse of the initial position vector gradient (9 per point)
+    std::vector<double> m_detJ0;           ///< determinant of the initial position vector gradient
+};
+
+/// @} fea_math
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
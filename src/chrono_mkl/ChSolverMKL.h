@@ -15,6 +15,9 @@
 #ifndef CHSOLVERMKL_H
 #define CHSOLVERMKL_H
 
+#include <algorithm>
+#include <vector>
+
 #include "chrono/solver/ChSolver.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/core/ChSparseMatrix.h"
@@ -68,6 +71,18 @@ class ChSolverMKL : public ChSolver {
     /// Set the number of non-zero entries in the problem matrix.
     void SetMatrixNNZ(int nnz) { m_nnz = nnz; }
 
+    /// Enable/disable reuse of the symbolic analysis (reordering) across calls to Setup (default: false).
+    /// If enabled, Setup only performs the numerical factorization as long as the sparsity pattern of the
+    /// assembled matrix is the same as at the last analysis, which is checked at each call.
+    void SetAnalysisReuse(bool val) { m_reuse_analysis = val; }
+
+    /// Return the number of calls to Setup (numerical factorizations).
+    int GetNumSetupCalls() const { return m_setup_call; }
+    /// Return the number of calls to Solve.
+    int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses (reorderings) performed in Setup.
+    int GetNumAnalysisCalls() const { return m_analysis_call; }
+
     /// Reset timers for internal phases in Solve and Setup.
     void ResetTimers() {
         m_timer_setup_assembly.reset();
@@ -135,17 +150,30 @@ class ChSolverMKL : public ChSolver {
         if (m_use_rhs_sparsity && !m_use_perm)
             m_engine.UsePartialSolution(2);
 
+        // Check whether the symbolic analysis of the last call can be reused.
+        bool analyze = !m_reuse_analysis || m_setup_call == 0 || PatternChanged();
+        if (analyze && m_reuse_analysis) {
+            int nnz = m_mat.GetNNZ();
+            m_analysis_ia.assign(m_mat.GetCSR_LeadingIndexArray(), m_mat.GetCSR_LeadingIndexArray() + m_dim + 1);
+            m_analysis_ja.assign(m_mat.GetCSR_TrailingIndexArray(), m_mat.GetCSR_TrailingIndexArray() + nnz);
+        }
+
         m_timer_setup_assembly.stop();
 
         // Perform the factorization with the Pardiso sparse direct solver.
+        // If the sparsity pattern did not change, only the numerical factorization is performed.
         m_timer_setup_solvercall.start();
-        int pardiso_message_phase12 = m_engine.PardisoCall(ChMklEngine::phase_t::ANALYSIS_NUMFACTORIZATION, 0);
+        int pardiso_message_phase12 = m_engine.PardisoCall(
+            analyze ? ChMklEngine::phase_t::ANALYSIS_NUMFACTORIZATION : ChMklEngine::phase_t::NUMFACTORIZATION, 0);
         m_timer_setup_solvercall.stop();
 
         m_setup_call++;
+        if (analyze)
+            m_analysis_call++;
 
         if (verbose) {
-            GetLog() << " MKL setup n = " << m_dim << "  nnz = " << m_mat.GetNNZ() << "\n";
+            GetLog() << " MKL setup n = " << m_dim << "  nnz = " << m_mat.GetNNZ()
+                     << (analyze ? "" : "  (analysis reused)") << "\n";
             GetLog() << "  assembly: " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s"
                      << "  solver_call: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "\n";
         }
@@ -221,15 +249,30 @@ class ChSolverMKL : public ChSolver {
     }
 
   private:
+    /// Return true if the sparsity pattern of the matrix differs from the one at the last analysis.
+    bool PatternChanged() {
+        int nnz = m_mat.GetNNZ();
+        if (m_analysis_ia.size() != static_cast<size_t>(m_dim + 1) ||
+            m_analysis_ja.size() != static_cast<size_t>(nnz))
+            return true;
+        return !std::equal(m_analysis_ia.begin(), m_analysis_ia.end(), m_mat.GetCSR_LeadingIndexArray()) ||
+               !std::equal(m_analysis_ja.begin(), m_analysis_ja.end(), m_mat.GetCSR_TrailingIndexArray());
+    }
+
     ChMklEngine m_engine = {0, ChSparseMatrix::GENERAL};  ///< interface to MKL solver
     Matrix m_mat = {1, 1};                                ///< problem matrix
     ChMatrixDynamic<double> m_rhs;                        ///< right-hand side vector
     ChMatrixDynamic<double> m_sol;                        ///< solution vector
 
-    int m_dim = 0;         ///< problem size
-    int m_nnz = 0;         ///< user-supplied estimate of NNZ
-    int m_solve_call = 0;  ///< counter for calls to Solve
-    int m_setup_call = 0;  ///< counter for calls to Setup
+    int m_dim = 0;            ///< problem size
+    int m_nnz = 0;            ///< user-supplied estimate of NNZ
+    int m_solve_call = 0;     ///< counter for calls to Solve
+    int m_setup_call = 0;     ///< counter for calls to Setup
+    int m_analysis_call = 0;  ///< counter for symbolic analyses
+
+    bool m_reuse_analysis = false;   ///< reuse the symbolic analysis if the sparsity pattern is unchanged?
+    std::vector<int> m_analysis_ia;  ///< CSR leading index array at the last analysis
+    std::vector<int> m_analysis_ja;  ///< CSR trailing index array at the last analysis
 
     bool m_lock = false;                           ///< is the matrix sparsity pattern locked?
     bool m_force_sparsity_pattern_update = false;  ///< is the sparsity pattern changed compared to last call?
@@ -235,6 +235,12 @@ struct host_container {
     custom_vector<real> erad_rigid_rigid;
     custom_vector<vec2> bids_rigid_rigid;
 
+    // Contact multipliers of the previous step, used for warm starting the DVI solver.
+    // Contacts are sorted by shape pair (in reported order within a pair); for each contact,
+    // 6 multipliers (normal, sliding, spinning).
+    custom_vector<long long> contact_pairs_prev;
+    custom_vector<real> gamma_rigid_prev;
+
     custom_vector<real3> norm_rigid_fluid;
     custom_vector<real3> cpta_rigid_fluid;
     custom_vector<real> dpth_rigid_fluid;
@@ -397,6 +403,8 @@ struct host_container {
     custom_vector<uint> bin_aabb_number;
     custom_vector<uint> bin_start_index;
     custom_vector<uint> bin_num_contact;
+    custom_vector<uint> shape_grid_level;   // grid level of each shape (multi-level broadphase)
+    custom_vector<uint> shape_num_contact;  // contacts of each shape with shapes in coarser levels
 };
 
 class CH_PARALLEL_API ChParallelDataManager {
@@ -40,6 +40,9 @@ class collision_measures {
         number_of_contacts_possible = 0;
         number_of_bins_active = 0;
         number_of_bin_intersections = 0;
+        number_of_grid_levels = 1;
+        number_of_manifolds_reused = 0;
+        number_of_contacts_reduced = 0;
 
         rigid_min_bounding_point = real3(0);
         rigid_max_bounding_point = real3(0);
@@ -64,6 +67,9 @@ class collision_measures {
     uint number_of_bins_active;        // Number of active bins (containing 1+ AABBs)
     uint number_of_bin_intersections;  // Number of AABB bin intersections
     uint number_of_contacts_possible;  // Number of contacts possible from broadphase
+    uint number_of_grid_levels;        // Number of levels used by the broadphase grid
+    uint number_of_manifolds_reused;   // Number of shape pairs whose contacts were reused
+    uint number_of_contacts_reduced;   // Number of contacts removed by the manifold reduction
 
     real3 rigid_min_bounding_point;
     real3 rigid_max_bounding_point;
@@ -98,6 +104,7 @@ class solver_measures {
         spinning_apgd_step_length = 1;
         old_objective_value = 0;
         lambda_max = 0;
+        number_of_islands = 0;
     }
     int total_iteration;       // The total number of iterations performed, this variable accumulates
     real residual;             // Current residual for the solver
@@ -109,6 +116,7 @@ class solver_measures {
     real sliding_apgd_step_length;
     real spinning_apgd_step_length;
     real lambda_max;  // largest eigenvalue
+    uint number_of_islands;  // number of islands solved separately (see solver_settings::solve_islands)
     // These three variables are used to store the convergence history of the solver
     std::vector<real> maxd_hist, maxdeltalambda_hist, time;
     std::vector<real> apgd_beta;
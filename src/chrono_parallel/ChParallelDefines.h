@@ -110,6 +110,10 @@ enum class SolverMode { NORMAL, SLIDING, SPINNING, BILATERAL };
 
 enum class CollisionSystemType { COLLSYS_PARALLEL, COLLSYS_BULLET_PARALLEL };
 
+// Broadphase algorithm of the parallel collision system: the (multi-level) grid is rebuilt at each
+// step, sweep and prune is updated incrementally from the previous step.
+enum class BroadphaseType { BROADPHASE_GRID, BROADPHASE_SAP };
+
 enum class NarrowPhaseType {
     NARROWPHASE_MPR,
     NARROWPHASE_R,
@@ -54,6 +54,11 @@ class collision_settings {
         narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
         grid_density = 5;
         fixed_bins = true;
+        max_grid_levels = 1;
+        grid_level_ratio = 4;
+        broadphase_type = BroadphaseType::BROADPHASE_GRID;
+        max_manifold_points = 0;
+        manifold_tolerance = 0;
     }
 
     real3 min_bounding_point, max_bounding_point;
@@ -82,6 +87,30 @@ class collision_settings {
     real grid_density;
     // use fixed number of bins instead of tuning them
     bool fixed_bins;
+    // Maximum number of levels of the broadphase grid. With more than one level,
+    // the grid given by bins_per_axis is the finest one and each level is coarser
+    // than the previous one by grid_level_ratio. Every shape is binned in the
+    // finest level with bins at least as large as its bounding box, so that a few
+    // large shapes (terrain, containers) do not intersect a huge number of small
+    // bins. Only the levels needed by the largest shape are used.
+    uint max_grid_levels;
+    real grid_level_ratio;
+    // The grid broadphase bins all shapes from scratch at each step. The sweep
+    // and prune broadphase keeps the sorted AABB endpoints and the overlapping
+    // pairs of the previous step and only updates them, which is faster when
+    // objects move little relative to each other (e.g. settling granular
+    // material). It is rebuilt when collision shapes are added or removed.
+    BroadphaseType broadphase_type;
+    // Maximum number of contact points kept between two bodies for contacts
+    // with nearly parallel normals (e.g. a box on a triangle mesh, with one
+    // contact per triangle). The deepest point is kept, then the points
+    // farthest from those already kept. A value of 4 is usually enough;
+    // 0 keeps all points.
+    uint max_manifold_points;
+    // The contacts of a pair of shapes are reused, without running the
+    // narrowphase, as long as their points have moved less than this distance
+    // relative to each other since they were computed. 0 disables the reuse.
+    real manifold_tolerance;
 };
 
 // solver_settings, like the name implies is the structure that contains all
@@ -123,6 +152,8 @@ class solver_settings {
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        solve_islands = false;
+        use_single_precision = false;
     }
 
     // The solver type variable defines name of the solver that will be used to
@@ -209,6 +240,17 @@ class solver_settings {
     real tolerance_objective;
     // Compute residual every x iterations
     int skip_residual;
+    // If true, the contacts and bilaterals are partitioned into islands of bodies that do not
+    // interact with each other (fixed bodies do not connect islands). Each island is solved on its
+    // own with the APGD method, in parallel, until its own residual is below tol_speed, so that
+    // small islands stop after a few iterations while large ones keep iterating. Ignored when
+    // there are 3DOF or FEA constraints.
+    bool solve_islands;
+    // If true (and real is double), M_invD (or N) is stored in single precision instead of double
+    // precision, which halves its memory and memory traffic in the Schur products. D_T, the
+    // Lagrange multipliers, residuals and the integration stay in double precision. Ignored with
+    // FEA constraints. Suited to large granular systems that do not need tight tolerances.
+    bool use_single_precision;
 };
 
 class settings_container {
@@ -230,6 +272,7 @@ class settings_container {
         perform_thread_tuning = ((min_threads == max_threads) ? false : true);
         system_type = SystemType::SYSTEM_DVI;
         step_size = .01;
+        reorder_interval = 0;
     }
 
     // The settings for the collision detection
@@ -256,6 +299,10 @@ class settings_container {
     // The system type defines if the system is solving the DVI frictional contact
     // problem or a DEM penalty based
     SystemType system_type;
+    // Bodies and collision shapes are sorted along a Z-order curve of the body
+    // positions every reorder_interval steps, so that bodies close in space are
+    // also close in memory (see ChSystemParallel::ReorderBodies). 0 disables it.
+    int reorder_interval;
 };
 
 /// @} parallel_module
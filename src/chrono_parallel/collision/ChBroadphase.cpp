@@ -1,10 +1,12 @@
 #include <algorithm>
+#include <iterator>
 
 #include <chrono_parallel/collision/ChCollision.h>
 #include "chrono_parallel/collision/ChBroadphaseUtils.h"
 #include "chrono_parallel/physics/Ch3DOFContainer.h"
 
 //#include <thrust/host_vector.h>
+#include <thrust/copy.h>
 #include <thrust/transform.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/sort.h>
@@ -166,7 +168,12 @@ ChCBroadphase::ChCBroadphase() {
 // let user define their own narrow-phase collision detection
 void ChCBroadphase::DispatchRigid() {
     if (data_manager->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (data_manager->settings.collision.broadphase_type == BroadphaseType::BROADPHASE_SAP)
+            SweepAndPruneBroadphase();
+        else if (data_manager->settings.collision.max_grid_levels > 1)
+            MultiLevelBroadphase();
+        else
+            OneLevelBroadphase();
         data_manager->num_rigid_contacts = data_manager->measures.collision.number_of_contacts_possible;
     }
     return;
@@ -258,6 +265,274 @@ void ChCBroadphase::OneLevelBroadphase() {
     contact_pairs.resize(number_of_contacts_possible);
     LOG(TRACE) << "Number of unique collisions: " << number_of_contacts_possible;
 }
+
+void ChCBroadphase::MultiLevelBroadphase() {
+    LOG(TRACE) << "ChCBroadphase::MultiLevelBroadphase()";
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+
+    custom_vector<uint>& bin_intersections = data_manager->host_data.bin_intersections;
+    custom_vector<uint>& bin_number = data_manager->host_data.bin_number;
+    custom_vector<uint>& bin_number_out = data_manager->host_data.bin_number_out;
+    custom_vector<uint>& bin_aabb_number = data_manager->host_data.bin_aabb_number;
+    custom_vector<uint>& bin_start_index = data_manager->host_data.bin_start_index;
+    custom_vector<uint>& bin_num_contact = data_manager->host_data.bin_num_contact;
+    custom_vector<uint>& shape_level = data_manager->host_data.shape_grid_level;
+    custom_vector<uint>& shape_num_contact = data_manager->host_data.shape_num_contact;
+
+    const vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+    const real3& bin_size = data_manager->measures.collision.bin_size;
+    const uint max_levels = data_manager->settings.collision.max_grid_levels;
+    const real ratio = data_manager->settings.collision.grid_level_ratio;
+    const int num_shapes = data_manager->num_rigid_shapes;
+
+    uint& number_of_grid_levels = data_manager->measures.collision.number_of_grid_levels;
+    uint& number_of_bins_active = data_manager->measures.collision.number_of_bins_active;
+    uint& number_of_bin_intersections = data_manager->measures.collision.number_of_bin_intersections;
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+
+    // Assign each shape to the finest level with bins at least as large as its AABB.
+    // The top level grid is the finest one; only the levels needed by the largest shape are used.
+    shape_level.resize(num_shapes);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        shape_level[i] = f_ML_Shape_Level(i, max_levels, bin_size, ratio, aabb_min, aabb_max);
+    }
+    number_of_grid_levels = Thrust_Max(shape_level) + 1;
+
+    level_bins_per_axis.resize(number_of_grid_levels);
+    level_inv_bin_size.resize(number_of_grid_levels);
+    level_offset.resize(number_of_grid_levels + 1);
+    level_offset[0] = 0;
+    real scale = 1;
+    for (uint l = 0; l < number_of_grid_levels; l++) {
+        vec3 bins = vec3((int)Ceil(bins_per_axis.x / scale), (int)Ceil(bins_per_axis.y / scale),
+                         (int)Ceil(bins_per_axis.z / scale));
+        bins = Clamp(bins, vec3(1), bins);
+        level_bins_per_axis[l] = bins;
+        level_inv_bin_size[l] = 1.0 / (bin_size * scale);
+        level_offset[l + 1] = level_offset[l] + bins.x * bins.y * bins.z;
+        scale *= ratio;
+    }
+
+    LOG(TRACE) << "Number of grid levels: " << number_of_grid_levels;
+
+    bin_intersections.resize(num_shapes + 1);
+    bin_intersections[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        f_ML_Count_AABB_BIN_Intersection(i, level_inv_bin_size, level_bins_per_axis, shape_level, aabb_min, aabb_max,
+                                         bin_intersections);
+    }
+
+    Thrust_Exclusive_Scan(bin_intersections);
+    number_of_bin_intersections = bin_intersections.back();
+
+    LOG(TRACE) << "Number of bin intersections: " << number_of_bin_intersections;
+
+    bin_number.resize(number_of_bin_intersections);
+    bin_number_out.resize(number_of_bin_intersections);
+    bin_aabb_number.resize(number_of_bin_intersections);
+    bin_start_index.resize(number_of_bin_intersections);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        f_ML_Store_AABB_BIN_Intersection(i, level_inv_bin_size, level_bins_per_axis, level_offset, shape_level,
+                                         aabb_min, aabb_max, bin_intersections, bin_number, bin_aabb_number);
+    }
+
+    Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+    number_of_bins_active = (int)(Run_Length_Encode(bin_number, bin_number_out, bin_start_index));
+
+    if (number_of_bins_active <= 0) {
+        number_of_contacts_possible = 0;
+        return;
+    }
+
+    bin_start_index.resize(number_of_bins_active + 1);
+    bin_start_index[number_of_bins_active] = 0;
+
+    LOG(TRACE) << "Number of bins active: " << number_of_bins_active;
+
+    Thrust_Exclusive_Scan(bin_start_index);
+
+    // Contacts between shapes in the same level, found in the bins of that level
+    bin_num_contact.resize(number_of_bins_active + 1);
+    bin_num_contact[number_of_bins_active] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)number_of_bins_active; i++) {
+        f_ML_Count_AABB_AABB_Intersection(i, level_inv_bin_size, level_bins_per_axis, level_offset, aabb_min, aabb_max,
+                                          bin_number_out, bin_aabb_number, bin_start_index, fam_data, obj_active,
+                                          obj_data_id, bin_num_contact);
+    }
+
+    // Contacts of each shape with the shapes in coarser levels
+    shape_num_contact.resize(num_shapes + 1);
+    shape_num_contact[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        shape_num_contact[i] = f_ML_Process_AABB_Level_Intersection(
+            i, number_of_grid_levels, number_of_bins_active, level_inv_bin_size, level_bins_per_axis, level_offset,
+            shape_level, aabb_min, aabb_max, bin_number_out, bin_aabb_number, bin_start_index, fam_data, obj_active,
+            obj_data_id, NULL);
+    }
+
+    Thrust_Exclusive_Scan(bin_num_contact);
+    Thrust_Exclusive_Scan(shape_num_contact);
+    uint number_of_level_contacts = bin_num_contact.back();
+    number_of_contacts_possible = number_of_level_contacts + shape_num_contact.back();
+    contact_pairs.resize(number_of_contacts_possible);
+    LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)number_of_bins_active; index++) {
+        f_ML_Store_AABB_AABB_Intersection(index, level_inv_bin_size, level_bins_per_axis, level_offset, aabb_min,
+                                          aabb_max, bin_number_out, bin_aabb_number, bin_start_index, bin_num_contact,
+                                          fam_data, obj_active, obj_data_id, contact_pairs);
+    }
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_num_contact[i + 1] == shape_num_contact[i])
+            continue;
+        f_ML_Process_AABB_Level_Intersection(
+            i, number_of_grid_levels, number_of_bins_active, level_inv_bin_size, level_bins_per_axis, level_offset,
+            shape_level, aabb_min, aabb_max, bin_number_out, bin_aabb_number, bin_start_index, fam_data, obj_active,
+            obj_data_id, contact_pairs.data() + number_of_level_contacts + shape_num_contact[i]);
+    }
+}
+
+void ChCBroadphase::SweepAndPruneBroadphase() {
+    LOG(TRACE) << "ChCBroadphase::SweepAndPruneBroadphase()";
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+
+    // Start from scratch if collision shapes were added or removed
+    if (sap_shape_body != obj_data_id)
+        SweepAndPruneRebuild();
+    else
+        SweepAndPruneUpdate();
+
+    LOG(TRACE) << "Number of overlapping pairs: " << sap_pairs.size() << " added: " << sap_pairs_added.size()
+               << " removed: " << sap_pairs_removed.size();
+
+    // The overlapping pairs are kept regardless of collision families and body activity,
+    // which can change without any motion; filter them here.
+    contact_pairs.resize(sap_pairs.size());
+    auto end = thrust::copy_if(THRUST_PAR sap_pairs.begin(), sap_pairs.end(), contact_pairs.begin(),
+                               [&](long long pair) {
+                                   uint shapeA = (uint)(pair >> 32);
+                                   uint shapeB = (uint)(pair & 0xffffffff);
+                                   return (obj_active[obj_data_id[shapeA]] || obj_active[obj_data_id[shapeB]]) &&
+                                          collide(fam_data[shapeA], fam_data[shapeB]);
+                               });
+    number_of_contacts_possible = (uint)(end - contact_pairs.begin());
+    contact_pairs.resize(number_of_contacts_possible);
+    LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+}
+
+void ChCBroadphase::SweepAndPruneRebuild() {
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    const uint num_shapes = data_manager->num_rigid_shapes;
+
+    sap_shape_body = obj_data_id;
+
+#pragma omp parallel for
+    for (int axis = 0; axis < 3; axis++) {
+        custom_vector<uint>& endpoints = sap_endpoints[axis];
+        endpoints.resize(2 * num_shapes);
+        for (uint i = 0; i < num_shapes; i++) {
+            endpoints[2 * i] = i << 1;
+            endpoints[2 * i + 1] = i << 1 | 1;
+        }
+        std::sort(endpoints.begin(), endpoints.end(),
+                  [&](uint a, uint b) { return f_SAP_Less(a, b, axis, aabb_min, aabb_max); });
+    }
+
+    // Sweep along the first axis: each shape is tested against the shapes whose interval is open
+    sap_pairs.clear();
+    custom_vector<uint> open;
+    custom_vector<uint> open_index(num_shapes);
+    for (uint endpoint : sap_endpoints[0]) {
+        uint shapeA = endpoint >> 1;
+        if (endpoint & 1) {
+            uint k = open_index[shapeA];
+            open[k] = open.back();
+            open_index[open[k]] = k;
+            open.pop_back();
+            continue;
+        }
+        for (uint shapeB : open) {
+            if (obj_data_id[shapeA] != obj_data_id[shapeB] &&
+                overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+                sap_pairs.push_back(f_SAP_Pair(shapeA, shapeB));
+        }
+        open_index[shapeA] = (uint)open.size();
+        open.push_back(shapeA);
+    }
+    Thrust_Sort(sap_pairs);
+
+    sap_pairs_added = sap_pairs;
+    sap_pairs_removed.clear();
+}
+
+void ChCBroadphase::SweepAndPruneUpdate() {
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+
+    // Sort the endpoints of the three axes, starting from the order of the previous step.
+    // The overlap of two AABBs can only change if their endpoints are swapped along some axis.
+#pragma omp parallel for
+    for (int axis = 0; axis < 3; axis++) {
+        sap_swapped[axis].clear();
+        f_SAP_Insertion_Sort(axis, aabb_min, aabb_max, sap_endpoints[axis], sap_swapped[axis]);
+    }
+
+    custom_vector<long long>& candidates = sap_swapped[0];
+    candidates.insert(candidates.end(), sap_swapped[1].begin(), sap_swapped[1].end());
+    candidates.insert(candidates.end(), sap_swapped[2].begin(), sap_swapped[2].end());
+    Thrust_Sort(candidates);
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    sap_pairs_added.clear();
+    sap_pairs_removed.clear();
+    for (long long pair : candidates) {
+        uint shapeA = (uint)(pair >> 32);
+        uint shapeB = (uint)(pair & 0xffffffff);
+        bool overlapping = obj_data_id[shapeA] != obj_data_id[shapeB] &&
+                           overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]);
+        bool listed = std::binary_search(sap_pairs.begin(), sap_pairs.end(), pair);
+        if (overlapping && !listed)
+            sap_pairs_added.push_back(pair);
+        else if (!overlapping && listed)
+            sap_pairs_removed.push_back(pair);
+    }
+
+    if (sap_pairs_added.empty() && sap_pairs_removed.empty())
+        return;
+
+    // Both lists are sorted, as the candidates
+    custom_vector<long long> kept;
+    kept.reserve(sap_pairs.size());
+    std::set_difference(sap_pairs.begin(), sap_pairs.end(), sap_pairs_removed.begin(), sap_pairs_removed.end(),
+                        std::back_inserter(kept));
+    sap_pairs.clear();
+    std::set_union(kept.begin(), kept.end(), sap_pairs_added.begin(), sap_pairs_added.end(),
+                   std::back_inserter(sap_pairs));
+}
 //======
 }
 }
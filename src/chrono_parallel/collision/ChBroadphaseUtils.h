@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "chrono_parallel/ChParallelDefines.h"
 #include "chrono_parallel/math/ChParallelMath.h"
 #include "chrono_parallel/ChDataManager.h"
@@ -399,5 +401,312 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
         }
     }
 }
+
+// MULTI LEVEL FUNCTIONS====================================================================================
+// The grid levels are coarser by a constant ratio. Each shape is stored in the bins of a single level, the
+// finest one with bins at least as large as its AABB. The hash values of the bins of level l start at
+// level_offset[l], so that the bins of all levels are sorted together.
+
+// Find the grid level of a shape===========================================================================
+static inline uint f_ML_Shape_Level(const uint index,
+                                    const uint max_levels,
+                                    const real3& bin_size,
+                                    const real ratio,
+                                    const custom_vector<real3>& aabb_min,
+                                    const custom_vector<real3>& aabb_max) {
+    real3 extent = aabb_max[index] - aabb_min[index];
+    real3 level_bin_size = bin_size;
+    uint level = 0;
+    while (level + 1 < max_levels &&
+           (extent.x > level_bin_size.x || extent.y > level_bin_size.y || extent.z > level_bin_size.z)) {
+        level_bin_size = level_bin_size * ratio;
+        level++;
+    }
+    return level;
+}
+
+// Find the grid level of a bin from its hash value=========================================================
+static inline uint f_ML_Bin_Level(const uint bin, const custom_vector<uint>& level_offset) {
+    uint level = 0;
+    while (level + 2 < level_offset.size() && bin >= level_offset[level + 1]) {
+        level++;
+    }
+    return level;
+}
+
+// Find the range of bins of a grid level intersected by an AABB============================================
+static inline void f_ML_Bin_Range(const real3& Amin,
+                                  const real3& Amax,
+                                  const real3& inv_bin_size,
+                                  const vec3& bins_per_axis,
+                                  vec3& gmin,
+                                  vec3& gmax) {
+    vec3 max_clamp = bins_per_axis - vec3(1);
+    gmin = Clamp(HashMin(Amin, inv_bin_size), vec3(0), max_clamp);
+    gmax = Clamp(HashMax(Amax, inv_bin_size), gmin, max_clamp);
+}
+
+// Check if two shapes are a possible contact, reported in the given bin of a grid level====================
+// The contact is reported only in the bin that contains the lower corner of the intersection of the AABBs.
+static inline bool f_ML_Check_AABB_AABB(const uint shapeA,
+                                        const uint shapeB,
+                                        const uint bin,
+                                        const uint offset,
+                                        const real3& inv_bin_size,
+                                        const vec3& bins_per_axis,
+                                        const custom_vector<real3>& aabb_min_data,
+                                        const custom_vector<real3>& aabb_max_data,
+                                        const custom_vector<short2>& fam_data,
+                                        const custom_vector<char>& body_active,
+                                        const custom_vector<uint>& body_id) {
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+    if (shapeA == shapeB)
+        return false;
+    if (bodyA == bodyB)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    if (!collide(fam_data[shapeA], fam_data[shapeB]))
+        return false;
+
+    real3 Amin = aabb_min_data[shapeA];
+    real3 Amax = aabb_max_data[shapeA];
+    real3 Bmin = aabb_min_data[shapeB];
+    real3 Bmax = aabb_max_data[shapeB];
+    if (!overlap(Amin, Amax, Bmin, Bmax))
+        return false;
+
+    vec3 max_clamp = bins_per_axis - vec3(1);
+    vec3 cell = Clamp(HashMin(Max(Amin, Bmin), inv_bin_size), vec3(0), max_clamp);
+    return offset + Hash_Index(cell, bins_per_axis) == bin;
+}
+
+// Count the bins intersected by each shape in its grid level===============================================
+static inline void f_ML_Count_AABB_BIN_Intersection(const uint index,
+                                                    const custom_vector<real3>& level_inv_bin_size,
+                                                    const custom_vector<vec3>& level_bins_per_axis,
+                                                    const custom_vector<uint>& shape_level,
+                                                    const custom_vector<real3>& aabb_min,
+                                                    const custom_vector<real3>& aabb_max,
+                                                    custom_vector<uint>& bins_intersected) {
+    uint level = shape_level[index];
+    vec3 gmin, gmax;
+    f_ML_Bin_Range(aabb_min[index], aabb_max[index], level_inv_bin_size[level], level_bins_per_axis[level], gmin,
+                   gmax);
+    bins_intersected[index] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+}
+
+// Store the bins intersected by each shape in its grid level===============================================
+static inline void f_ML_Store_AABB_BIN_Intersection(const uint index,
+                                                    const custom_vector<real3>& level_inv_bin_size,
+                                                    const custom_vector<vec3>& level_bins_per_axis,
+                                                    const custom_vector<uint>& level_offset,
+                                                    const custom_vector<uint>& shape_level,
+                                                    const custom_vector<real3>& aabb_min,
+                                                    const custom_vector<real3>& aabb_max,
+                                                    const custom_vector<uint>& bins_intersected,
+                                                    custom_vector<uint>& bin_number,
+                                                    custom_vector<uint>& aabb_number) {
+    uint level = shape_level[index];
+    const vec3& bins_per_axis = level_bins_per_axis[level];
+    vec3 gmin, gmax;
+    f_ML_Bin_Range(aabb_min[index], aabb_max[index], level_inv_bin_size[level], bins_per_axis, gmin, gmax);
+    uint mInd = bins_intersected[index];
+    uint count = 0;
+    for (int i = gmin.x; i <= gmax.x; i++) {
+        for (int j = gmin.y; j <= gmax.y; j++) {
+            for (int k = gmin.z; k <= gmax.z; k++) {
+                bin_number[mInd + count] = level_offset[level] + Hash_Index(vec3(i, j, k), bins_per_axis);
+                aabb_number[mInd + count] = index;
+                count++;
+            }
+        }
+    }
+}
+
+// Count the AABB-AABB intersections in a bin (shapes in the same grid level)===============================
+static inline void f_ML_Count_AABB_AABB_Intersection(const uint index,
+                                                     const custom_vector<real3>& level_inv_bin_size,
+                                                     const custom_vector<vec3>& level_bins_per_axis,
+                                                     const custom_vector<uint>& level_offset,
+                                                     const custom_vector<real3>& aabb_min_data,
+                                                     const custom_vector<real3>& aabb_max_data,
+                                                     const custom_vector<uint>& bin_number,
+                                                     const custom_vector<uint>& aabb_number,
+                                                     const custom_vector<uint>& bin_start_index,
+                                                     const custom_vector<short2>& fam_data,
+                                                     const custom_vector<char>& body_active,
+                                                     const custom_vector<uint>& body_id,
+                                                     custom_vector<uint>& num_contact) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    uint bin = bin_number[index];
+    uint level = f_ML_Bin_Level(bin, level_offset);
+    uint count = 0;
+    for (uint i = start; i < end; i++) {
+        for (uint k = i + 1; k < end; k++) {
+            if (f_ML_Check_AABB_AABB(aabb_number[i], aabb_number[k], bin, level_offset[level],
+                                     level_inv_bin_size[level], level_bins_per_axis[level], aabb_min_data,
+                                     aabb_max_data, fam_data, body_active, body_id))
+                count++;
+        }
+    }
+    num_contact[index] = count;
+}
+
+// Store the AABB-AABB intersections in a bin (shapes in the same grid level)===============================
+static inline void f_ML_Store_AABB_AABB_Intersection(const uint index,
+                                                     const custom_vector<real3>& level_inv_bin_size,
+                                                     const custom_vector<vec3>& level_bins_per_axis,
+                                                     const custom_vector<uint>& level_offset,
+                                                     const custom_vector<real3>& aabb_min_data,
+                                                     const custom_vector<real3>& aabb_max_data,
+                                                     const custom_vector<uint>& bin_number,
+                                                     const custom_vector<uint>& aabb_number,
+                                                     const custom_vector<uint>& bin_start_index,
+                                                     const custom_vector<uint>& num_contact,
+                                                     const custom_vector<short2>& fam_data,
+                                                     const custom_vector<char>& body_active,
+                                                     const custom_vector<uint>& body_id,
+                                                     custom_vector<long long>& potential_contacts) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    uint bin = bin_number[index];
+    uint level = f_ML_Bin_Level(bin, level_offset);
+    uint offset = num_contact[index];
+    uint count = 0;
+    for (uint i = start; i < end; i++) {
+        for (uint k = i + 1; k < end; k++) {
+            uint shapeA = aabb_number[i];
+            uint shapeB = aabb_number[k];
+            if (!f_ML_Check_AABB_AABB(shapeA, shapeB, bin, level_offset[level], level_inv_bin_size[level],
+                                      level_bins_per_axis[level], aabb_min_data, aabb_max_data, fam_data,
+                                      body_active, body_id))
+                continue;
+            if (shapeB < shapeA) {
+                uint t = shapeA;
+                shapeA = shapeB;
+                shapeB = t;
+            }
+            potential_contacts[offset + count] = ((long long)shapeA << 32 | (long long)shapeB);
+            count++;
+        }
+    }
+}
+
+// Count or store the AABB-AABB intersections of a shape with the shapes of the coarser grid levels=========
+// The shape is hashed in each coarser level and the shapes in the active bins it intersects are tested.
+// Contacts are stored only if potential_contacts is not NULL.
+static inline uint f_ML_Process_AABB_Level_Intersection(const uint shapeA,
+                                                        const uint num_levels,
+                                                        const uint num_bins_active,
+                                                        const custom_vector<real3>& level_inv_bin_size,
+                                                        const custom_vector<vec3>& level_bins_per_axis,
+                                                        const custom_vector<uint>& level_offset,
+                                                        const custom_vector<uint>& shape_level,
+                                                        const custom_vector<real3>& aabb_min_data,
+                                                        const custom_vector<real3>& aabb_max_data,
+                                                        const custom_vector<uint>& bin_number,
+                                                        const custom_vector<uint>& aabb_number,
+                                                        const custom_vector<uint>& bin_start_index,
+                                                        const custom_vector<short2>& fam_data,
+                                                        const custom_vector<char>& body_active,
+                                                        const custom_vector<uint>& body_id,
+                                                        long long* potential_contacts) {
+    uint count = 0;
+    for (uint level = shape_level[shapeA] + 1; level < num_levels; level++) {
+        const vec3& bins_per_axis = level_bins_per_axis[level];
+        vec3 gmin, gmax;
+        f_ML_Bin_Range(aabb_min_data[shapeA], aabb_max_data[shapeA], level_inv_bin_size[level], bins_per_axis, gmin,
+                       gmax);
+        for (int i = gmin.x; i <= gmax.x; i++) {
+            for (int j = gmin.y; j <= gmax.y; j++) {
+                for (int k = gmin.z; k <= gmax.z; k++) {
+                    uint bin = level_offset[level] + Hash_Index(vec3(i, j, k), bins_per_axis);
+                    // Active bins are sorted by hash value
+                    auto it = std::lower_bound(bin_number.begin(), bin_number.begin() + num_bins_active, bin);
+                    if (it == bin_number.begin() + num_bins_active || *it != bin)
+                        continue;
+                    uint index = (uint)(it - bin_number.begin());
+                    for (uint p = bin_start_index[index]; p < bin_start_index[index + 1]; p++) {
+                        uint shapeB = aabb_number[p];
+                        if (!f_ML_Check_AABB_AABB(shapeA, shapeB, bin, level_offset[level], level_inv_bin_size[level],
+                                                  bins_per_axis, aabb_min_data, aabb_max_data, fam_data,
+                                                  body_active, body_id))
+                            continue;
+                        if (potential_contacts) {
+                            uint s0 = shapeA < shapeB ? shapeA : shapeB;
+                            uint s1 = shapeA < shapeB ? shapeB : shapeA;
+                            potential_contacts[count] = ((long long)s0 << 32 | (long long)s1);
+                        }
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+// SWEEP AND PRUNE FUNCTIONS================================================================================
+// The endpoints of the AABBs along an axis are encoded as (shape << 1 | is_max).
+
+// Value of an endpoint along an axis========================================================================
+static inline real f_SAP_Value(const uint endpoint,
+                               const int axis,
+                               const custom_vector<real3>& aabb_min,
+                               const custom_vector<real3>& aabb_max) {
+    uint shape = endpoint >> 1;
+    return (endpoint & 1) ? aabb_max[shape][axis] : aabb_min[shape][axis];
+}
+
+// Order of the endpoints along an axis=====================================================================
+// Endpoints with the same value are sorted with minimum endpoints first, so that the AABBs of two shapes
+// overlap along the axis if and only if the minimum endpoint of each one precedes the maximum of the other.
+static inline bool f_SAP_Less(const uint endpointA,
+                              const uint endpointB,
+                              const int axis,
+                              const custom_vector<real3>& aabb_min,
+                              const custom_vector<real3>& aabb_max) {
+    real a = f_SAP_Value(endpointA, axis, aabb_min, aabb_max);
+    real b = f_SAP_Value(endpointB, axis, aabb_min, aabb_max);
+    if (a != b)
+        return a < b;
+    return (endpointA & 1) < (endpointB & 1);
+}
+
+// Encode a pair of shapes, as in the contact list==========================================================
+static inline long long f_SAP_Pair(uint shapeA, uint shapeB) {
+    if (shapeB < shapeA) {
+        uint t = shapeA;
+        shapeA = shapeB;
+        shapeB = t;
+    }
+    return ((long long)shapeA << 32 | (long long)shapeB);
+}
+
+// Insertion sort of the endpoints along an axis============================================================
+// Every swap of a minimum and a maximum endpoint of two shapes changes their overlap along the axis; these
+// pairs are appended to swapped_pairs. With small motions the endpoints are almost sorted, so the cost is
+// linear in the number of endpoints plus the number of swaps.
+static void f_SAP_Insertion_Sort(const int axis,
+                                 const custom_vector<real3>& aabb_min,
+                                 const custom_vector<real3>& aabb_max,
+                                 custom_vector<uint>& endpoints,
+                                 custom_vector<long long>& swapped_pairs) {
+    for (size_t i = 1; i < endpoints.size(); i++) {
+        uint endpoint = endpoints[i];
+        size_t j = i;
+        while (j > 0 && f_SAP_Less(endpoint, endpoints[j - 1], axis, aabb_min, aabb_max)) {
+            uint other = endpoints[j - 1];
+            if ((endpoint & 1) != (other & 1) && (endpoint >> 1) != (other >> 1))
+                swapped_pairs.push_back(f_SAP_Pair(endpoint >> 1, other >> 1));
+            endpoints[j] = other;
+            j--;
+        }
+        endpoints[j] = endpoint;
+    }
+}
 }
 }
@@ -41,6 +41,13 @@ class CH_PARALLEL_API ChCBroadphase {
     ChCBroadphase();
     void DispatchRigid();
     void OneLevelBroadphase();
+    // Hierarchical grid: shapes are binned in the grid level matching their size
+    // (see collision_settings::max_grid_levels)
+    void MultiLevelBroadphase();
+    // Incremental sweep and prune (see collision_settings::broadphase_type)
+    void SweepAndPruneBroadphase();
+    // Discard the sweep and prune data kept between steps (needed when the shapes are reordered)
+    void Reset() { sap_shape_body.clear(); }
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -49,7 +56,27 @@ class CH_PARALLEL_API ChCBroadphase {
     void TetBoundingBox();
     ChParallelDataManager* data_manager;
 
+    // Pairs of shapes whose AABBs started or stopped overlapping at the last sweep and prune update
+    const custom_vector<long long>& GetPairsAdded() const { return sap_pairs_added; }
+    const custom_vector<long long>& GetPairsRemoved() const { return sap_pairs_removed; }
+
   private:
+    void SweepAndPruneRebuild();
+    void SweepAndPruneUpdate();
+
+    // Resolution of each level of the hierarchical grid
+    custom_vector<vec3> level_bins_per_axis;
+    custom_vector<real3> level_inv_bin_size;
+    // Hash value of the first bin of each level (the last entry is the total number of bins)
+    custom_vector<uint> level_offset;
+
+    // Sweep and prune data kept between steps
+    custom_vector<uint> sap_endpoints[3];      // AABB endpoints sorted along each axis
+    custom_vector<long long> sap_swapped[3];   // pairs swapped along each axis during the update
+    custom_vector<uint> sap_shape_body;        // body of each shape when the endpoints were built
+    custom_vector<long long> sap_pairs;        // pairs of shapes with overlapping AABBs (sorted)
+    custom_vector<long long> sap_pairs_added;
+    custom_vector<long long> sap_pairs_removed;
 };
 
 class CH_PARALLEL_API ChCNarrowphaseDispatch {
@@ -130,6 +157,15 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     void DispatchHybridMPR();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
+    // Compact the contact data, keeping the contacts flagged as active
+    void RemoveInactiveContacts();
+    // Reuse the contacts of the shape pairs that moved little since they were computed
+    // (see collision_settings::manifold_tolerance)
+    void ReuseManifolds();
+    // Store the contacts of this step for reuse
+    void UpdateManifolds();
+    // Limit the number of contacts between two bodies (see collision_settings::max_manifold_points)
+    void ReduceManifolds();
     ChParallelDataManager* data_manager;
 
   private:
@@ -137,6 +173,7 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     custom_vector<char> contact_rigid_fluid_active;
     custom_vector<char> contact_fluid_active;
     custom_vector<uint> contact_index;
+    custom_vector<char> contact_pair_reused;
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
@@ -161,6 +198,16 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     custom_vector<uint> t_bin_number_out;
     custom_vector<uint> t_bin_fluid_number;
     custom_vector<uint> t_bin_start_index;
+
+    // Contacts kept for reuse, by pair of shapes
+    custom_vector<long long> manifold_pairs;  // pairs of shapes (sorted)
+    custom_vector<uint> manifold_start;       // first contact of each pair (the last entry is the number of contacts)
+    custom_vector<char> manifold_reused;      // the pair was reused at this step
+    custom_vector<real3> manifold_ptA;        // point on shape A, in the frame of body A
+    custom_vector<real3> manifold_ptB;        // point on shape B, in the frame of body B
+    custom_vector<real3> manifold_ptB_A;      // point on shape B, in the frame of body A
+    custom_vector<real3> manifold_norm;       // contact normal, in the frame of body A
+    custom_vector<real> manifold_erad;        // effective radius
 };
 }
 }
@@ -186,6 +186,14 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
     /// The 'another' model must be of ChModelBullet subclass.
     virtual bool AddCopyOfAnotherModel(ChCollisionModel* another) override;
 
+    /// Add a shape given by its description, as stored in mData (in the centroidal frame).
+    /// Used to rebuild a model from the shapes of another one, e.g. received from another process.
+    /// Only for primitive shapes (shapes with convex data are not supported).
+    void AddShape(const ConvexModel& shape) {
+        nObjects++;
+        mData.push_back(shape);
+    }
+
     /// Return the axis aligned bounding box for this collision model.
     virtual void GetAABB(ChVector<>& bbmin, ChVector<>& bbmax) const override;
 
@@ -244,6 +244,243 @@ void ChCollisionSystemParallel::GetOverlappingAABB(custom_vector<char>& active_i
     }
 }
 
+// -----------------------------------------------------------------------------
+// Intersection of the segment p + t*d, t in [0,1], with a shape in its local frame.
+// They return the parameter t of the entry point and the outward normal there;
+// segments starting inside the shape give no hit.
+
+static bool _RaySphere(const real3& p, const real3& d, real r, real& t, real3& n) {
+    real a = Dot(d, d);
+    real b = Dot(p, d);
+    real c = Dot(p, p) - r * r;
+    real disc = b * b - a * c;
+    if (a == 0 || c < 0 || disc < 0)
+        return false;
+    t = (-b - Sqrt(disc)) / a;
+    if (t < 0 || t > 1)
+        return false;
+    n = (p + t * d) / r;
+    return true;
+}
+
+static bool _RayEllipsoid(const real3& p, const real3& d, const real3& B, real& t, real3& n) {
+    real3 n_unit;
+    if (!_RaySphere(p / B, d / B, 1, t, n_unit))
+        return false;
+    n = Normalize(n_unit / B);
+    return true;
+}
+
+static bool _RayBox(const real3& p, const real3& d, const real3& B, real& t, real3& n) {
+    real t_enter = 0;
+    real t_exit = 1;
+    int axis = -1;
+    for (int k = 0; k < 3; k++) {
+        if (Abs(d[k]) < C_EPSILON) {
+            if (Abs(p[k]) > B[k])
+                return false;
+            continue;
+        }
+        real t1 = (-B[k] - p[k]) / d[k];
+        real t2 = (B[k] - p[k]) / d[k];
+        if (t1 > t2)
+            Swap(t1, t2);
+        if (t1 > t_enter) {
+            t_enter = t1;
+            axis = k;
+        }
+        t_exit = Min(t_exit, t2);
+        if (t_enter > t_exit)
+            return false;
+    }
+    if (axis < 0)
+        return false;
+    t = t_enter;
+    n = real3(0);
+    n[axis] = d[axis] < 0 ? 1 : -1;
+    return true;
+}
+
+// Cylinder with axis along Y, radius B.x and half-height B.y (as in GetSupportPoint_Cylinder).
+static bool _RayCylinder(const real3& p, const real3& d, const real3& B, real& t, real3& n) {
+    real r = B.x;
+    real h = B.y;
+    bool found = false;
+    // Lateral surface
+    real a = d.x * d.x + d.z * d.z;
+    real b = p.x * d.x + p.z * d.z;
+    real c = p.x * p.x + p.z * p.z - r * r;
+    real disc = b * b - a * c;
+    if (a > 0 && c > 0 && disc >= 0) {
+        real tl = (-b - Sqrt(disc)) / a;
+        real y = p.y + tl * d.y;
+        if (tl >= 0 && tl <= 1 && Abs(y) <= h) {
+            t = tl;
+            n = real3(p.x + tl * d.x, 0, p.z + tl * d.z) / r;
+            found = true;
+        }
+    }
+    // Cap facing the start point
+    if (Abs(p.y) > h && Abs(d.y) > C_EPSILON) {
+        real s = p.y > 0 ? real(1) : real(-1);
+        real tc = (s * h - p.y) / d.y;
+        real x = p.x + tc * d.x;
+        real z = p.z + tc * d.z;
+        if (tc >= 0 && tc <= 1 && x * x + z * z <= r * r && (!found || tc < t)) {
+            t = tc;
+            n = real3(0, s, 0);
+            found = true;
+        }
+    }
+    return found;
+}
+
+// Triangle in absolute frame (Moller-Trumbore).
+static bool _RayTriangle(const real3& p,
+                         const real3& d,
+                         const real3& A,
+                         const real3& B,
+                         const real3& C,
+                         real& t,
+                         real3& n) {
+    real3 e1 = B - A;
+    real3 e2 = C - A;
+    real3 pv = Cross(d, e2);
+    real det = Dot(e1, pv);
+    if (Abs(det) < C_EPSILON)
+        return false;
+    real3 tv = p - A;
+    real u = Dot(tv, pv) / det;
+    if (u < 0 || u > 1)
+        return false;
+    real3 qv = Cross(tv, e1);
+    real v = Dot(d, qv) / det;
+    if (v < 0 || u + v > 1)
+        return false;
+    t = Dot(e2, qv) / det;
+    if (t < 0 || t > 1)
+        return false;
+    n = Normalize(Cross(e1, e2));
+    if (Dot(n, d) > 0)
+        n = -n;
+    return true;
+}
+
+// Check if the segment p + t*d, t in [0,t_max], overlaps the box [bmin, bmax].
+static bool _RayAABB(const real3& p, const real3& d, const real3& bmin, const real3& bmax, real t_max) {
+    real t_enter = 0;
+    real t_exit = t_max;
+    for (int k = 0; k < 3; k++) {
+        if (Abs(d[k]) < C_EPSILON) {
+            if (p[k] < bmin[k] || p[k] > bmax[k])
+                return false;
+            continue;
+        }
+        real t1 = (bmin[k] - p[k]) / d[k];
+        real t2 = (bmax[k] - p[k]) / d[k];
+        if (t1 > t2)
+            Swap(t1, t2);
+        t_enter = Max(t_enter, t1);
+        t_exit = Min(t_exit, t2);
+        if (t_enter > t_exit)
+            return false;
+    }
+    return true;
+}
+
+bool ChCollisionSystemParallel::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) {
+    std::vector<ChRay> rays(1);
+    rays[0].from = from;
+    rays[0].to = to;
+    std::vector<ChRayhitResult> results;
+    RayHitBatch(rays, results);
+    mresult = results[0];
+    return mresult.hit;
+}
+
+void ChCollisionSystemParallel::RayHitBatch(const std::vector<ChRay>& rays,
+                                           std::vector<ChRayhitResult>& results,
+                                           short int family_mask) {
+    results.resize(rays.size());
+
+    const shape_container& shape_data = data_manager->shape_data;
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<char>& collide = data_manager->host_data.collide_rigid;
+    // The bounding boxes are stored relative to the origin of the broadphase grid
+    real3 origin = data_manager->measures.collision.global_origin;
+    int num_shapes = (int)shape_data.obj_data_A_global.size();
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int i = 0; i < (int)rays.size(); i++) {
+        real3 from(rays[i].from.x(), rays[i].from.y(), rays[i].from.z());
+        real3 to(rays[i].to.x(), rays[i].to.y(), rays[i].to.z());
+        real3 dir = to - from;
+
+        real t_hit = 1;
+        real3 n_hit;
+        int shape_hit = -1;
+
+        for (int s = 0; s < num_shapes; s++) {
+            uint id = shape_data.id_rigid[s];
+            // As in the Bullet collision system, rays are in family 0
+            if (!(shape_data.fam_rigid[s].x & family_mask) || !(shape_data.fam_rigid[s].y & 1) || !collide[id])
+                continue;
+            if (!_RayAABB(from, dir, aabb_min[s] + origin, aabb_max[s] + origin, t_hit))
+                continue;
+
+            real t;
+            real3 n;
+            bool hit = false;
+            int type = shape_data.typ_rigid[s];
+            int start = shape_data.start_rigid[s];
+            if (type == TRIANGLEMESH) {
+                hit = _RayTriangle(from, dir, shape_data.triangle_global[start], shape_data.triangle_global[start + 1],
+                                   shape_data.triangle_global[start + 2], t, n);
+            } else {
+                // Segment in the shape frame
+                const real3& A = shape_data.obj_data_A_global[s];
+                const quaternion& R = shape_data.obj_data_R_global[s];
+                real3 p = RotateT(from - A, R);
+                real3 d = RotateT(dir, R);
+                switch (type) {
+                    case SPHERE:
+                        hit = _RaySphere(p, d, shape_data.sphere_rigid[start], t, n);
+                        break;
+                    case ELLIPSOID:
+                        hit = _RayEllipsoid(p, d, shape_data.box_like_rigid[start], t, n);
+                        break;
+                    case BOX:
+                        hit = _RayBox(p, d, shape_data.box_like_rigid[start], t, n);
+                        break;
+                    case CYLINDER:
+                        hit = _RayCylinder(p, d, shape_data.box_like_rigid[start], t, n);
+                        break;
+                }
+                if (hit)
+                    n = Rotate(n, R);
+            }
+
+            if (hit && t <= t_hit) {
+                t_hit = t;
+                n_hit = n;
+                shape_hit = s;
+            }
+        }
+
+        ChRayhitResult& mresult = results[i];
+        mresult.hit = shape_hit >= 0;
+        if (mresult.hit) {
+            uint id = shape_data.id_rigid[shape_hit];
+            real3 point = from + t_hit * dir;
+            mresult.hitModel = (*data_manager->body_list)[id]->GetCollisionModel().get();
+            mresult.abs_hitPoint.Set(point.x, point.y, point.z);
+            mresult.abs_hitNormal.Set(n_hit.x, n_hit.y, n_hit.z);
+            mresult.dist_factor = t_hit;
+        }
+    }
+}
+
 std::vector<vec2> ChCollisionSystemParallel::GetOverlappingPairs() {
     std::vector<vec2> pairs;
     pairs.resize(data_manager->host_data.contact_pairs.size());
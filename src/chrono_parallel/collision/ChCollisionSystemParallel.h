@@ -85,7 +85,16 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     virtual void ReportProximities(ChProximityContainerBase* mproximitycontainer) {}
 
     /// Perform a raycast (ray-hit test with the collision models).
-    virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) { return false; }
+    /// Spheres, ellipsoids, boxes, cylinders and triangles are supported; other shapes are not hit.
+    /// Uses the shape positions of the last call to Run().
+    virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult);
+
+    /// Perform a batch of raycasts, in parallel (see ChCollisionSystem::RayHitBatch and RayHit).
+    /// Each ray is tested against the bounding boxes of all the shapes in the given families, whose
+    /// family masks do not exclude family 0.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             short int family_mask = 0x7FFF);
 
     std::vector<vec2> GetOverlappingPairs();
     void GetOverlappingAABB(custom_vector<char>& active_id, real3 Amin, real3 Amax);
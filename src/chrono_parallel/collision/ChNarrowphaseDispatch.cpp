@@ -188,6 +188,9 @@ void ChCNarrowphaseDispatch::DispatchMPR() {
 
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        if (contact_pair_reused[index]) {
+            continue;
+        }
         uint ID_A, ID_B, icoll;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
@@ -213,6 +216,9 @@ void ChCNarrowphaseDispatch::DispatchR() {
 
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        if (contact_pair_reused[index]) {
+            continue;
+        }
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -238,6 +244,9 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
 
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        if (contact_pair_reused[index]) {
+            continue;
+        }
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -291,6 +300,15 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    // Contacts of the pairs that moved little since the last step are reused
+    contact_pair_reused.resize(num_potential_rigid_contacts);
+    Thrust_Fill(contact_pair_reused, false);
+    data_manager->measures.collision.number_of_manifolds_reused = 0;
+    data_manager->measures.collision.number_of_contacts_reduced = 0;
+    if (data_manager->settings.collision.manifold_tolerance > 0) {
+        ReuseManifolds();
+    }
+
     switch (narrowphase_algorithm) {
         case NarrowPhaseType::NARROWPHASE_MPR:
             DispatchMPR();
@@ -303,6 +321,41 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
             break;
     }
 
+    // Each potential contact keeps the pair of shapes it was found for (a pair may have more than one)
+    custom_vector<long long> contact_shapes(num_potentialContacts);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        for (uint i = contact_index[index]; i < contact_index[index + 1]; i++) {
+            contact_shapes[i] = contact_pairs[index];
+        }
+    }
+    contact_pairs.swap(contact_shapes);
+
+    RemoveInactiveContacts();
+
+    if (data_manager->settings.collision.max_manifold_points > 0) {
+        ReduceManifolds();
+    }
+    if (data_manager->settings.collision.manifold_tolerance > 0) {
+        UpdateManifolds();
+    } else {
+        manifold_pairs.clear();
+        manifold_start.clear();
+        manifold_reused.clear();
+    }
+    LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
+}
+
+void ChCNarrowphaseDispatch::RemoveInactiveContacts() {
+    custom_vector<real3>& norm_data = data_manager->host_data.norm_rigid_rigid;
+    custom_vector<real3>& cpta_data = data_manager->host_data.cpta_rigid_rigid;
+    custom_vector<real3>& cptb_data = data_manager->host_data.cptb_rigid_rigid;
+    custom_vector<real>& dpth_data = data_manager->host_data.dpth_rigid_rigid;
+    custom_vector<real>& erad_data = data_manager->host_data.erad_rigid_rigid;
+    custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    uint& num_rigid_contacts = data_manager->num_rigid_contacts;
+
     num_rigid_contacts = (uint)Thrust_Count(contact_rigid_active, 1);
     // Remove elements corresponding to inactive contacts. We do this in one step,
     // using zip iterators and removing all entries for which contact_active is 'false'.
@@ -322,7 +375,265 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_pairs.resize(num_rigid_contacts);
-    LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
+}
+
+// A pair of shapes is reused if the contact points on shape B have moved by less than the tolerance
+// in the frame of body A since its contacts were computed: their points, fixed on the bodies, and
+// normal, fixed on body A, are then transformed with the current body positions.
+void ChCNarrowphaseDispatch::ReuseManifolds() {
+    real3* norm = data_manager->host_data.norm_rigid_rigid.data();
+    real3* ptA = data_manager->host_data.cpta_rigid_rigid.data();
+    real3* ptB = data_manager->host_data.cptb_rigid_rigid.data();
+    real* contactDepth = data_manager->host_data.dpth_rigid_rigid.data();
+    real* effective_radius = data_manager->host_data.erad_rigid_rigid.data();
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<uint>& obj_data_ID = data_manager->shape_data.id_rigid;
+    const custom_vector<real3>& body_pos = data_manager->host_data.pos_rigid;
+    const custom_vector<quaternion>& body_rot = data_manager->host_data.rot_rigid;
+    real tolerance = data_manager->settings.collision.manifold_tolerance;
+
+    Thrust_Fill(manifold_reused, false);
+    uint num_reused = 0;
+
+#pragma omp parallel for reduction(+ : num_reused)
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        long long pair = contact_pairs[index];
+        auto it = std::lower_bound(manifold_pairs.begin(), manifold_pairs.end(), pair);
+        if (it == manifold_pairs.end() || *it != pair) {
+            continue;
+        }
+        uint k = (uint)(it - manifold_pairs.begin());
+        uint start = manifold_start[k];
+        uint nC = manifold_start[k + 1] - start;
+        uint icoll = contact_index[index];
+        if (nC > contact_index[index + 1] - icoll) {
+            continue;
+        }
+
+        uint ID_A = obj_data_ID[int(pair >> 32)];
+        uint ID_B = obj_data_ID[int(pair & 0xffffffff)];
+        real3 posA = body_pos[ID_A];
+        real3 posB = body_pos[ID_B];
+        quaternion rotA = body_rot[ID_A];
+        quaternion rotB = body_rot[ID_B];
+
+        bool moved = false;
+        for (uint i = start; i < start + nC; i++) {
+            real3 pB = TransformLocalToParent(posB, rotB, manifold_ptB[i]);
+            moved |= Length2(TransformParentToLocal(posA, rotA, pB) - manifold_ptB_A[i]) > tolerance * tolerance;
+        }
+        if (moved) {
+            continue;
+        }
+
+        for (uint i = 0; i < nC; i++) {
+            norm[icoll + i] = Rotate(manifold_norm[start + i], rotA);
+            ptA[icoll + i] = TransformLocalToParent(posA, rotA, manifold_ptA[start + i]);
+            ptB[icoll + i] = TransformLocalToParent(posB, rotB, manifold_ptB[start + i]);
+            contactDepth[icoll + i] = Dot(norm[icoll + i], ptB[icoll + i] - ptA[icoll + i]);
+            effective_radius[icoll + i] = manifold_erad[start + i];
+        }
+        Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+        contact_pair_reused[index] = true;
+        manifold_reused[k] = true;
+        num_reused++;
+    }
+
+    data_manager->measures.collision.number_of_manifolds_reused = num_reused;
+}
+
+// Pairs reused at this step keep the contacts stored when they were computed, so that their motion
+// is always measured from there.
+void ChCNarrowphaseDispatch::UpdateManifolds() {
+    const custom_vector<real3>& norm = data_manager->host_data.norm_rigid_rigid;
+    const custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
+    const custom_vector<real3>& ptB = data_manager->host_data.cptb_rigid_rigid;
+    const custom_vector<real>& effective_radius = data_manager->host_data.erad_rigid_rigid;
+    const custom_vector<vec2>& body_ids = data_manager->host_data.bids_rigid_rigid;
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<real3>& body_pos = data_manager->host_data.pos_rigid;
+    const custom_vector<quaternion>& body_rot = data_manager->host_data.rot_rigid;
+    uint num_contacts = data_manager->num_rigid_contacts;
+
+    // The contacts of a pair of shapes are contiguous
+    custom_vector<uint> run_start;
+    for (uint i = 0; i < num_contacts; i++) {
+        if (i == 0 || contact_pairs[i] != contact_pairs[i - 1]) {
+            run_start.push_back(i);
+        }
+    }
+    uint num_pairs = (uint)run_start.size();
+    run_start.push_back(num_contacts);
+
+    // Pairs are stored sorted
+    custom_vector<long long> pairs(num_pairs);
+    custom_vector<uint> run(num_pairs);
+    Thrust_Sequence(run);
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_pairs; k++) {
+        pairs[k] = contact_pairs[run_start[k]];
+    }
+    Thrust_Sort_By_Key(pairs, run);
+
+    // Previous manifold of the pairs that were reused
+    custom_vector<int> previous(num_pairs);
+    custom_vector<uint> start(num_pairs + 1);
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_pairs; k++) {
+        auto it = std::lower_bound(manifold_pairs.begin(), manifold_pairs.end(), pairs[k]);
+        previous[k] = -1;
+        if (it != manifold_pairs.end() && *it == pairs[k] && manifold_reused[it - manifold_pairs.begin()]) {
+            previous[k] = (int)(it - manifold_pairs.begin());
+        }
+        start[k] = (previous[k] >= 0) ? manifold_start[previous[k] + 1] - manifold_start[previous[k]]
+                                      : run_start[run[k] + 1] - run_start[run[k]];
+    }
+    start[num_pairs] = 0;
+    Thrust_Exclusive_Scan(start);
+
+    uint num_points = start[num_pairs];
+    custom_vector<real3> points_A(num_points);
+    custom_vector<real3> points_B(num_points);
+    custom_vector<real3> points_B_A(num_points);
+    custom_vector<real3> normals(num_points);
+    custom_vector<real> radii(num_points);
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_pairs; k++) {
+        uint j = start[k];
+        if (previous[k] >= 0) {
+            for (uint i = manifold_start[previous[k]]; i < manifold_start[previous[k] + 1]; i++, j++) {
+                points_A[j] = manifold_ptA[i];
+                points_B[j] = manifold_ptB[i];
+                points_B_A[j] = manifold_ptB_A[i];
+                normals[j] = manifold_norm[i];
+                radii[j] = manifold_erad[i];
+            }
+            continue;
+        }
+        for (uint i = run_start[run[k]]; i < run_start[run[k] + 1]; i++, j++) {
+            real3 posA = body_pos[body_ids[i].x];
+            quaternion rotA = body_rot[body_ids[i].x];
+            points_A[j] = TransformParentToLocal(posA, rotA, ptA[i]);
+            points_B[j] = TransformParentToLocal(body_pos[body_ids[i].y], body_rot[body_ids[i].y], ptB[i]);
+            points_B_A[j] = TransformParentToLocal(posA, rotA, ptB[i]);
+            normals[j] = RotateT(norm[i], rotA);
+            radii[j] = effective_radius[i];
+        }
+    }
+
+    manifold_pairs.swap(pairs);
+    manifold_start.swap(start);
+    manifold_ptA.swap(points_A);
+    manifold_ptB.swap(points_B);
+    manifold_ptB_A.swap(points_B_A);
+    manifold_norm.swap(normals);
+    manifold_erad.swap(radii);
+    manifold_reused.resize(num_pairs);
+}
+
+// The contacts between two bodies are grouped by normal. In each group with too many contacts, the
+// deepest one is kept, then repeatedly the one farthest from those already kept, so that the kept
+// contacts are spread over the contact area.
+void ChCNarrowphaseDispatch::ReduceManifolds() {
+    const custom_vector<real3>& norm = data_manager->host_data.norm_rigid_rigid;
+    const custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
+    const custom_vector<real3>& ptB = data_manager->host_data.cptb_rigid_rigid;
+    const custom_vector<real>& contactDepth = data_manager->host_data.dpth_rigid_rigid;
+    const custom_vector<vec2>& body_ids = data_manager->host_data.bids_rigid_rigid;
+    uint num_contacts = data_manager->num_rigid_contacts;
+    uint max_points = data_manager->settings.collision.max_manifold_points;
+    // Contacts with normals closer than this (cosine of the angle) are in the same group
+    const real normal_tolerance = real(0.95);
+
+    // Sort the contacts by pair of bodies
+    custom_vector<long long> body_pairs(num_contacts);
+    custom_vector<uint> order(num_contacts);
+    Thrust_Sequence(order);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        int a = std::min(body_ids[i].x, body_ids[i].y);
+        int b = std::max(body_ids[i].x, body_ids[i].y);
+        body_pairs[i] = ((long long)a << 32) | (long long)b;
+    }
+    thrust::stable_sort_by_key(THRUST_PAR body_pairs.begin(), body_pairs.end(), order.begin());
+
+    custom_vector<uint> pair_start;
+    for (uint i = 0; i < num_contacts; i++) {
+        if (i == 0 || body_pairs[i] != body_pairs[i - 1]) {
+            pair_start.push_back(i);
+        }
+    }
+    uint num_pairs = (uint)pair_start.size();
+    pair_start.push_back(num_contacts);
+
+    contact_rigid_active.resize(num_contacts);
+    Thrust_Fill(contact_rigid_active, true);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < (signed)num_pairs; k++) {
+        if (pair_start[k + 1] - pair_start[k] <= max_points) {
+            continue;
+        }
+        // Normals oriented from the body with smaller index
+        auto normal = [&](uint i) { return body_ids[i].x < body_ids[i].y ? norm[i] : -norm[i]; };
+
+        std::vector<uint> remaining(order.begin() + pair_start[k], order.begin() + pair_start[k + 1]);
+        std::vector<uint> group;
+        std::vector<real> dist2;
+        while (!remaining.empty()) {
+            // Contacts with a normal close to that of the first remaining contact
+            real3 n = normal(remaining[0]);
+            group.clear();
+            size_t num_remaining = 0;
+            for (uint i : remaining) {
+                if (Dot(normal(i), n) > normal_tolerance) {
+                    group.push_back(i);
+                } else {
+                    remaining[num_remaining++] = i;
+                }
+            }
+            remaining.resize(num_remaining);
+            if (group.size() <= max_points) {
+                continue;
+            }
+
+            // Squared distance of each contact to the closest kept one (negative if kept)
+            dist2.assign(group.size(), C_LARGE_REAL);
+            size_t next = 0;
+            for (size_t j = 1; j < group.size(); j++) {
+                if (contactDepth[group[j]] < contactDepth[group[next]]) {
+                    next = j;
+                }
+            }
+            for (uint m = 0; m < max_points; m++) {
+                real3 p = (ptA[group[next]] + ptB[group[next]]) * real(0.5);
+                dist2[next] = -1;
+                real max_dist2 = -1;
+                for (size_t j = 0; j < group.size(); j++) {
+                    if (dist2[j] < 0) {
+                        continue;
+                    }
+                    dist2[j] = Min(dist2[j], Length2((ptA[group[j]] + ptB[group[j]]) * real(0.5) - p));
+                    if (dist2[j] > max_dist2) {
+                        max_dist2 = dist2[j];
+                        next = j;
+                    }
+                }
+            }
+            for (size_t j = 0; j < group.size(); j++) {
+                if (dist2[j] >= 0) {
+                    contact_rigid_active[group[j]] = false;
+                }
+            }
+        }
+    }
+
+    uint num_removed = (uint)Thrust_Count(contact_rigid_active, 0);
+    data_manager->measures.collision.number_of_contacts_reduced = num_removed;
+    if (num_removed > 0) {
+        RemoveInactiveContacts();
+    }
 }
 
 void ChCNarrowphaseDispatch::DispatchRigidFluid() {
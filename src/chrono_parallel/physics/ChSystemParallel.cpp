@@ -6,6 +6,7 @@
 
 #include "chrono_parallel/ChDataManager.h"
 #include "chrono_parallel/physics/ChSystemParallel.h"
+#include "chrono_parallel/collision/ChCollision.h"
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
 #include "chrono_parallel/collision/ChCollisionSystemBulletParallel.h"
 #include "chrono_parallel/collision/ChCollisionModelParallel.h"
@@ -18,6 +19,7 @@
 #include "chrono_fea/ChElementTetra_4.h"
 #endif
 
+#include <algorithm>
 #include <numeric>
 
 using namespace chrono;
@@ -38,6 +40,7 @@ ChSystemParallel::ChSystemParallel(unsigned int max_objects) : ChSystem(1000, 10
     cd_accumulator.resize(10, 0);
     frame_threads = 0;
     frame_bins = 0;
+    frame_reorder = 0;
     old_timer = 0;
     old_timer_cd = 0;
     detect_optimal_threads = false;
@@ -82,6 +85,12 @@ bool ChSystemParallel::Integrate_Y() {
     data_manager->system_timer.Reset();
     data_manager->system_timer.start("step");
 
+    if (data_manager->settings.reorder_interval > 0 &&
+        ++frame_reorder >= (uint)data_manager->settings.reorder_interval) {
+        frame_reorder = 0;
+        ReorderBodies();
+    }
+
     Setup();
 
     data_manager->system_timer.start("update");
@@ -190,6 +199,7 @@ void ChSystemParallel::AddBody(std::shared_ptr<ChBody> newbody) {
     // This is only need because bilaterals need to know what bodies to
     // refer to. Not used by contacts
     newbody->SetId(data_manager->num_rigid_bodies);
+    body_index.push_back(data_manager->num_rigid_bodies);
 
     bodylist.push_back(newbody);
     data_manager->num_rigid_bodies++;
@@ -659,6 +669,250 @@ void ChSystemParallel::RecomputeThreads() {
 #endif
 }
 
+// Spread the lower 10 bits of x so that there are two zero bits between each of them.
+static inline uint SpreadBits(uint x) {
+    x &= 0x000003ff;
+    x = (x | (x << 16)) & 0xff0000ff;
+    x = (x | (x << 8)) & 0x0300f00f;
+    x = (x | (x << 4)) & 0x030c30c3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+// Reorder the entries of a per-item array (stride entries per item): entry k of the result is
+// entry order[k] of the original. Arrays not sized for the items are left unchanged.
+template <typename T>
+static void PermuteArray(custom_vector<T>& data, const custom_vector<uint>& order, uint stride = 1) {
+    if (data.size() != order.size() * stride) {
+        return;
+    }
+    custom_vector<T> tmp(data.size());
+#pragma omp parallel for
+    for (int k = 0; k < (signed)order.size(); k++) {
+        for (uint j = 0; j < stride; j++) {
+            tmp[k * stride + j] = data[order[k] * stride + j];
+        }
+    }
+    data.swap(tmp);
+}
+
+// Bodies are sorted by the Morton code of their position, on a 1024^3 grid over their bounding box,
+// and their shapes are regrouped by body in the new order. Everything that refers to body or shape
+// indices and is kept between steps is remapped: the contacts of the last step (for reporting), the
+// DEM shear history, the DVI warm start data and the sweep and prune state.
+// Data refreshed at each step from the Chrono bodies (states, forces) is not reordered.
+void ChSystemParallel::ReorderBodies() {
+    host_container& host = data_manager->host_data;
+    shape_container& shapes = data_manager->shape_data;
+    uint num_bodies = data_manager->num_rigid_bodies;
+    if (num_bodies < 2) {
+        return;
+    }
+
+    // Morton code of each body
+    real3 pmin(C_LARGE_REAL), pmax(-C_LARGE_REAL);
+    for (uint i = 0; i < num_bodies; i++) {
+        const ChVector<>& pos = bodylist[i]->GetPos();
+        real3 p(pos.x(), pos.y(), pos.z());
+        pmin = Min(pmin, p);
+        pmax = Max(pmax, p);
+    }
+    real3 extent = pmax - pmin;
+    real3 scale(extent.x > 0 ? 1023 / extent.x : 0, extent.y > 0 ? 1023 / extent.y : 0,
+                extent.z > 0 ? 1023 / extent.z : 0);
+    custom_vector<uint> code(num_bodies);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        const ChVector<>& pos = bodylist[i]->GetPos();
+        uint x = (uint)((pos.x() - pmin.x) * scale.x);
+        uint y = (uint)((pos.y() - pmin.y) * scale.y);
+        uint z = (uint)((pos.z() - pmin.z) * scale.z);
+        code[i] = SpreadBits(x) | (SpreadBits(y) << 1) | (SpreadBits(z) << 2);
+    }
+
+    // New body order (body k was body order[k]) and new index of each body
+    custom_vector<uint> order(num_bodies);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&code](uint a, uint b) { return code[a] < code[b]; });
+    custom_vector<uint> new_index(num_bodies);
+    bool identity = true;
+    for (uint k = 0; k < num_bodies; k++) {
+        new_index[order[k]] = k;
+        identity &= (order[k] == k);
+    }
+    if (identity) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<ChBody>> bodies(num_bodies);
+    for (uint k = 0; k < num_bodies; k++) {
+        bodies[k] = bodylist[order[k]];
+        bodies[k]->SetId(k);
+    }
+    bodylist.swap(bodies);
+    for (auto& index : body_index) {
+        index = new_index[index];
+    }
+
+    PermuteArray(host.pos_rigid, order);
+    PermuteArray(host.rot_rigid, order);
+    PermuteArray(host.active_rigid, order);
+    PermuteArray(host.collide_rigid, order);
+    PermuteArray(host.mass_rigid, order);
+    PermuteArray(host.fric_data, order);
+    PermuteArray(host.cohesion_data, order);
+    PermuteArray(host.compliance_data, order);
+    PermuteArray(host.elastic_moduli, order);
+    PermuteArray(host.mu, order);
+    PermuteArray(host.cr, order);
+    PermuteArray(host.dem_coeffs, order);
+    PermuteArray(host.adhesionMultDMT_data, order);
+    PermuteArray(host.ct_body_map, order);
+
+    // Shapes are regrouped by body, keeping their order within a body
+    uint num_shapes = data_manager->num_rigid_shapes;
+    custom_vector<uint> shape_order(num_shapes);
+    custom_vector<uint> new_shape(num_shapes);
+    std::iota(shape_order.begin(), shape_order.end(), 0);
+    std::stable_sort(shape_order.begin(), shape_order.end(), [&](uint a, uint b) {
+        return new_index[shapes.id_rigid[a]] < new_index[shapes.id_rigid[b]];
+    });
+    for (uint k = 0; k < num_shapes; k++) {
+        new_shape[shape_order[k]] = k;
+    }
+
+    PermuteArray(shapes.fam_rigid, shape_order);
+    PermuteArray(shapes.id_rigid, shape_order);
+    PermuteArray(shapes.typ_rigid, shape_order);
+    PermuteArray(shapes.start_rigid, shape_order);
+    PermuteArray(shapes.length_rigid, shape_order);
+    PermuteArray(shapes.ObR_rigid, shape_order);
+    PermuteArray(shapes.ObA_rigid, shape_order);
+    for (uint k = 0; k < num_shapes; k++) {
+        shapes.id_rigid[k] = new_index[shapes.id_rigid[k]];
+    }
+
+    // Shape data stored by type follows the new shape order (convex hulls are left in place)
+    custom_vector<real> sphere;
+    custom_vector<real3> box_like;
+    custom_vector<real3> triangle;
+    custom_vector<real2> capsule;
+    custom_vector<real4> rbox_like;
+    sphere.reserve(shapes.sphere_rigid.size());
+    box_like.reserve(shapes.box_like_rigid.size());
+    triangle.reserve(shapes.triangle_rigid.size());
+    capsule.reserve(shapes.capsule_rigid.size());
+    rbox_like.reserve(shapes.rbox_like_rigid.size());
+    for (uint k = 0; k < num_shapes; k++) {
+        int start = shapes.start_rigid[k];
+        switch (shapes.typ_rigid[k]) {
+            case chrono::collision::SPHERE:
+                shapes.start_rigid[k] = (int)sphere.size();
+                sphere.push_back(shapes.sphere_rigid[start]);
+                break;
+            case chrono::collision::ELLIPSOID:
+            case chrono::collision::BOX:
+            case chrono::collision::CYLINDER:
+            case chrono::collision::CONE:
+                shapes.start_rigid[k] = (int)box_like.size();
+                box_like.push_back(shapes.box_like_rigid[start]);
+                break;
+            case chrono::collision::CAPSULE:
+                shapes.start_rigid[k] = (int)capsule.size();
+                capsule.push_back(shapes.capsule_rigid[start]);
+                break;
+            case chrono::collision::ROUNDEDBOX:
+            case chrono::collision::ROUNDEDCYL:
+            case chrono::collision::ROUNDEDCONE:
+                shapes.start_rigid[k] = (int)rbox_like.size();
+                rbox_like.push_back(shapes.rbox_like_rigid[start]);
+                break;
+            case chrono::collision::TRIANGLEMESH:
+                shapes.start_rigid[k] = (int)triangle.size();
+                triangle.insert(triangle.end(), shapes.triangle_rigid.begin() + start,
+                                shapes.triangle_rigid.begin() + start + 3);
+                break;
+        }
+    }
+    shapes.sphere_rigid.swap(sphere);
+    shapes.box_like_rigid.swap(box_like);
+    shapes.triangle_rigid.swap(triangle);
+    shapes.capsule_rigid.swap(capsule);
+    shapes.rbox_like_rigid.swap(rbox_like);
+
+    // Contacts of the last step (shapes are kept in the order of the contact normals)
+    for (size_t i = 0; i < host.bids_rigid_rigid.size(); i++) {
+        host.bids_rigid_rigid[i] = vec2(new_index[host.bids_rigid_rigid[i].x], new_index[host.bids_rigid_rigid[i].y]);
+    }
+    for (size_t i = 0; i < host.contact_pairs.size(); i++) {
+        uint a = new_shape[int(host.contact_pairs[i] >> 32)];
+        uint b = new_shape[int(host.contact_pairs[i] & 0xffffffff)];
+        host.contact_pairs[i] = ((long long)a << 32) | (long long)b;
+    }
+
+    // Shear history: the entries of a pair of bodies are kept with the body of larger index
+    // (see the DEM contact force kernel)
+    if (host.shear_neigh.size() == max_shear * num_bodies) {
+        custom_vector<vec3> shear_neigh(host.shear_neigh.size(), vec3(-1, -1, -1));
+        custom_vector<real3> shear_disp(host.shear_disp.size(), real3(0));
+        custom_vector<int> count(num_bodies, 0);
+        for (uint i = 0; i < num_bodies; i++) {
+            for (int j = 0; j < max_shear; j++) {
+                const vec3& neigh = host.shear_neigh[max_shear * i + j];
+                if (neigh.x == -1) {
+                    continue;
+                }
+                int body1 = std::max(new_index[i], new_index[neigh.x]);
+                int body2 = std::min(new_index[i], new_index[neigh.x]);
+                int shape1 = std::max(new_shape[neigh.y], new_shape[neigh.z]);
+                int shape2 = std::min(new_shape[neigh.y], new_shape[neigh.z]);
+                if (count[body1] == max_shear) {
+                    continue;
+                }
+                int index = max_shear * body1 + count[body1]++;
+                shear_neigh[index] = vec3(body2, shape1, shape2);
+                shear_disp[index] = host.shear_disp[max_shear * i + j];
+            }
+        }
+        host.shear_neigh.swap(shear_neigh);
+        host.shear_disp.swap(shear_disp);
+    }
+
+    // Warm start data: the multipliers of a pair are kept only if the order of its shapes is the same,
+    // since the sign of the tangential multipliers depends on it
+    custom_vector<long long>& pairs_prev = host.contact_pairs_prev;
+    custom_vector<real>& gamma_prev = host.gamma_rigid_prev;
+    if (pairs_prev.size() > 0) {
+        custom_vector<long long> pairs;
+        custom_vector<real> gamma;
+        pairs.reserve(pairs_prev.size());
+        gamma.reserve(gamma_prev.size());
+        for (size_t i = 0; i < pairs_prev.size(); i++) {
+            uint a = new_shape[int(pairs_prev[i] >> 32)];
+            uint b = new_shape[int(pairs_prev[i] & 0xffffffff)];
+            if (a > b) {
+                continue;
+            }
+            pairs.push_back(((long long)a << 32) | (long long)b);
+            gamma.insert(gamma.end(), gamma_prev.begin() + 6 * i, gamma_prev.begin() + 6 * i + 6);
+        }
+        custom_vector<uint> pair_order(pairs.size());
+        std::iota(pair_order.begin(), pair_order.end(), 0);
+        std::stable_sort(pair_order.begin(), pair_order.end(),
+                         [&pairs](uint a, uint b) { return pairs[a] < pairs[b]; });
+        PermuteArray(pairs, pair_order);
+        PermuteArray(gamma, pair_order, 6);
+        pairs_prev.swap(pairs);
+        gamma_prev.swap(gamma);
+    }
+
+    if (data_manager->broadphase) {
+        data_manager->broadphase->Reset();
+    }
+
+    LOG(TRACE) << "ChSystemParallel::ReorderBodies() bodies: " << num_bodies << " shapes: " << num_shapes;
+}
+
 void ChSystemParallel::ChangeCollisionSystem(CollisionSystemType type) {
     assert(GetNbodies() == 0);
 
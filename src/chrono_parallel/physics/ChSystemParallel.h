@@ -69,6 +69,14 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     void Update3DOFBodies();
     void RecomputeThreads();
 
+    /// Sort the bodies, and their collision shapes, along a Z-order (Morton) curve of the body
+    /// positions, so that bodies close in space are also close in memory. The body indices
+    /// (ChBody::GetId) change; use GetBodyIndex to find a body from the order it was added in.
+    /// Called every settings.reorder_interval steps, if not zero.
+    void ReorderBodies();
+    /// Get the current index of the body that was added to the system in the given position.
+    int GetBodyIndex(int insertion_index) const { return body_index[insertion_index]; }
+
     virtual void AddMaterialSurfaceData(std::shared_ptr<ChBody> newbody) = 0;
     virtual void UpdateMaterialSurfaceData(int index, ChBody* body) = 0;
     virtual void Setup() override;
@@ -127,6 +135,8 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     int detect_optimal_bins;
     std::vector<double> timer_accumulator, cd_accumulator;
     uint frame_threads, frame_bins, counter;
+    uint frame_reorder;
+    std::vector<int> body_index;  ///< current index of the bodies, in insertion order
     std::vector<ChLink*>::iterator it;
 
     CollisionSystemType collision_system_type;
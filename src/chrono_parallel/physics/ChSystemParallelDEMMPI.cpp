@@ -0,0 +1,558 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: distributed-memory (MPI) variant of the parallel DEM system.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_set>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_parallel/physics/ChSystemParallelDEMMPI.h"
+#include "chrono_parallel/collision/ChCollisionModelParallel.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Layout of a body record (all values stored as doubles):
+//   identifier, mass, inertia XX (3), inertia XY (3), position (3), rotation (4), velocity (3),
+//   angular velocity in the body frame (3), family group, family mask, material (11), number of shapes,
+//   then for each shape: type, A (3), B (3), C (3), R (4)
+static const int REC_ID = 0;
+static const int REC_FAMILY = 21;
+static const int REC_MATERIAL = 23;
+static const int REC_NUM_SHAPES = 34;
+static const int REC_HEADER_SIZE = 35;
+static const int REC_SHAPE_SIZE = 14;
+
+static const int TAG_MIGRATE = 100;
+static const int TAG_GHOST = 200;
+
+// Only shapes fully described by their ConvexModel data can be sent to other ranks.
+static bool IsPrimitiveShape(const ConvexModel& shape) {
+    switch (shape.type) {
+        case SPHERE:
+        case ELLIPSOID:
+        case BOX:
+        case CYLINDER:
+        case CAPSULE:
+        case CONE:
+        case ROUNDEDBOX:
+        case ROUNDEDCYL:
+        case ROUNDEDCONE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Conservative bound of the distance from the center of a body to the points of a shape.
+static double BoundingRadius(const ConvexModel& shape) {
+    return Length(shape.A) + shape.B.x + shape.B.y + shape.B.z + shape.C.x;
+}
+
+// Records of the collision shapes of a body.
+static std::vector<double> ShapeRecords(ChBody* body) {
+    ChCollisionModelParallel* model = static_cast<ChCollisionModelParallel*>(body->GetCollisionModel().get());
+    std::vector<double> records;
+    records.reserve(model->mData.size() * REC_SHAPE_SIZE);
+    for (auto& shape : model->mData) {
+        double values[REC_SHAPE_SIZE] = {(double)shape.type,
+                                         shape.A.x, shape.A.y, shape.A.z,
+                                         shape.B.x, shape.B.y, shape.B.z,
+                                         shape.C.x, shape.C.y, shape.C.z,
+                                         shape.R.w, shape.R.x, shape.R.y, shape.R.z};
+        records.insert(records.end(), values, values + REC_SHAPE_SIZE);
+    }
+    return records;
+}
+
+// Collision shape from its record.
+static ConvexModel UnpackShape(const double* s) {
+    return ConvexModel((shape_type)(int)s[0], real3(s[1], s[2], s[3]), real3(s[4], s[5], s[6]),
+                       real3(s[7], s[8], s[9]), quaternion(s[10], s[11], s[12], s[13]), 0);
+}
+
+// Types of the collision shapes of a body (used to reuse parked bodies).
+static std::vector<int> ShapeTypes(ChBody* body) {
+    ChCollisionModelParallel* model = static_cast<ChCollisionModelParallel*>(body->GetCollisionModel().get());
+    std::vector<int> types;
+    types.reserve(model->mData.size());
+    for (auto& shape : model->mData)
+        types.push_back((int)shape.type);
+    return types;
+}
+
+ChSystemParallelDEMMPI::ChSystemParallelDEMMPI(MPI_Comm communicator, unsigned int max_objects)
+    : ChSystemParallelDEM(max_objects),
+      comm(communicator),
+      split_axis(0),
+      domain_lo(0),
+      slab_width(1),
+      ghost_width(-1),
+      ghost_layer(0),
+      max_radius(0),
+      global_groups(0) {
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_ranks);
+}
+
+void ChSystemParallelDEMMPI::SetDomain(double lo, double hi, int axis) {
+    assert(hi > lo && axis >= 0 && axis < 3);
+    split_axis = axis;
+    domain_lo = lo;
+    slab_width = (hi - lo) / num_ranks;
+}
+
+int ChSystemParallelDEMMPI::GetOwnerRank(const ChVector<>& pos) const {
+    double slab = std::floor((pos[split_axis] - domain_lo) / slab_width);
+    if (!(slab >= 0))
+        return 0;
+    if (slab >= num_ranks - 1)
+        return num_ranks - 1;
+    return (int)slab;
+}
+
+void ChSystemParallelDEMMPI::AddBody(std::shared_ptr<ChBody> newbody) {
+    // Checked on all ranks, whatever the owner, so that all ranks fail in the same way
+    ChCollisionModelParallel* model = static_cast<ChCollisionModelParallel*>(newbody->GetCollisionModel().get());
+    for (auto& shape : model->mData) {
+        if (!IsPrimitiveShape(shape)) {
+            throw ChException("ChSystemParallelDEMMPI::AddBody: body " + std::to_string(newbody->GetIdentifier()) +
+                              " has collision shapes that cannot be distributed; use AddBodyGlobal");
+        }
+        max_radius = std::max(max_radius, (double)BoundingRadius(shape));
+    }
+
+    if (GetOwnerRank(newbody->GetPos()) != rank)
+        return;
+
+    AddDistributedBody(newbody);
+    owned[newbody->GetIdentifier()] = newbody;
+}
+
+void ChSystemParallelDEMMPI::AddDistributedBody(std::shared_ptr<ChBody> body) {
+    // The collision shapes of a body are appended to the shape data when it is added
+    int start = (int)data_manager->shape_data.id_rigid.size();
+    ChSystemParallelDEM::AddBody(body);
+    if ((int)data_manager->shape_data.id_rigid.size() > start)
+        shape_start[body.get()] = start;
+}
+
+void ChSystemParallelDEMMPI::AddBodyGlobal(std::shared_ptr<ChBody> newbody) {
+    ChSystemParallelDEM::AddBody(newbody);
+    if (newbody->GetBodyFixed())
+        return;
+
+    // Ghost bodies must not collide with the movable global bodies: these contacts are computed by the owners
+    global_movable.push_back(newbody);
+    global_groups |= newbody->GetCollisionModel()->GetFamilyGroup();
+    for (auto& ghost : ghosts) {
+        auto model = ghost.second->GetCollisionModel();
+        SetFamily(ghost.second.get(), model->GetFamilyGroup(), model->GetFamilyMask() & ~global_groups);
+    }
+}
+
+int ChSystemParallelDEMMPI::GetNumOwnedBodiesGlobal() const {
+    int num_local = (int)owned.size();
+    int num_global = 0;
+    MPI_Allreduce(&num_local, &num_global, 1, MPI_INT, MPI_SUM, comm);
+    return num_global;
+}
+
+std::shared_ptr<ChBody> ChSystemParallelDEMMPI::GetOwnedBody(int identifier) const {
+    auto it = owned.find(identifier);
+    return it == owned.end() ? std::shared_ptr<ChBody>() : it->second;
+}
+
+int ChSystemParallelDEMMPI::GetNumParkedBodies() const {
+    int num_parked = 0;
+    for (auto& entry : parked)
+        num_parked += (int)entry.second.size();
+    return num_parked;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChSystemParallelDEMMPI::Integrate_Y() {
+    exchange_timer.reset();
+
+    exchange_timer.start();
+    ghost_layer = ghost_width;
+    if (ghost_layer < 0) {
+        double radius = max_radius;
+        MPI_Allreduce(&max_radius, &radius, 1, MPI_DOUBLE, MPI_MAX, comm);
+        ghost_layer = 2 * (radius + data_manager->settings.collision.collision_envelope);
+    }
+    ExchangeBodies();
+    exchange_timer.stop();
+
+    bool result = ChSystemParallelDEM::Integrate_Y();
+
+    exchange_timer.start();
+    ReduceGlobalBodies();
+    exchange_timer.stop();
+
+    return result;
+}
+
+void ChSystemParallelDEMMPI::ExchangeBodies() {
+    std::vector<double> send[2];
+    std::vector<double> recv[2];
+
+    // 1. Migration: the owned bodies which left the slab are sent to their new owner. They stay on this rank as
+    //    ghosts until the next phase tells whether they are still needed.
+    std::vector<int> migrated;
+    for (auto& entry : owned) {
+        int owner = GetOwnerRank(entry.second->GetPos());
+        if (owner == rank)
+            continue;
+        PackBody(entry.second.get(), send[owner < rank ? 0 : 1]);
+        migrated.push_back(entry.first);
+    }
+    for (int id : migrated) {
+        auto body = owned[id];
+        owned.erase(id);
+        ghosts[id] = body;
+        auto model = body->GetCollisionModel();
+        SetFamily(body.get(), model->GetFamilyGroup(), model->GetFamilyMask() & ~global_groups);
+    }
+
+    SendReceive(send, recv, TAG_MIGRATE);
+
+    for (int side = 0; side < 2; side++) {
+        for (size_t pos = 0; pos < recv[side].size(); pos += RecordSize(&recv[side][pos])) {
+            const double* record = &recv[side][pos];
+            int id = (int)record[REC_ID];
+            auto it = ghosts.find(id);
+            std::shared_ptr<ChBody> body;
+            if (it != ghosts.end()) {
+                body = it->second;
+                ghosts.erase(it);
+                UnpackState(record, body.get());
+            } else {
+                body = UnpackBody(record);
+            }
+            SetFamily(body.get(), (short)record[REC_FAMILY], (short)record[REC_FAMILY + 1]);
+            owned[id] = body;
+        }
+    }
+
+    // 2. Ghosts: the owned bodies close to the boundary of a neighbor slab are sent to that neighbor. The ghosts
+    //    which are not refreshed are parked.
+    send[0].clear();
+    send[1].clear();
+    double slab_lo = domain_lo + rank * slab_width;
+    double slab_hi = slab_lo + slab_width;
+    for (auto& entry : owned) {
+        double x = entry.second->GetPos()[split_axis];
+        if (rank > 0 && x < slab_lo + ghost_layer)
+            PackBody(entry.second.get(), send[0]);
+        if (rank < num_ranks - 1 && x > slab_hi - ghost_layer)
+            PackBody(entry.second.get(), send[1]);
+    }
+
+    SendReceive(send, recv, TAG_GHOST);
+
+    std::unordered_set<int> refreshed;
+    for (int side = 0; side < 2; side++) {
+        for (size_t pos = 0; pos < recv[side].size(); pos += RecordSize(&recv[side][pos])) {
+            const double* record = &recv[side][pos];
+            int id = (int)record[REC_ID];
+            auto it = ghosts.find(id);
+            if (it != ghosts.end()) {
+                UnpackState(record, it->second.get());
+            } else {
+                auto body = UnpackBody(record);
+                SetFamily(body.get(), (short)record[REC_FAMILY], (short)record[REC_FAMILY + 1] & ~global_groups);
+                ghosts[id] = body;
+            }
+            refreshed.insert(id);
+        }
+    }
+
+    std::vector<int> stale;
+    for (auto& entry : ghosts) {
+        if (refreshed.count(entry.first) == 0)
+            stale.push_back(entry.first);
+    }
+    for (int id : stale) {
+        ParkBody(ghosts[id]);
+        ghosts.erase(id);
+    }
+
+    ApplyFamilies();
+}
+
+void ChSystemParallelDEMMPI::SendReceive(std::vector<double> send[2], std::vector<double> recv[2], int tag) {
+    int neighbor[2] = {rank > 0 ? rank - 1 : MPI_PROC_NULL, rank < num_ranks - 1 ? rank + 1 : MPI_PROC_NULL};
+
+    // Send to one side while receiving from the other one
+    for (int side = 0; side < 2; side++) {
+        int send_size = (int)send[side].size();
+        int recv_size = 0;
+        MPI_Sendrecv(&send_size, 1, MPI_INT, neighbor[side], tag, &recv_size, 1, MPI_INT, neighbor[1 - side], tag,
+                     comm, MPI_STATUS_IGNORE);
+        recv[1 - side].resize(recv_size);
+        MPI_Sendrecv(send[side].data(), send_size, MPI_DOUBLE, neighbor[side], tag + 1, recv[1 - side].data(),
+                     recv_size, MPI_DOUBLE, neighbor[1 - side], tag + 1, comm, MPI_STATUS_IGNORE);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+int ChSystemParallelDEMMPI::RecordSize(const double* record) {
+    return REC_HEADER_SIZE + (int)record[REC_NUM_SHAPES] * REC_SHAPE_SIZE;
+}
+
+void ChSystemParallelDEMMPI::PackBody(ChBody* body, std::vector<double>& buffer) const {
+    ChVector<> inertia_xx = body->GetInertiaXX();
+    ChVector<> inertia_xy = body->GetInertiaXY();
+    const ChVector<>& pos = body->GetPos();
+    const ChQuaternion<>& rot = body->GetRot();
+    const ChVector<>& vel = body->GetPos_dt();
+    ChVector<> wvel = body->GetWvel_loc();
+    auto model = body->GetCollisionModel();
+    auto mat = body->GetMaterialSurfaceDEM();
+
+    double header[REC_HEADER_SIZE] = {(double)body->GetIdentifier(),
+                                      body->GetMass(),
+                                      inertia_xx.x(), inertia_xx.y(), inertia_xx.z(),
+                                      inertia_xy.x(), inertia_xy.y(), inertia_xy.z(),
+                                      pos.x(), pos.y(), pos.z(),
+                                      rot.e0(), rot.e1(), rot.e2(), rot.e3(),
+                                      vel.x(), vel.y(), vel.z(),
+                                      wvel.x(), wvel.y(), wvel.z(),
+                                      (double)model->GetFamilyGroup(), (double)model->GetFamilyMask(),
+                                      mat->GetYoungModulus(), mat->GetPoissonRatio(),
+                                      mat->GetSfriction(), mat->GetKfriction(), mat->GetRestitution(),
+                                      mat->GetAdhesion(), mat->GetAdhesionMultDMT(),
+                                      mat->GetKn(), mat->GetKt(), mat->GetGn(), mat->GetGt(),
+                                      0};
+    std::vector<double> shapes = ShapeRecords(body);
+    header[REC_NUM_SHAPES] = (double)(shapes.size() / REC_SHAPE_SIZE);
+
+    buffer.insert(buffer.end(), header, header + REC_HEADER_SIZE);
+    buffer.insert(buffer.end(), shapes.begin(), shapes.end());
+}
+
+void ChSystemParallelDEMMPI::UnpackState(const double* record, ChBody* body) const {
+    body->SetMass(record[1]);
+    body->SetInertiaXX(ChVector<>(record[2], record[3], record[4]));
+    body->SetInertiaXY(ChVector<>(record[5], record[6], record[7]));
+    body->SetPos(ChVector<>(record[8], record[9], record[10]));
+    body->SetRot(ChQuaternion<>(record[11], record[12], record[13], record[14]));
+    body->SetPos_dt(ChVector<>(record[15], record[16], record[17]));
+    body->SetWvel_loc(ChVector<>(record[18], record[19], record[20]));
+
+    const double* m = record + REC_MATERIAL;
+    auto mat = body->GetMaterialSurfaceDEM();
+    mat->SetYoungModulus((float)m[0]);
+    mat->SetPoissonRatio((float)m[1]);
+    mat->SetSfriction((float)m[2]);
+    mat->SetKfriction((float)m[3]);
+    mat->SetRestitution((float)m[4]);
+    mat->SetAdhesion((float)m[5]);
+    mat->SetAdhesionMultDMT((float)m[6]);
+    mat->SetKn((float)m[7]);
+    mat->SetKt((float)m[8]);
+    mat->SetGn((float)m[9]);
+    mat->SetGt((float)m[10]);
+}
+
+std::shared_ptr<ChBody> ChSystemParallelDEMMPI::UnpackBody(const double* record) {
+    const double* shapes = record + REC_HEADER_SIZE;
+    int num_shapes = (int)record[REC_NUM_SHAPES];
+
+    // Reuse a parked body with the same types of shapes, if any
+    std::vector<int> types(num_shapes);
+    for (int i = 0; i < num_shapes; i++)
+        types[i] = (int)shapes[i * REC_SHAPE_SIZE];
+
+    std::shared_ptr<ChBody> body;
+    auto it = parked.find(types);
+    if (it != parked.end() && !it->second.empty()) {
+        body = it->second.back();
+        it->second.pop_back();
+        if (it->second.empty())
+            parked.erase(it);
+        body->SetIdentifier((int)record[REC_ID]);
+        body->SetBodyFixed(false);
+        UnpackState(record, body.get());
+        UnpackShapes(record, body.get());
+
+        // The tangential displacement history refers to the previous body in this slot
+        if (data_manager->settings.solver.tangential_displ_mode ==
+            ChSystemDEM::TangentialDisplacementModel::MultiStep) {
+            for (int i = 0; i < max_shear; i++)
+                data_manager->host_data.shear_neigh[max_shear * body->GetId() + i].x = -1;
+        }
+        return body;
+    }
+
+    body = std::shared_ptr<ChBody>(NewBody());
+    body->SetIdentifier((int)record[REC_ID]);
+    body->SetMaterialSurface(std::make_shared<ChMaterialSurfaceDEM>());
+    UnpackState(record, body.get());
+    body->SetCollide(true);
+
+    ChCollisionModelParallel* model = static_cast<ChCollisionModelParallel*>(body->GetCollisionModel().get());
+    model->ClearModel();
+    for (int i = 0; i < num_shapes; i++)
+        model->AddShape(UnpackShape(shapes + i * REC_SHAPE_SIZE));
+    model->SetFamilyGroup((short)record[REC_FAMILY]);
+    model->SetFamilyMask((short)record[REC_FAMILY + 1]);
+    model->BuildModel();
+
+    AddDistributedBody(body);
+    return body;
+}
+
+// The dimensions of the shapes are copied into the shape data when the collision model is added to the system, so
+// they are overwritten there as well. The shapes of a body are contiguous in the shape data.
+void ChSystemParallelDEMMPI::UnpackShapes(const double* record, ChBody* body) {
+    const double* shapes = record + REC_HEADER_SIZE;
+    ChCollisionModelParallel* model = static_cast<ChCollisionModelParallel*>(body->GetCollisionModel().get());
+    shape_container& shape_data = data_manager->shape_data;
+    int first = shape_start[body];
+
+    for (int i = 0; i < (int)record[REC_NUM_SHAPES]; i++) {
+        ConvexModel& shape = model->mData[i];
+        shape = UnpackShape(shapes + i * REC_SHAPE_SIZE);
+
+        int index = first + i;
+        int start = shape_data.start_rigid[index];
+        shape_data.ObA_rigid[index] = shape.A;
+        shape_data.ObR_rigid[index] = shape.R;
+        switch (shape.type) {
+            case SPHERE:
+                shape_data.sphere_rigid[start] = shape.B.x;
+                break;
+            case ELLIPSOID:
+            case BOX:
+            case CYLINDER:
+            case CONE:
+                shape_data.box_like_rigid[start] = shape.B;
+                break;
+            case CAPSULE:
+                shape_data.capsule_rigid[start] = real2(shape.B.x, shape.B.y);
+                break;
+            case ROUNDEDBOX:
+            case ROUNDEDCYL:
+            case ROUNDEDCONE:
+                shape_data.rbox_like_rigid[start] = real4(shape.B, shape.C.x);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void ChSystemParallelDEMMPI::ParkBody(std::shared_ptr<ChBody> body) {
+    body->SetBodyFixed(true);
+    body->SetPos_dt(ChVector<>(0, 0, 0));
+    body->SetWvel_loc(ChVector<>(0, 0, 0));
+    SetFamily(body.get(), body->GetCollisionModel()->GetFamilyGroup(), 0);
+
+    // Bodies without shapes in the collision system cannot be reused for incoming ones
+    if (shape_start.count(body.get()))
+        parked[ShapeTypes(body.get())].push_back(body);
+}
+
+// The collision families are copied into the shape data when the collision model is added to the system, so they
+// must be updated there as well.
+void ChSystemParallelDEMMPI::SetFamily(ChBody* body, short group, short mask) {
+    body->GetCollisionModel()->SetFamilyGroup(group);
+    body->GetCollisionModel()->SetFamilyMask(mask);
+    family_changes[body] = S2(group, mask);
+}
+
+void ChSystemParallelDEMMPI::ApplyFamilies() {
+    if (family_changes.empty())
+        return;
+
+    std::vector<short2> body_family(data_manager->num_rigid_bodies, S2(0, -1));
+    for (auto& change : family_changes)
+        body_family[change.first->GetId()] = change.second;
+
+    custom_vector<short2>& fam_rigid = data_manager->shape_data.fam_rigid;
+    const custom_vector<uint>& id_rigid = data_manager->shape_data.id_rigid;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)fam_rigid.size(); i++) {
+        const short2& family = body_family[id_rigid[i]];
+        if (family.y != -1)
+            fam_rigid[i] = family;
+    }
+
+    family_changes.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+// On each rank, the contact forces on a movable global body only come from the bodies owned by that rank. Each rank
+// integrated the body with its own contact force; the velocity and position are corrected with the contact force
+// summed over all ranks, then the state of rank 0 is broadcast so that all copies stay identical.
+void ChSystemParallelDEMMPI::ReduceGlobalBodies() {
+    int num_global = (int)global_movable.size();
+    if (num_global == 0)
+        return;
+
+    std::vector<double> local(6 * num_global);
+    std::vector<double> total(6 * num_global);
+    for (int i = 0; i < num_global; i++) {
+        real3 force = GetBodyContactForce(global_movable[i]->GetId());
+        real3 torque = GetBodyContactTorque(global_movable[i]->GetId());
+        double values[6] = {force.x, force.y, force.z, torque.x, torque.y, torque.z};
+        std::copy(values, values + 6, local.begin() + 6 * i);
+    }
+    MPI_Allreduce(local.data(), total.data(), 6 * num_global, MPI_DOUBLE, MPI_SUM, comm);
+
+    double step = GetStep();
+    std::vector<double> state(13 * num_global);
+    for (int i = 0; i < num_global; i++) {
+        ChBody* body = global_movable[i].get();
+        ChVector<> dforce(total[6 * i + 0] - local[6 * i + 0], total[6 * i + 1] - local[6 * i + 1],
+                          total[6 * i + 2] - local[6 * i + 2]);
+        ChVector<> dtorque(total[6 * i + 3] - local[6 * i + 3], total[6 * i + 4] - local[6 * i + 4],
+                           total[6 * i + 5] - local[6 * i + 5]);
+
+        // Contact torques are expressed in the body frame
+        ChVector<> dvel = dforce * (step / body->GetMass());
+        ChVector<> dwvel = body->VariablesBody().GetBodyInvInertia() * dtorque * step;
+        ChQuaternion<> drot;
+        drot.Q_from_Rotv(dwvel * step);
+
+        ChVector<> pos = body->GetPos() + dvel * step;
+        ChQuaternion<> rot = body->GetRot() * drot;
+        ChVector<> vel = body->GetPos_dt() + dvel;
+        ChVector<> wvel = body->GetWvel_loc() + dwvel;
+        double values[13] = {pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(), rot.e2(), rot.e3(),
+                             vel.x(), vel.y(), vel.z(), wvel.x(), wvel.y(), wvel.z()};
+        std::copy(values, values + 13, state.begin() + 13 * i);
+    }
+    MPI_Bcast(state.data(), 13 * num_global, MPI_DOUBLE, 0, comm);
+
+    for (int i = 0; i < num_global; i++) {
+        ChBody* body = global_movable[i].get();
+        const double* s = &state[13 * i];
+        body->SetPos(ChVector<>(s[0], s[1], s[2]));
+        body->SetRot(ChQuaternion<>(s[3], s[4], s[5], s[6]));
+        body->SetPos_dt(ChVector<>(s[7], s[8], s[9]));
+        body->SetWvel_loc(ChVector<>(s[10], s[11], s[12]));
+        body->Update(ChTime);
+    }
+}
@@ -0,0 +1,160 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: distributed-memory (MPI) variant of the parallel DEM system.
+// Available only if Chrono::Parallel is configured with USE_PARALLEL_MPI.
+// =============================================================================
+
+#pragma once
+
+#include <mpi.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+namespace chrono {
+
+/// @addtogroup parallel_module
+/// @{
+
+/// Distributed-memory variant of ChSystemParallelDEM, with one subdomain per MPI rank.
+///
+/// The space is split along one axis in slabs of equal width, one per rank (the first and last slabs extend to
+/// infinity). Each rank owns the bodies whose center is in its slab and integrates them. At every step, before the
+/// collision detection:
+/// - the bodies that left the slab migrate to the neighbor rank that now owns them;
+/// - the bodies closer than the ghost layer width to the boundary of a neighbor slab are sent to that neighbor, where
+///   they appear as ghost bodies, so that the contact forces on the owned bodies are complete.
+/// The state of the ghost bodies is overwritten at each exchange. Bodies that leave a rank are not removed from the
+/// system (this is not supported by Chrono::Parallel), but parked (fixed, with no collisions) and their slots reused
+/// for incoming bodies with the same types of collision shapes, whose dimensions are overwritten. The number of
+/// bodies on a rank is thus bounded by the largest number of owned and ghost bodies it held at once.
+///
+/// Bodies replicated on all ranks (containers, large objects) are added with AddBodyGlobal. If they are not fixed,
+/// each rank only computes their contacts with its owned bodies, and the contact forces are summed over all ranks
+/// so that all copies follow the same motion.
+///
+/// Restrictions: the distributed bodies must have a unique identifier across ranks, a DEM material and collision
+/// models made of primitive shapes (no convex hulls or meshes); the tangential displacement history (MultiStep) is
+/// not migrated; only contacts are supported (no links on distributed bodies).
+class CH_PARALLEL_API ChSystemParallelDEMMPI : public ChSystemParallelDEM {
+  public:
+    ChSystemParallelDEMMPI(MPI_Comm communicator, unsigned int max_objects = 1000);
+    ~ChSystemParallelDEMMPI() {}
+
+    /// Set the decomposition: the interval [lo, hi] along the given axis (0, 1 or 2) is split in one slab per rank.
+    /// Must be called before adding bodies.
+    void SetDomain(double lo, double hi, int axis = 0);
+
+    /// Set the width of the ghost layer: it must be larger than the largest distance from the center of a body to
+    /// the point of another body it can touch (e.g. twice the largest radius, for spheres).
+    /// By default (or if the width is negative), it is twice the sum of the largest bounding radius of the
+    /// distributed bodies and of the collision envelope, reduced over all ranks at each step.
+    void SetGhostLayer(double width) { ghost_width = width; }
+
+    /// Return the width of the ghost layer used in the last exchange.
+    double GetGhostLayer() const { return ghost_layer; }
+
+    /// Add a body to the system. The body is added only if its center is in the slab of this rank, and ignored
+    /// otherwise, so that all ranks may add all the bodies. Throws a ChException if the body has collision shapes
+    /// that cannot be sent to other ranks (e.g. meshes): such bodies must be added with AddBodyGlobal.
+    virtual void AddBody(std::shared_ptr<ChBody> newbody) override;
+
+    /// Add a body replicated on all ranks. Global bodies must be added on all ranks, in the same order.
+    /// A movable global body must have a collision family group of its own, not used by the distributed bodies
+    /// (the ghost bodies do not collide with this family group).
+    void AddBodyGlobal(std::shared_ptr<ChBody> newbody);
+
+    /// Exchange the bodies with the neighbor ranks, then advance the system by one step.
+    virtual bool Integrate_Y() override;
+
+    int GetRank() const { return rank; }
+    int GetNumRanks() const { return num_ranks; }
+
+    /// Return the rank owning the given position.
+    int GetOwnerRank(const ChVector<>& pos) const;
+
+    /// Number of bodies owned by this rank.
+    int GetNumOwnedBodies() const { return (int)owned.size(); }
+    /// Number of ghost bodies on this rank.
+    int GetNumGhostBodies() const { return (int)ghosts.size(); }
+    /// Number of parked bodies on this rank, available for reuse.
+    int GetNumParkedBodies() const;
+    /// Total number of bodies owned by all ranks (collective call).
+    int GetNumOwnedBodiesGlobal() const;
+
+    /// Return the body with the given identifier owned by this rank (empty if not owned by this rank).
+    std::shared_ptr<ChBody> GetOwnedBody(int identifier) const;
+    /// Return the bodies owned by this rank, by identifier.
+    const std::unordered_map<int, std::shared_ptr<ChBody>>& GetOwnedBodies() const { return owned; }
+
+    /// Return the time spent exchanging bodies with the neighbor ranks in the last step.
+    double GetTimerExchange() const { return exchange_timer(); }
+
+  private:
+    // Append the record of a body (state, material, family and shapes) to a buffer.
+    void PackBody(ChBody* body, std::vector<double>& buffer) const;
+    // Set the state and material of a body from its record.
+    void UnpackState(const double* record, ChBody* body) const;
+    // Create a body from its record, or reuse a parked one with the same types of shapes.
+    std::shared_ptr<ChBody> UnpackBody(const double* record);
+    // Overwrite the collision shapes of a reused body with the ones of a record.
+    void UnpackShapes(const double* record, ChBody* body);
+    // Add a distributed body to the system and record where its collision shapes are stored.
+    void AddDistributedBody(std::shared_ptr<ChBody> body);
+    // Size of a record (in doubles).
+    static int RecordSize(const double* record);
+    // Park a body which left this rank.
+    void ParkBody(std::shared_ptr<ChBody> body);
+    // Change the collision family of a body (applied to the collision shapes by ApplyFamilies).
+    void SetFamily(ChBody* body, short group, short mask);
+    void ApplyFamilies();
+
+    // Send buffers to the two neighbors (0: lower, 1: upper) and receive theirs.
+    void SendReceive(std::vector<double> send[2], std::vector<double> recv[2], int tag);
+    void ExchangeBodies();
+    // Sum the contact forces on the movable global bodies over all ranks.
+    void ReduceGlobalBodies();
+
+    MPI_Comm comm;
+    int rank;
+    int num_ranks;
+
+    int split_axis;      // axis normal to the slabs
+    double domain_lo;    // lower end of the decomposed interval
+    double slab_width;   // width of a slab
+    double ghost_width;  // width of the ghost layer set by the user (negative: automatic)
+    double ghost_layer;  // width of the ghost layer used in the last exchange
+    double max_radius;   // largest bounding radius of the distributed bodies added on this rank
+
+    std::unordered_map<int, std::shared_ptr<ChBody>> owned;   // bodies owned by this rank
+    std::unordered_map<int, std::shared_ptr<ChBody>> ghosts;  // copies of bodies owned by the neighbors
+    std::vector<std::shared_ptr<ChBody>> global_movable;      // movable bodies replicated on all ranks
+    short global_groups;                                      // family groups of the movable global bodies
+
+    std::map<std::vector<int>, std::vector<std::shared_ptr<ChBody>>> parked;  // parked bodies, by shape types
+    std::unordered_map<ChBody*, int> shape_start;                            // first collision shape of the bodies
+    std::unordered_map<ChBody*, short2> family_changes;                          // pending family changes
+
+    ChTimer<double> exchange_timer;  // time spent in the exchanges with the other ranks
+};
+
+/// @} parallel_module
+
+}  // end namespace chrono
@@ -84,10 +84,27 @@ class CH_PARALLEL_API ChIterativeSolverParallelDVI : public ChIterativeSolverPar
     void PreSolve();
     ///< This function is used to change the solver algorithm.
     void ChangeSolverType(SolverType type);
+    ///< Initialize the contact multipliers from the same contacts (shape pair and ordinal) of the previous step
+    void WarmStartContacts();
+    ///< Store the contact multipliers, sorted by shape pair, for warm starting the next step
+    void CacheContactImpulses();
+    ///< Partition the contacts and bilaterals into islands of bodies that do not interact
+    void ComputeIslands();
+    ///< Solve each island separately with the APGD method, in parallel. Return the largest number of iterations
+    uint SolveIslands(const uint max_iter);
 
   private:
     ChShurProduct ShurProductFull;
     ChProjectConstraints ProjectFull;
+
+    custom_vector<int> island_row_start;                 // start of each island in island_rows (one extra entry)
+    custom_vector<int> island_rows;                      // rows of the full system in each island, in increasing order
+    custom_vector<int> island_contact_start;             // start of each island in island_contacts (one extra entry)
+    custom_vector<int> island_contacts;                  // rigid contacts in each island
+    custom_vector<int> island_order;                     // islands with constraints, by decreasing number of rows
+    std::vector<CompressedMatrix<real> > island_D_T;     // rows of D_T in each island
+    std::vector<CompressedMatrix<real> > island_M_invD;  // M_inv * trans(island_D_T) of each island
+    DynamicVector<real> island_gamma;                    // full size multipliers, used to project those of the islands
 };
 
 class CH_PARALLEL_API ChIterativeSolverParallelDEM : public ChIterativeSolverParallel {
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "chrono_parallel/solver/ChIterativeSolverParallel.h"
 
 using namespace chrono;
@@ -46,6 +48,9 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
 
     data_manager->host_data.gamma.resize(data_manager->num_constraints);
     data_manager->host_data.gamma.reset();
+    if (warm_start) {
+        WarmStartContacts();
+    }
 
     // Perform any setup tasks for all constraint types
     data_manager->rigid_rigid->Setup(data_manager);
@@ -68,6 +73,18 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
     ComputeE();
     ComputeR();
     ComputeN();
+
+    // Islands are found through the rigid bodies and shafts, so they are not used with 3DOF or FEA constraints
+    bool solve_islands = data_manager->settings.solver.solve_islands && data_manager->num_constraints > 0 &&
+                         num_3dof_3dof == 0 && num_tet_constraints == 0;
+    if (solve_islands) {
+        ComputeIslands();
+    } else {
+        island_order.clear();
+        island_D_T.clear();
+        island_M_invD.clear();
+    }
+    data_manager->measures.solver.number_of_islands = (uint)island_order.size();
     data_manager->system_timer.start("ChIterativeSolverParallel_Solve");
 
     data_manager->node_container->PreSolve();
@@ -80,9 +97,10 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
             data_manager->host_data.D_T *
                 (data_manager->host_data.v + data_manager->host_data.M_inv * data_manager->host_data.hf);
     }
-    ShurProductFull.Setup(data_manager);
+    // The full product is set up last, as it may release the double precision M_invD
     ShurProductBilateral.Setup(data_manager);
     ShurProductFEM.Setup(data_manager);
+    ShurProductFull.Setup(data_manager);
     ProjectFull.Setup(data_manager);
 
     PerformStabilization();
@@ -94,13 +112,18 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
             data_manager->settings.solver.local_solver_mode = SolverMode::NORMAL;
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelDVI::RunTimeStep - Solve Normal";
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                     //
-                              ProjectFull,                                         //
-                              data_manager->settings.solver.max_iteration_normal,  //
-                              data_manager->num_constraints,                       //
-                              data_manager->host_data.R,                           //
-                              data_manager->host_data.gamma);                      //
+            if (solve_islands) {
+                data_manager->measures.solver.total_iteration +=
+                    SolveIslands(data_manager->settings.solver.max_iteration_normal);
+            } else {
+                data_manager->measures.solver.total_iteration +=
+                    solver->Solve(ShurProductFull,                                     //
+                                  ProjectFull,                                         //
+                                  data_manager->settings.solver.max_iteration_normal,  //
+                                  data_manager->num_constraints,                       //
+                                  data_manager->host_data.R,                           //
+                                  data_manager->host_data.gamma);                      //
+            }
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING ||
@@ -109,13 +132,18 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
             data_manager->settings.solver.local_solver_mode = SolverMode::SLIDING;
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelDVI::RunTimeStep - Solve Sliding";
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                      //
-                              ProjectFull,                                          //
-                              data_manager->settings.solver.max_iteration_sliding,  //
-                              data_manager->num_constraints,                        //
-                              data_manager->host_data.R,                            //
-                              data_manager->host_data.gamma);                       //
+            if (solve_islands) {
+                data_manager->measures.solver.total_iteration +=
+                    SolveIslands(data_manager->settings.solver.max_iteration_sliding);
+            } else {
+                data_manager->measures.solver.total_iteration +=
+                    solver->Solve(ShurProductFull,                                      //
+                                  ProjectFull,                                          //
+                                  data_manager->settings.solver.max_iteration_sliding,  //
+                                  data_manager->num_constraints,                        //
+                                  data_manager->host_data.R,                            //
+                                  data_manager->host_data.gamma);                       //
+            }
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
@@ -123,13 +151,18 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
             data_manager->settings.solver.local_solver_mode = SolverMode::SPINNING;
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelDVI::RunTimeStep - Solve Spinning";
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                       //
-                              ProjectFull,                                           //
-                              data_manager->settings.solver.max_iteration_spinning,  //
-                              data_manager->num_constraints,                         //
-                              data_manager->host_data.R,                             //
-                              data_manager->host_data.gamma);                        //
+            if (solve_islands) {
+                data_manager->measures.solver.total_iteration +=
+                    SolveIslands(data_manager->settings.solver.max_iteration_spinning);
+            } else {
+                data_manager->measures.solver.total_iteration +=
+                    solver->Solve(ShurProductFull,                                       //
+                                  ProjectFull,                                           //
+                                  data_manager->settings.solver.max_iteration_spinning,  //
+                                  data_manager->num_constraints,                         //
+                                  data_manager->host_data.R,                             //
+                                  data_manager->host_data.gamma);                        //
+            }
         }
     }
 
@@ -166,6 +199,12 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
     data_manager->system_timer.stop("ChIterativeSolverParallel_Solve");
 
     ComputeImpulses();
+    if (warm_start) {
+        CacheContactImpulses();
+    } else {
+        data_manager->host_data.contact_pairs_prev.clear();
+        data_manager->host_data.gamma_rigid_prev.clear();
+    }
     for (int i = 0; i < data_manager->measures.solver.maxd_hist.size(); i++) {
         AtIterationEnd(data_manager->measures.solver.maxd_hist[i], data_manager->measures.solver.maxdeltalambda_hist[i],
                        i);
@@ -180,6 +219,386 @@ void ChIterativeSolverParallelDVI::RunTimeStep() {
                << " iterations: " << tot_iterations;
 }
 
+// Sort the contacts by shape pair, keeping the reported order within a pair, and return the
+// ordinal of each sorted contact within its pair.
+static void SortContactsByPair(const custom_vector<long long>& contact_pairs,
+                               custom_vector<int>& order,
+                               custom_vector<int>& ordinal) {
+    int num_contacts = (int)contact_pairs.size();
+    order.resize(num_contacts);
+    for (int i = 0; i < num_contacts; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&contact_pairs](int a, int b) { return contact_pairs[a] < contact_pairs[b]; });
+
+    ordinal.resize(num_contacts);
+    for (int k = 0; k < num_contacts; k++) {
+        bool same_pair = k > 0 && contact_pairs[order[k]] == contact_pairs[order[k - 1]];
+        ordinal[k] = same_pair ? ordinal[k - 1] + 1 : 0;
+    }
+}
+
+// Contacts are identified across steps by the pair of collision shapes plus the ordinal of the
+// contact among those of the same pair, in the order they are reported by the narrowphase (as in
+// ChContactPool). Multiple contacts of a pair are therefore matched correctly only as long as the
+// narrowphase reports them in a persistent order.
+void ChIterativeSolverParallelDVI::WarmStartContacts() {
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<long long>& pairs_prev = data_manager->host_data.contact_pairs_prev;
+    const custom_vector<real>& gamma_prev = data_manager->host_data.gamma_rigid_prev;
+    DynamicVector<real>& gamma = data_manager->host_data.gamma;
+
+    uint num_contacts = data_manager->num_rigid_contacts;
+    if (pairs_prev.size() == 0 || contact_pairs.size() != num_contacts) {
+        return;
+    }
+    SolverMode mode = data_manager->settings.solver.solver_mode;
+
+    custom_vector<int> order;
+    custom_vector<int> ordinal;
+    SortContactsByPair(contact_pairs, order, ordinal);
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_contacts; k++) {
+        int i = order[k];
+        auto it = std::lower_bound(pairs_prev.begin(), pairs_prev.end(), contact_pairs[i]);
+        size_t j = (it - pairs_prev.begin()) + ordinal[k];
+        if (j >= pairs_prev.size() || pairs_prev[j] != contact_pairs[i]) {
+            continue;
+        }
+        const real* g = &gamma_prev[6 * j];
+        gamma[i] = g[0];
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            gamma[num_contacts + i * 2 + 0] = g[1];
+            gamma[num_contacts + i * 2 + 1] = g[2];
+        }
+        if (mode == SolverMode::SPINNING) {
+            gamma[3 * num_contacts + i * 3 + 0] = g[3];
+            gamma[3 * num_contacts + i * 3 + 1] = g[4];
+            gamma[3 * num_contacts + i * 3 + 2] = g[5];
+        }
+    }
+}
+
+void ChIterativeSolverParallelDVI::CacheContactImpulses() {
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    custom_vector<long long>& pairs_prev = data_manager->host_data.contact_pairs_prev;
+    custom_vector<real>& gamma_prev = data_manager->host_data.gamma_rigid_prev;
+    const DynamicVector<real>& gamma = data_manager->host_data.gamma;
+
+    uint num_contacts = data_manager->num_rigid_contacts;
+    if (contact_pairs.size() != num_contacts) {
+        // Contact identities not available (e.g. with the Bullet collision system)
+        pairs_prev.clear();
+        gamma_prev.clear();
+        return;
+    }
+    SolverMode mode = data_manager->settings.solver.solver_mode;
+
+    // Sort contacts by shape pair, keeping the reported order within a pair
+    custom_vector<int> order;
+    custom_vector<int> ordinal;
+    SortContactsByPair(contact_pairs, order, ordinal);
+
+    pairs_prev.resize(num_contacts);
+    gamma_prev.resize(6 * num_contacts);
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_contacts; k++) {
+        int i = order[k];
+        real* g = &gamma_prev[6 * k];
+        pairs_prev[k] = contact_pairs[i];
+        g[0] = gamma[i];
+        g[1] = g[2] = g[3] = g[4] = g[5] = 0;
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            g[1] = gamma[num_contacts + i * 2 + 0];
+            g[2] = gamma[num_contacts + i * 2 + 1];
+        }
+        if (mode == SolverMode::SPINNING) {
+            g[3] = gamma[3 * num_contacts + i * 3 + 0];
+            g[4] = gamma[3 * num_contacts + i * 3 + 1];
+            g[5] = gamma[3 * num_contacts + i * 3 + 2];
+        }
+    }
+}
+
+// Find the root of the island of a node (with path halving).
+static int FindIsland(custom_vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// The nodes of the island graph are the rigid bodies followed by the shafts. Two nodes are in the same
+// island if a row of D_T couples them; the columns of fixed or inactive bodies and shafts are skipped,
+// so that they do not connect islands. All the rows of a contact are in the island of its normal row.
+void ChIterativeSolverParallelDVI::ComputeIslands() {
+    LOG(INFO) << "ChIterativeSolverParallelDVI::ComputeIslands()";
+    const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+    const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+    const custom_vector<char>& active_rigid = data_manager->host_data.active_rigid;
+    const custom_vector<char>& shaft_active = data_manager->host_data.shaft_active;
+
+    uint num_rigid_bodies = data_manager->num_rigid_bodies;
+    uint num_shafts = data_manager->num_shafts;
+    uint num_contacts = data_manager->num_rigid_contacts;
+    uint num_unilaterals = data_manager->num_unilaterals;
+    uint num_rows = num_unilaterals + data_manager->num_bilaterals;
+    uint num_nodes = num_rigid_bodies + num_shafts;
+
+    custom_vector<int> parent(num_nodes);
+    Thrust_Sequence(parent);
+
+    // Node of the normal row of each contact and of each bilateral (-1 if only fixed bodies)
+    custom_vector<int> row_node(num_contacts + data_manager->num_bilaterals, -1);
+    for (uint k = 0; k < row_node.size(); k++) {
+        uint row = k < num_contacts ? k : num_unilaterals + (k - num_contacts);
+        int first = -1;
+        for (CompressedMatrix<real>::ConstIterator it = D_T.begin(row); it != D_T.end(row); ++it) {
+            uint col = (uint)it->index();
+            int node = -1;
+            if (col < num_rigid_bodies * 6) {
+                node = active_rigid[col / 6] ? (int)(col / 6) : -1;
+            } else if (col < num_rigid_bodies * 6 + num_shafts) {
+                uint shaft = col - num_rigid_bodies * 6;
+                node = shaft_active[shaft] ? (int)(num_rigid_bodies + shaft) : -1;
+            }
+            if (node < 0) {
+                continue;
+            }
+            if (first < 0) {
+                first = node;
+                continue;
+            }
+            int r1 = FindIsland(parent, first);
+            int r2 = FindIsland(parent, node);
+            if (r1 != r2) {
+                parent[std::max(r1, r2)] = std::min(r1, r2);
+            }
+        }
+        row_node[k] = first;
+    }
+
+    // Number the islands and find the island of each row. Rows that only involve fixed bodies are not
+    // in any island and their multipliers are left as they are.
+    custom_vector<int> node_island(num_nodes, -1);
+    int num_islands = 0;
+    for (uint i = 0; i < num_nodes; i++) {
+        int root = FindIsland(parent, i);
+        if (node_island[root] < 0) {
+            node_island[root] = num_islands++;
+        }
+        node_island[i] = node_island[root];
+    }
+    custom_vector<int> row_island(num_rows, -1);
+    for (uint row = 0; row < num_rows; row++) {
+        int k;
+        if (row < num_contacts) {
+            k = row;
+        } else if (row < 3 * num_contacts) {
+            k = (row - num_contacts) / 2;
+        } else if (row < num_unilaterals) {
+            k = (row - 3 * num_contacts) / 3;
+        } else {
+            k = num_contacts + (row - num_unilaterals);
+        }
+        row_island[row] = row_node[k] < 0 ? -1 : node_island[FindIsland(parent, row_node[k])];
+    }
+
+    // Rows and contacts of each island, keeping them in increasing order
+    island_row_start.assign(num_islands + 1, 0);
+    island_contact_start.assign(num_islands + 1, 0);
+    for (uint row = 0; row < num_rows; row++) {
+        if (row_island[row] >= 0) {
+            island_row_start[row_island[row] + 1]++;
+            if (row < num_contacts) {
+                island_contact_start[row_island[row] + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < num_islands; i++) {
+        island_row_start[i + 1] += island_row_start[i];
+        island_contact_start[i + 1] += island_contact_start[i];
+    }
+    island_rows.resize(island_row_start[num_islands]);
+    island_contacts.resize(island_contact_start[num_islands]);
+    custom_vector<int> row_fill(island_row_start.begin(), island_row_start.end() - 1);
+    custom_vector<int> contact_fill(island_contact_start.begin(), island_contact_start.end() - 1);
+    for (uint row = 0; row < num_rows; row++) {
+        int i = row_island[row];
+        if (i >= 0) {
+            island_rows[row_fill[i]++] = row;
+            if (row < num_contacts) {
+                island_contacts[contact_fill[i]++] = row;
+            }
+        }
+    }
+
+    // Islands without constraints (bodies on their own) are skipped; the largest islands are scheduled first
+    island_order.clear();
+    for (int i = 0; i < num_islands; i++) {
+        if (island_row_start[i + 1] > island_row_start[i]) {
+            island_order.push_back(i);
+        }
+    }
+    std::stable_sort(island_order.begin(), island_order.end(), [this](int a, int b) {
+        return island_row_start[a + 1] - island_row_start[a] > island_row_start[b + 1] - island_row_start[b];
+    });
+
+    // Rows of D_T and columns of M_inv * D of each island
+    island_D_T.resize(num_islands);
+    island_M_invD.resize(num_islands);
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < (signed)island_order.size(); k++) {
+        int i = island_order[k];
+        int start = island_row_start[i];
+        int num_island_rows = island_row_start[i + 1] - start;
+
+        size_t nnz = 0;
+        for (int l = 0; l < num_island_rows; l++) {
+            nnz += D_T.nonZeros(island_rows[start + l]);
+        }
+        CompressedMatrix<real>& D_T_i = island_D_T[i];
+        D_T_i.resize(num_island_rows, D_T.columns(), false);
+        D_T_i.reserve(nnz);
+        for (int l = 0; l < num_island_rows; l++) {
+            int row = island_rows[start + l];
+            for (CompressedMatrix<real>::ConstIterator it = D_T.begin(row); it != D_T.end(row); ++it) {
+                D_T_i.append(l, it->index(), it->value());
+            }
+            D_T_i.finalize(l);
+        }
+        island_M_invD[i] = M_inv * trans(D_T_i);
+    }
+}
+
+// Shur product restricted to the rows of an island. As in ChShurProduct, only the rows of the current local
+// solver mode (and the bilaterals) take part in the solve.
+class ChShurProductIsland : public ChShurProduct {
+  public:
+    ChShurProductIsland(const CompressedMatrix<real>& D_T_, const CompressedMatrix<real>& M_invD_)
+        : D_T_i(D_T_), M_invD_i(M_invD_) {}
+
+    virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX) override {
+        masked = mask * x;
+        AX = mask * (D_T_i * (M_invD_i * masked) + e * masked);
+    }
+
+    const CompressedMatrix<real>& D_T_i;     // rows of D_T in the island
+    const CompressedMatrix<real>& M_invD_i;  // M_inv * trans(D_T_i)
+    DynamicVector<real> mask;                // 1 for the rows solved in the current local solver mode, 0 otherwise
+    DynamicVector<real> e;                   // compliance of the rows
+    DynamicVector<real> masked;              // masked input vector
+};
+
+// Projection of the multipliers of an island. They are scattered to a full size vector, since the projection of
+// a contact only touches the rows of that contact, which all belong to the same island.
+class ChProjectIsland : public ChProjectConstraints {
+  public:
+    ChProjectIsland(const int* rows_, uint size_, const int* contacts_, uint num_contacts_, real* full_gamma_)
+        : rows(rows_), size(size_), contacts(contacts_), num_contacts(num_contacts_), full_gamma(full_gamma_) {}
+
+    virtual void operator()(real* data) override {
+        vec2* bids = data_manager->host_data.bids_rigid_rigid.data();
+        real3* friction = data_manager->host_data.fric_rigid_rigid.data();
+        real* cohesion = data_manager->host_data.coh_rigid_rigid.data();
+        for (uint l = 0; l < size; l++) {
+            full_gamma[rows[l]] = data[l];
+        }
+        for (uint c = 0; c < num_contacts; c++) {
+            data_manager->rigid_rigid->host_Project_single(contacts[c], bids, friction, cohesion, full_gamma);
+        }
+        for (uint l = 0; l < size; l++) {
+            data[l] = full_gamma[rows[l]];
+        }
+    }
+
+    const int* rows;      // rows of the full system in the island
+    uint size;            // number of rows
+    const int* contacts;  // rigid contacts in the island
+    uint num_contacts;    // number of contacts
+    real* full_gamma;     // full size multipliers
+};
+
+// Each island is solved with its own ChSolverParallelAPGD, on the rows of the island. The solvers run
+// concurrently, each with its own measures; the residual reported is the largest one.
+uint ChIterativeSolverParallelDVI::SolveIslands(const uint max_iter) {
+    LOG(INFO) << "ChIterativeSolverParallelDVI::SolveIslands()";
+    data_manager->system_timer.start("ChSolverParallel_Solve");
+
+    const DynamicVector<real>& R = data_manager->host_data.R;
+    const DynamicVector<real>& E = data_manager->host_data.E;
+    DynamicVector<real>& gamma = data_manager->host_data.gamma;
+
+    uint num_contacts = data_manager->num_rigid_contacts;
+    uint num_unilaterals = data_manager->num_unilaterals;
+    uint num_solved_unilaterals = num_unilaterals;
+    switch (data_manager->settings.solver.local_solver_mode) {
+        case SolverMode::NORMAL:
+            num_solved_unilaterals = std::min(num_unilaterals, num_contacts);
+            break;
+        case SolverMode::SLIDING:
+            num_solved_unilaterals = std::min(num_unilaterals, 3 * num_contacts);
+            break;
+        case SolverMode::BILATERAL:
+            num_solved_unilaterals = 0;
+            break;
+        default:
+            break;
+    }
+
+    island_gamma.resize(gamma.size());
+    uint num_islands = (uint)island_order.size();
+    custom_vector<uint> island_iterations(num_islands, 0);
+    std::vector<solver_measures> island_measures(num_islands);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < (signed)num_islands; k++) {
+        int i = island_order[k];
+        const int* rows = &island_rows[island_row_start[i]];
+        uint size = island_row_start[i + 1] - island_row_start[i];
+
+        ChShurProductIsland shur_product(island_D_T[i], island_M_invD[i]);
+        ChProjectIsland project(rows, size, &island_contacts[island_contact_start[i]],
+                                island_contact_start[i + 1] - island_contact_start[i], island_gamma.data());
+        project.Setup(data_manager);
+
+        DynamicVector<real> r(size), x(size);
+        shur_product.mask.resize(size);
+        shur_product.e.resize(size);
+        for (uint l = 0; l < size; l++) {
+            bool solved = rows[l] < (signed)num_solved_unilaterals || rows[l] >= (signed)num_unilaterals;
+            shur_product.mask[l] = solved ? 1 : 0;
+            shur_product.e[l] = E[rows[l]];
+            r[l] = R[rows[l]];
+            x[l] = gamma[rows[l]];
+        }
+
+        ChSolverParallelAPGD island_solver;
+        island_solver.Setup(data_manager);
+        island_solver.SetMeasures(&island_measures[k]);
+        island_iterations[k] = island_solver.Solve(shur_product, project, max_iter, size, r, x);
+
+        for (uint l = 0; l < size; l++) {
+            gamma[rows[l]] = x[l];
+        }
+    }
+
+    uint max_iterations = 0;
+    real max_residual = 0;
+    for (uint k = 0; k < num_islands; k++) {
+        max_iterations = std::max(max_iterations, island_iterations[k]);
+        max_residual = std::max(max_residual, island_measures[k].residual);
+    }
+    data_manager->measures.solver.residual = max_residual;
+
+    data_manager->system_timer.stop("ChSolverParallel_Solve");
+    return max_iterations;
+}
+
 void ChIterativeSolverParallelDVI::ComputeD() {
     LOG(INFO) << "ChIterativeSolverParallelDVI::ComputeD()";
     data_manager->system_timer.start("ChIterativeSolverParallel_D");
@@ -385,6 +804,7 @@ void ChIterativeSolverParallelDVI::ComputeImpulses() {
     LOG(INFO) << "ChIterativeSolverParallelDVI::ComputeImpulses()";
     const DynamicVector<real>& M_invk = data_manager->host_data.M_invk;
     const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+    const CompressedMatrix<real>& D = data_manager->host_data.D;
     const DynamicVector<real>& gamma = data_manager->host_data.gamma;
 
     const DynamicVector<real>& hf = data_manager->host_data.hf;
@@ -392,7 +812,8 @@ void ChIterativeSolverParallelDVI::ComputeImpulses() {
 
     if (data_manager->num_constraints > 0) {
         // Compute new velocity based on the lagrange multipliers
-        v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
+        // (M_invD is not kept when the Shur products are in single precision)
+        v = v + M_inv * (hf + D * gamma);
     } else {
         // When there are no constraints we need to still apply gravity and other
         // body forces!
@@ -4,10 +4,56 @@ using namespace chrono;
 
 ChShurProduct::ChShurProduct() {
     data_manager = 0;
+    use_single = false;
 }
+
+// Copy a sparse matrix into a single precision matrix with the same sparsity pattern.
+static void ConvertToSingle(const CompressedMatrix<real>& in, CompressedMatrix<float>& out) {
+    clear(out);
+    out.resize(in.rows(), in.columns(), false);
+    out.reserve(in.nonZeros());
+    for (size_t row = 0; row < in.rows(); ++row) {
+        for (CompressedMatrix<real>::ConstIterator it = in.begin(row); it != in.end(row); ++it) {
+            out.append(row, it->index(), (float)it->value());
+        }
+        out.finalize(row);
+    }
+}
+
+void ChShurProduct::Setup(ChParallelDataManager* data_container_) {
+    data_manager = data_container_;
+
+    // The single precision product only pays off if real is double. The FEM product reads M_invD while solving.
+    use_single = data_manager->settings.solver.use_single_precision && sizeof(real) > sizeof(float) &&
+                 data_manager->num_constraints > 0 && data_manager->num_fea_tets == 0;
+    if (!use_single) {
+        clear(M_invD_single);
+        clear(N_single);
+        return;
+    }
+
+    // Keep a single representation of M_invD and Nshur: the double precision matrices are released once converted,
+    // so this must be called after the other products that read them have been set up. D_T is used elsewhere in
+    // double precision and is not copied.
+    ConvertToSingle(data_manager->host_data.M_invD, M_invD_single);
+    CompressedMatrix<real> released;
+    swap(data_manager->host_data.M_invD, released);
+    if (data_manager->settings.solver.compute_N) {
+        ConvertToSingle(data_manager->host_data.Nshur, N_single);
+        CompressedMatrix<real> released_N;
+        swap(data_manager->host_data.Nshur, released_N);
+    }
+}
+
 void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>& output) {
     data_manager->system_timer.start("ShurProduct");
 
+    if (use_single) {
+        ProductSingle(x, output);
+        data_manager->system_timer.stop("ShurProduct");
+        return;
+    }
+
     const DynamicVector<real>& E = data_manager->host_data.E;
 
     uint num_rigid_contacts = data_manager->num_rigid_contacts;
@@ -90,8 +136,58 @@ void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>
     data_manager->system_timer.stop("ShurProduct");
 }
 
+// The product is computed on the whole matrices, with the entries of x outside the rows of the local solver mode (and
+// the bilaterals) set to zero; this gives the same result as the products of the submatrices above. M_invD (or N) is
+// in single precision, D_T and the E term in double precision.
+void ChShurProduct::ProductSingle(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    const DynamicVector<real>& E = data_manager->host_data.E;
+
+    uint num_rigid_contacts = data_manager->num_rigid_contacts;
+    uint num_unilaterals = data_manager->num_unilaterals;
+    uint num_bilaterals = data_manager->num_bilaterals;
+    int size = (int)x.size();
+
+    bool full = data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode;
+    uint num_local = 0;
+    switch (data_manager->settings.solver.local_solver_mode) {
+        case SolverMode::NORMAL:
+            num_local = num_rigid_contacts;
+            break;
+        case SolverMode::SLIDING:
+            num_local = num_rigid_contacts * 3;
+            break;
+        case SolverMode::SPINNING:
+            num_local = num_rigid_contacts * 6;
+            break;
+        default:
+            break;
+    }
+
+    x_single.resize(size);
+#pragma omp parallel for
+    for (int i = 0; i < size; i++) {
+        bool active = full || i < (signed)num_local ||
+                      (i >= (signed)num_unilaterals && i < (signed)(num_unilaterals + num_bilaterals));
+        x_single[i] = active ? (float)x[i] : 0.0f;
+    }
+
+    if (full && data_manager->settings.solver.compute_N) {
+        out_single = N_single * x_single;
+    } else {
+        tmp_single = M_invD_single * x_single;
+        out_single = data_manager->host_data.D_T * tmp_single;
+    }
+
+#pragma omp parallel for
+    for (int i = 0; i < size; i++) {
+        bool active = full || i < (signed)num_local ||
+                      (i >= (signed)num_unilaterals && i < (signed)(num_unilaterals + num_bilaterals));
+        output[i] = active ? out_single[i] + E[i] * x[i] : 0;
+    }
+}
+
 void ChShurProductBilateral::Setup(ChParallelDataManager* data_container_) {
-    ChShurProduct::Setup(data_container_);
+    data_manager = data_container_;
     if (data_manager->num_bilaterals == 0) {
         return;
     }
@@ -103,7 +199,7 @@ void ChShurProductBilateral::operator()(const DynamicVector<real>& x, DynamicVec
 }
 
 void ChShurProductFEM::Setup(ChParallelDataManager* data_container_) {
-    ChShurProduct::Setup(data_container_);
+    data_manager = data_container_;
     //    if (data_manager->num_fea_tets == 0) {
     //        return;
     //    }
@@ -16,6 +16,7 @@ ChSolverParallel::ChSolverParallel() {
     three_dof = NULL;
     fem = NULL;
     bilateral = NULL;
+    measures = NULL;
 }
 
 //=================================================================================================================================
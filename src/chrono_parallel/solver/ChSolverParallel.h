@@ -55,13 +55,24 @@ class CH_PARALLEL_API ChShurProduct {
     ChShurProduct();
     virtual ~ChShurProduct() {}
 
-    virtual void Setup(ChParallelDataManager* data_container_) { data_manager = data_container_; }
+    virtual void Setup(ChParallelDataManager* data_container_);
 
     // Perform the Shur Product
     virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
 
     // Pointer to the system's data manager
     ChParallelDataManager* data_manager;
+
+  protected:
+    // Perform the Shur Product with the single precision matrices
+    void ProductSingle(const DynamicVector<real>& x, DynamicVector<real>& AX);
+
+    bool use_single;                        // true if the single precision matrices are used
+    CompressedMatrix<float> M_invD_single;  // M_invD in single precision (replaces the double precision one)
+    CompressedMatrix<float> N_single;       // Nshur in single precision (if compute_N, replaces the double one)
+    DynamicVector<float> x_single;          // single precision copy of the input vector
+    DynamicVector<float> tmp_single;        // M_invD * x
+    DynamicVector<real> out_single;         // D_T * M_invD * x
 };
 
 class CH_PARALLEL_API ChShurProductBilateral : public ChShurProduct {
@@ -96,6 +107,13 @@ class CH_PARALLEL_API ChSolverParallel {
 
     void Setup(ChParallelDataManager* data_container_) { data_manager = data_container_; }
 
+    // Use the given measures instead of those of the data manager. This is required for solvers run concurrently
+    // on separate sub-problems; such solvers do not use the system timer and do not update the rhs vector.
+    void SetMeasures(solver_measures* measures_) { measures = measures_; }
+
+    // Return the measures updated by the solver
+    solver_measures& GetMeasures() { return measures ? *measures : data_manager->measures.solver; }
+
     // Compute rhs value with relaxation term
     void ComputeSRhs(custom_vector<real>& gamma,
                      const custom_vector<real>& rhs,
@@ -113,8 +131,8 @@ class CH_PARALLEL_API ChSolverParallel {
                        ) = 0;
 
     void AtIterationEnd(real maxd, real maxdeltalambda) {
-        data_manager->measures.solver.maxd_hist.push_back(maxd);
-        data_manager->measures.solver.maxdeltalambda_hist.push_back(maxdeltalambda);
+        GetMeasures().maxd_hist.push_back(maxd);
+        GetMeasures().maxdeltalambda_hist.push_back(maxdeltalambda);
     }
 
     real LargestEigenValue(ChShurProduct& ShurProduct, DynamicVector<real>& temp, real lambda = 0);
@@ -130,6 +148,9 @@ class CH_PARALLEL_API ChSolverParallel {
     // Pointer to the system's data manager
     ChParallelDataManager* data_manager;
 
+    // Measures used instead of those of the data manager (if not NULL)
+    solver_measures* measures;
+
     DynamicVector<real> eigen_vec;
 };
 
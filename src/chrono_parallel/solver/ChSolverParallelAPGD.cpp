@@ -48,11 +48,14 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
         return 0;
     }
 
-    real& residual = data_manager->measures.solver.residual;
-    real& objective_value = data_manager->measures.solver.objective_value;
+    solver_measures& measures_solver = GetMeasures();
+    real& residual = measures_solver.residual;
+    real& objective_value = measures_solver.objective_value;
 
     DynamicVector<real> one(size, 1.0);
-    data_manager->system_timer.start("ChSolverParallel_Solve");
+    if (!measures) {
+        data_manager->system_timer.start("ChSolverParallel_Solve");
+    }
     gamma_hat.resize(size);
     N_gamma_new.resize(size);
     temp.resize(size);
@@ -80,20 +83,20 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
     real norm_temp = Sqrt((real)(temp, temp));
     if (data_manager->settings.solver.cache_step_length == true) {
         if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
-            L = data_manager->measures.solver.normal_apgd_step_length;
+            L = measures_solver.normal_apgd_step_length;
         } else if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING) {
-            L = data_manager->measures.solver.sliding_apgd_step_length;
+            L = measures_solver.sliding_apgd_step_length;
         } else if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
-            L = data_manager->measures.solver.spinning_apgd_step_length;
+            L = measures_solver.spinning_apgd_step_length;
         } else if (data_manager->settings.solver.solver_mode == SolverMode::BILATERAL) {
-            L = data_manager->measures.solver.bilateral_apgd_step_length;
+            L = measures_solver.bilateral_apgd_step_length;
         } else {
             L = 1.0;
         }
     } else if (data_manager->settings.solver.use_power_iteration) {
-        data_manager->measures.solver.lambda_max =
-            LargestEigenValue(ShurProduct, temp, data_manager->measures.solver.lambda_max);
-        L = data_manager->measures.solver.lambda_max;
+        measures_solver.lambda_max =
+            LargestEigenValue(ShurProduct, temp, measures_solver.lambda_max);
+        L = measures_solver.lambda_max;
     } else {
         // If gamma is one temp should be zero, in that case set L to one
         // We cannot divide by 0
@@ -198,21 +201,23 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
         theta = theta_new;
         gamma = gamma_new;
 
-        if (data_manager->settings.solver.update_rhs) {
+        if (data_manager->settings.solver.update_rhs && !measures) {
             UpdateR();
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
-        data_manager->measures.solver.normal_apgd_step_length = L;
+        measures_solver.normal_apgd_step_length = L;
     } else if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING) {
-        data_manager->measures.solver.sliding_apgd_step_length = L;
+        measures_solver.sliding_apgd_step_length = L;
     } else if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
-        data_manager->measures.solver.spinning_apgd_step_length = L;
+        measures_solver.spinning_apgd_step_length = L;
     } else if (data_manager->settings.solver.solver_mode == SolverMode::BILATERAL) {
-        data_manager->measures.solver.bilateral_apgd_step_length = L;
+        measures_solver.bilateral_apgd_step_length = L;
     }
     gamma = gamma_hat;
 
-    data_manager->system_timer.stop("ChSolverParallel_Solve");
+    if (!measures) {
+        data_manager->system_timer.stop("ChSolverParallel_Solve");
+    }
     return current_iteration;
 }
@@ -25,7 +25,8 @@ uint ChSolverParallelGS::Solve(ChShurProduct& ShurProduct,
     uint num_contacts = data_manager->num_rigid_contacts;
     uint num_bilaterals = data_manager->num_bilaterals;
 
-    CompressedMatrix<real> Nshur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
+    CompressedMatrix<real> Nshur =
+        data_manager->host_data.D_T * (data_manager->host_data.M_inv * data_manager->host_data.D);
     DynamicVector<real> D;
     D.resize(num_constraints, false);
 
@@ -29,7 +29,8 @@ uint ChSolverParallelJacobi::Solve(ChShurProduct& ShurProduct,
     temp.resize(size);
     DynamicVector<real> deltal;
     deltal.resize(size);
-    CompressedMatrix<real> Nshur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
+    CompressedMatrix<real> Nshur =
+        data_manager->host_data.D_T * (data_manager->host_data.M_inv * data_manager->host_data.D);
     DynamicVector<real> D;
     D.resize(num_constraints, false);
     real theta = 1;
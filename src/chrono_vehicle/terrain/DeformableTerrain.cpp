@@ -496,10 +496,17 @@ void DeformableSoil::ComputeInternalForces() {
     // Perform ray-hit test to detect the contact point sinkage
     // 
     
-    
-//#pragma omp parallel for
+    // All the rays are tested at once, in parallel, by the collision system (same hits as RayHit())
+    std::vector<collision::ChCollisionSystem::ChRay> rays(vertices.size());
+    for (int i=0; i< vertices.size(); ++i) {
+        rays[i].to   = vertices[i] +N*test_high_offset; 
+        rays[i].from = rays[i].to - N*test_low_offset;
+    }
+    std::vector<collision::ChCollisionSystem::ChRayhitResult> rayhit_results;
+    this->GetSystem()->GetCollisionSystem()->RayHitBatch(rays, rayhit_results);
+
     for (int i=0; i< vertices.size(); ++i) {
-        collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+        const collision::ChCollisionSystem::ChRayhitResult& mrayhit_result = rayhit_results[i];
         p_sigma[i] = 0;
         p_sinkage_elastic[i] = 0;
         p_step_plastic_flow[i]=0;
@@ -507,15 +514,9 @@ void DeformableSoil::ComputeInternalForces() {
 
         p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
 
-        ChVector<> to   = vertices[i] +N*test_high_offset; 
-        ChVector<> from = to - N*test_low_offset;
-        
         p_hit_level[i] = 1e9;
         double p_hit_offset = 1e9;
 
-        // DO THE RAY-HIT TEST HERE:
-        this->GetSystem()->GetCollisionSystem()->RayHit(from,to,mrayhit_result);
-
         if (mrayhit_result.hit == true) {
 
             ChContactable* contactable = mrayhit_result.hitModel->GetContactable();
@@ -0,0 +1,204 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the built-in sparse LDL' direct solver.
+// - random symmetric positive definite and KKT (saddle point) matrices are factorized
+//   with the different orderings and numbers of threads, and the residuals checked;
+//   refactorizing a matrix with the same pattern must reuse the analysis.
+// - a pendulum chain is simulated with HHT, with ChSolverSparseLDLT and with MINRES;
+//   the analysis must be reused across steps.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+
+#include "chrono/core/ChSparseLDLT.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/solver/ChSolverSparseLDLT.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Fill A with a KKT matrix [H Cq'; Cq 0], with H a sparse SPD matrix of size nq and Cq a sparse nc x nq matrix.
+// The sparsity pattern does not depend on the seed.
+void FillKKT(ChCSR3Matrix& A, int nq, int nc, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::mt19937 gen_pattern(0);
+    std::uniform_real_distribution<double> val(-1.0, 1.0);
+    std::uniform_int_distribution<int> col(0, nq - 1);
+
+    A.Reset(nq + nc, nq + nc);
+    for (int i = 0; i < nq; i++) {
+        A.SetElement(i, i, 10 + val(gen));
+        for (int k = 1; k <= 3; k++) {
+            int j = (i + 7 * k) % nq;
+            if (j == i)
+                continue;
+            double v = val(gen);
+            A.SetElement(i, j, v, false);
+            A.SetElement(j, i, v, false);
+        }
+    }
+    for (int i = 0; i < nc; i++) {
+        for (int k = 0; k < 3; k++) {
+            int j = (col(gen_pattern) + i) % nq;
+            double v = val(gen);
+            A.SetElement(nq + i, j, v, false);
+            A.SetElement(j, nq + i, v, false);
+        }
+    }
+    A.Compress();
+}
+
+// Return the infinity norm of b - A*x.
+double Residual(ChCSR3Matrix& A, const ChMatrixDynamic<>& x, const ChMatrixDynamic<>& b) {
+    const int* Ap = A.GetCSR_LeadingIndexArray();
+    const int* Ai = A.GetCSR_TrailingIndexArray();
+    const double* Ax = A.GetCSR_ValueArray();
+    double res = 0;
+    for (int i = 0; i < A.GetNumRows(); i++) {
+        double r = b(i);
+        for (int p = Ap[i]; p < Ap[i + 1]; p++)
+            r -= Ax[p] * x(Ai[p]);
+        res = std::max(res, std::abs(r));
+    }
+    return res;
+}
+
+bool TestFactorization(int nq, int nc, ChSparseLDLT::Ordering ordering, int nthreads) {
+    ChCSR3Matrix A(1, 1);
+    FillKKT(A, nq, nc, 1);
+
+    ChMatrixDynamic<> b(nq + nc, 1);
+    for (int i = 0; i < nq + nc; i++)
+        b(i) = std::sin(1.0 * i);
+
+    ChSparseLDLT ldlt;
+    ldlt.SetOrdering(ordering);
+    ldlt.SetNumThreads(nthreads);
+    ldlt.SetNumPositivePivots(nq);
+    ldlt.SetPivotPerturbation(0);
+
+    // Factorize twice, with different values in the same pattern
+    bool passed = true;
+    for (unsigned int seed = 1; seed <= 2; seed++) {
+        FillKKT(A, nq, nc, seed);
+        if (!ldlt.Factorize(A)) {
+            GetLog() << "  zero pivot\n";
+            return false;
+        }
+        ChMatrixDynamic<> x;
+        ldlt.Solve(x, b);
+        double res = Residual(A, x, b);
+        GetLog() << "  n = " << nq + nc << "  nnz(L) = " << ldlt.GetNNZ_L() << "  residual = " << res << "\n";
+        passed &= res < 1e-10;
+    }
+
+    if (ldlt.GetNumAnalyses() != 1) {
+        GetLog() << "  analysis not reused\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+// ====================================================================================
+
+// Simulate a chain of pendulums with HHT and return the final positions.
+std::vector<ChVector<>> SimulateChain(std::shared_ptr<ChSolver> solver) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetSolver(solver);
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<ChVector<>> pos;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int i = 0; i < 5; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i + 1.0, 0, 0));
+        system.AddBody(body);
+        bodies.push_back(body);
+
+        auto hinge = std::make_shared<ChLinkLockRevolute>();
+        hinge->Initialize(prev, body, ChCoordsys<>(ChVector<>(i + 0.5, 0, 0), QUNIT));
+        system.AddLink(hinge);
+        prev = body;
+    }
+
+    while (system.GetChTime() < 0.5) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    for (auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+bool TestSolver() {
+    auto ldlt = std::make_shared<ChSolverSparseLDLT>();
+    auto minres = std::make_shared<ChSolverMINRES>();
+    minres->SetMaxIterations(500);
+    minres->SetTolerance(1e-14);
+
+    auto pos0 = SimulateChain(ldlt);
+    auto pos1 = SimulateChain(minres);
+
+    GetLog() << "  analyses: " << ldlt->GetEngine().GetNumAnalyses()
+             << "  perturbed pivots: " << ldlt->GetEngine().GetNumPerturbedPivots() << "\n";
+
+    for (size_t i = 0; i < pos0.size(); i++) {
+        GetLog() << "  body " << (int)i << ": " << pos0[i].x() << " " << pos0[i].y() << "  vs.  " << pos1[i].x() << " "
+                 << pos1[i].y() << "\n";
+        if ((pos0[i] - pos1[i]).Length() > 1e-6)
+            return false;
+    }
+
+    // Entries of the system matrix that are exactly zero in some steps are dropped from its pattern,
+    // so that a few analyses are needed until the analyzed pattern covers all steps.
+    return ldlt->GetEngine().GetNumAnalyses() <= 10;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    GetLog() << "SPD, natural ordering\n";
+    passed &= TestFactorization(200, 0, ChSparseLDLT::Ordering::NATURAL, 1);
+    GetLog() << "SPD, minimum degree ordering, 4 threads\n";
+    passed &= TestFactorization(200, 0, ChSparseLDLT::Ordering::MINIMUM_DEGREE, 4);
+    GetLog() << "KKT, minimum degree ordering\n";
+    passed &= TestFactorization(300, 40, ChSparseLDLT::Ordering::MINIMUM_DEGREE, 1);
+    GetLog() << "KKT, minimum degree ordering, 4 threads\n";
+    passed &= TestFactorization(3000, 400, ChSparseLDLT::Ordering::MINIMUM_DEGREE, 4);
+    GetLog() << "Pendulum chain, HHT\n";
+    passed &= TestSolver();
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
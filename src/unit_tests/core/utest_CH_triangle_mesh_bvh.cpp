@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the bounding volume hierarchy of ChTriangleMeshConnected.
+// Ray hits, closest points and box overlaps found through the hierarchy are
+// compared with those found by testing all triangles (a hierarchy with a single
+// leaf), first on a wavy surface, then after the surface is deformed and the
+// hierarchy refit, and after triangles are added or removed (the hierarchy is
+// then rebuilt on the next query).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+// Set the vertices of a wavy surface with the given amplitude.
+void SetSurface(ChTriangleMeshConnected& mesh, int n, double amplitude) {
+    auto& vertices = mesh.getCoordsVertices();
+    vertices.resize((n + 1) * (n + 1));
+    for (int ix = 0; ix <= n; ix++) {
+        for (int iy = 0; iy <= n; iy++) {
+            double x = -1 + 2.0 * ix / n;
+            double y = -1 + 2.0 * iy / n;
+            vertices[ix * (n + 1) + iy] = ChVector<>(x, y, amplitude * std::sin(3 * x) * std::cos(2 * y));
+        }
+    }
+}
+
+// Compare the queries through the mesh hierarchy with those through a single-leaf hierarchy.
+bool CheckQueries(const ChTriangleMeshConnected& mesh) {
+    const auto& vertices = mesh.m_vertices;
+    const auto& faces = mesh.m_face_v_indices;
+    ChTriangleMeshBVH brute;
+    brute.Build(vertices, faces, (int)faces.size());
+
+    int num_hits = 0;
+    int num_errors = 0;
+    for (int i = 0; i < 200; i++) {
+        ChVector<> from(-1.2 + 0.012 * i, 1.1 * std::sin(0.37 * i), 1);
+        ChVector<> to(1.2 - 0.011 * i, std::cos(0.23 * i), -1);
+
+        // Ray hits
+        int tri1, tri2;
+        ChVector<> p1, p2;
+        double t1, t2;
+        bool hit1 = mesh.RayHit(from, to, tri1, p1, t1);
+        bool hit2 = brute.RayHit(vertices, faces, from, to, tri2, p2, t2);
+        if (hit1 != hit2 || (hit1 && std::abs(t1 - t2) > 1e-10))
+            num_errors++;
+        num_hits += hit1;
+
+        // Closest points (within a limited distance)
+        double d1, d2;
+        hit1 = mesh.ClosestPoint(from, 1.0, tri1, p1, d1);
+        hit2 = brute.ClosestPoint(vertices, faces, from, 1.0, tri2, p2, d2);
+        if (hit1 != hit2 || (hit1 && std::abs(d1 - d2) > 1e-10))
+            num_errors++;
+
+        // Box overlaps
+        ChVector<> aabb_min(0.3 * from.x(), 0.3 * to.y(), 0.1 * from.z());
+        ChVector<> aabb_max = aabb_min + ChVector<>(0.2, 0.3, 0.1);
+        std::vector<int> tris1, tris2;
+        mesh.FindOverlappingTriangles(aabb_min, aabb_max, tris1);
+        brute.FindOverlaps(vertices, faces, aabb_min, aabb_max, tris2);
+        std::sort(tris1.begin(), tris1.end());
+        std::sort(tris2.begin(), tris2.end());
+        if (tris1 != tris2)
+            num_errors++;
+    }
+
+    GetLog() << "Nodes: " << (int)mesh.GetBVH().GetNodes().size() << "  ray hits: " << num_hits
+             << "  errors: " << num_errors << "\n";
+    return num_hits > 0 && num_errors == 0;
+}
+
+int main(int argc, char* argv[]) {
+    // Wavy surface, with two triangles per cell
+    int n = 40;
+    ChTriangleMeshConnected mesh;
+    SetSurface(mesh, n, 0.2);
+    auto& faces = mesh.getIndicesVertexes();
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            int v0 = ix * (n + 1) + iy;
+            int v1 = v0 + n + 1;
+            faces.push_back(ChVector<int>(v0, v1, v1 + 1));
+            faces.push_back(ChVector<int>(v0, v1 + 1, v0 + 1));
+        }
+    }
+
+    mesh.BuildBVH();
+    bool passed = CheckQueries(mesh);
+
+    // Deform the surface and refit the hierarchy
+    SetSurface(mesh, n, -0.5);
+    mesh.RefitBVH();
+    passed &= CheckQueries(mesh);
+
+    // Move the surface: the hierarchy is refit
+    mesh.Transform(ChVector<>(0.1, -0.2, 0.05), ChMatrix33<>(0.3));
+    passed &= CheckQueries(mesh);
+
+    // Add triangles above the surface: the hierarchy is rebuilt
+    for (int i = 0; i < 5; i++) {
+        double x = -0.8 + 0.3 * i;
+        mesh.addTriangle(ChVector<>(x, -0.5, 0.4), ChVector<>(x + 0.3, -0.5, 0.4), ChVector<>(x, 0.5, 0.5));
+    }
+    passed &= CheckQueries(mesh);
+    if (mesh.GetBVH().GetNumTriangles() != mesh.getNumTriangles()) {
+        GetLog() << "Hierarchy not rebuilt after adding triangles\n";
+        passed = false;
+    }
+
+    // Remove all triangles: nothing is found
+    mesh.Clear();
+    int tri;
+    ChVector<> point;
+    double t;
+    if (mesh.RayHit(ChVector<>(0, 0, 1), ChVector<>(0, 0, -1), tri, point, t)) {
+        GetLog() << "Ray hit on an empty mesh\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the zone profiler: call counts, self time of nested zones,
+// recording from several threads, statistics timed by the caller, and export files.
+//
+// =============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/utils/ChZoneProfiler.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+void Spin(double ms) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < ms) {
+    }
+}
+
+void Outer() {
+    CH_PROFILE_ZONE("outer");
+    Spin(2);
+    for (int i = 0; i < 3; i++) {
+        CH_PROFILE_ZONE("inner");
+        Spin(1);
+    }
+}
+
+const ChZoneProfiler::ZoneSummary* Find(const std::vector<ChZoneProfiler::ZoneSummary>& summary,
+                                        const std::string& name) {
+    for (auto& zone : summary) {
+        if (zone.name == name)
+            return &zone;
+    }
+    return nullptr;
+}
+
+int main(int argc, char* argv[]) {
+    ChZoneProfiler& profiler = ChZoneProfiler::GetInstance();
+    bool passed = true;
+
+    // Nothing is recorded while disabled
+    Outer();
+    if (!profiler.GetSummary().empty()) {
+        GetLog() << "Zones recorded while disabled\n";
+        passed = false;
+    }
+
+    // Record from the main thread and from 3 worker threads
+    profiler.SetBufferSize(16);
+    profiler.Reset();
+    profiler.Enable(true);
+    Outer();
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 3; i++)
+        workers.push_back(std::thread(Outer));
+    for (auto& w : workers)
+        w.join();
+    {
+        CH_PROFILE_ZONE(typeid(profiler));
+    }
+    profiler.RecordZoneStats(typeid(profiler), 4, 10.0, 3.0);  // e.g. aggregated over a loop
+    profiler.Enable(false);
+
+    auto summary = profiler.GetSummary();
+    auto outer = Find(summary, "outer");
+    auto inner = Find(summary, "inner");
+    auto type = Find(summary, "chrono::utils::ChZoneProfiler");
+
+    if (!outer || !inner || !type) {
+        GetLog() << "Missing zones\n";
+        return 1;
+    }
+
+    GetLog() << "outer: calls " << outer->calls << "  total " << outer->total << "  self " << outer->self << "\n";
+    GetLog() << "inner: calls " << inner->calls << "  total " << inner->total << "  self " << inner->self << "\n";
+
+    if (outer->calls != 4 || inner->calls != 12 || type->calls != 5) {
+        GetLog() << "Wrong call counts\n";
+        passed = false;
+    }
+    if (outer->total < 4 * 5.0 || inner->total < 12 * 1.0 || outer->max < 5.0 || type->total < 10.0 ||
+        type->max < 3.0) {
+        GetLog() << "Wrong zone times\n";
+        passed = false;
+    }
+    if (std::abs(outer->self - (outer->total - inner->total)) > 1e-6 * outer->total || inner->self != inner->total) {
+        GetLog() << "Wrong self times\n";
+        passed = false;
+    }
+
+    // Export
+    if (!profiler.WriteChromeTrace("zone_profiler_trace.json") || !profiler.WriteSummaryCSV("zone_profiler.csv")) {
+        GetLog() << "Export failed\n";
+        passed = false;
+    } else {
+        std::ifstream csv("zone_profiler.csv");
+        std::string header;
+        std::getline(csv, header);
+        int lines = 0;
+        std::string line;
+        while (std::getline(csv, line))
+            lines++;
+        if (header != "zone,calls,total_ms,self_ms,mean_ms,max_ms" || lines != (int)summary.size()) {
+            GetLog() << "Wrong CSV file\n";
+            passed = false;
+        }
+    }
+    std::remove("zone_profiler_trace.json");
+    std::remove("zone_profiler.csv");
+
+    // Reset discards everything
+    profiler.Reset();
+    if (!profiler.GetSummary().empty()) {
+        GetLog() << "Reset failed\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
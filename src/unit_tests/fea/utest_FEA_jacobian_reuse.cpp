@@ -0,0 +1,172 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the reuse of the Newton matrix across steps in the HHT integrator.
+// An ANCF cable pinned to ground swings under gravity. The Newton systems are
+// solved with a direct (LU) solver, with and without Jacobian reuse. The motion
+// must be the same (up to the Newton tolerance) while fewer factorizations are
+// performed when reusing the matrix.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/core/ChLinkedListMatrix.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolver.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono_fea/ChElementCableANCF.h"
+#include "chrono_fea/ChLinkPointFrame.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int num_steps = 200;      // number of simulation steps
+double time_step = 1e-3;  // integration step size
+int num_elements = 8;     // number of cable elements
+
+// Direct solver which assembles and factorizes the system matrix in Setup only.
+class LUSolver : public ChSolver {
+  public:
+    virtual bool SolveRequiresMatrix() const override { return false; }
+
+    virtual bool Setup(ChSystemDescriptor& sysd) override {
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
+        return m_mat.Setup_LU() == 0;
+    }
+
+    virtual double Solve(ChSystemDescriptor& sysd) override {
+        sysd.ConvertToMatrixForm(nullptr, &m_rhs);
+        m_sol.Resize(m_rhs.GetRows(), 1);
+        m_mat.Solve_LU(m_rhs, m_sol);
+        sysd.FromVectorToUnknowns(m_sol);
+        return 0;
+    }
+
+  private:
+    ChLinkedListMatrix m_mat;
+    ChMatrixDynamic<> m_rhs;
+    ChMatrixDynamic<> m_sol;
+};
+
+// Simulate the cable and return the final positions of its nodes.
+std::vector<ChVector<>> Simulate(bool reuse, int& num_setups, int& num_reuses) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto mesh = std::make_shared<ChMesh>();
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetBeamRaleyghDamping(0.0);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(i * 0.1, 0, 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = std::make_shared<ChElementCableANCF>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetSection(section);
+        mesh->AddElement(element);
+    }
+    system.Add(mesh);
+
+    auto pin = std::make_shared<ChLinkPointFrame>();
+    pin->Initialize(nodes[0], ground);
+    system.Add(pin);
+
+    system.SetupInitial();
+
+    system.SetSolver(std::make_shared<LUSolver>());
+
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto stepper = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    stepper->SetAlpha(-0.2);
+    stepper->SetMaxiters(50);
+    stepper->SetRelTolerance(1e-8);
+    stepper->SetAbsTolerances(1e-10);
+    stepper->SetStepControl(false);
+    stepper->SetModifiedNewton(true);
+    stepper->SetJacobianReuse(reuse);
+
+    for (int step = 0; step < num_steps; step++)
+        system.DoStepDynamics(time_step);
+
+    num_setups = stepper->GetTotalSetupCalls();
+    num_reuses = stepper->GetTotalReuses();
+
+    GetLog() << "Jacobian reuse: " << reuse << "  setups: " << num_setups << "  reuses: " << num_reuses
+             << "  rate refactorizations: " << stepper->GetNumRateRefactorizations()
+             << "  tip height: " << nodes.back()->GetPos().y() << "\n";
+
+    std::vector<ChVector<>> positions;
+    for (auto node : nodes)
+        positions.push_back(node->GetPos());
+    return positions;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    int setups_ref, reuses_ref;
+    int setups, reuses;
+    auto ref = Simulate(false, setups_ref, reuses_ref);
+    auto pos = Simulate(true, setups, reuses);
+
+    // The cable must have fallen
+    if (ref.back().y() > -1e-2) {
+        GetLog() << "The cable did not move\n";
+        passed = false;
+    }
+
+    // Without reuse, the matrix is factorized once per step
+    if (setups_ref != num_steps) {
+        GetLog() << "Wrong number of factorizations without Jacobian reuse\n";
+        passed = false;
+    }
+
+    // With reuse, the matrix must be factorized less often
+    if (setups >= setups_ref || reuses <= reuses_ref) {
+        GetLog() << "The Newton matrix was not reused\n";
+        passed = false;
+    }
+
+    double max_diff = 0;
+    for (size_t i = 0; i < ref.size(); i++)
+        max_diff = std::max(max_diff, (pos[i] - ref[i]).Length());
+    GetLog() << "Max. difference with / without reuse: " << max_diff << "\n";
+
+    if (max_diff > 1e-5) {
+        GetLog() << "Different motion with Jacobian reuse\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
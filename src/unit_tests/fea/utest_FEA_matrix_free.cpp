@@ -0,0 +1,211 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the matrix-free mode of FEA meshes with the GMRES solver.
+// An ANCF cable pinned to ground falls under gravity, integrated with HHT.
+// The Newton systems are solved with GMRES, with the element Jacobians loaded
+// or computed by the solver (matrix-free), and with the diagonal or the
+// block-Jacobi preconditioner. The motion must match the one obtained with
+// MINRES on the loaded Jacobians, and in matrix-free mode each element Jacobian
+// must be computed at most once per load.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverGMRES.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono_fea/ChElementCableANCF.h"
+#include "chrono_fea/ChLinkPointFrame.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int num_steps = 25;       // number of simulation steps
+double time_step = 1e-3;  // integration step size
+int num_elements = 6;     // number of cable elements
+
+// Cable element counting the evaluations of its Jacobian.
+class CountingCable : public ChElementCableANCF {
+  public:
+    CountingCable() : num_evaluations(0) {}
+    virtual void ComputeKRMmatricesGlobal(ChMatrix<>& H, double Kfactor, double Rfactor, double Mfactor) override {
+        ChElementCableANCF::ComputeKRMmatricesGlobal(H, Kfactor, Rfactor, Mfactor);
+        num_evaluations++;
+    }
+    int num_evaluations;
+};
+
+// Simulate the cable and return the final positions of its nodes.
+std::vector<ChVector<>> Simulate(ChSolver::Type solver_type,
+                                 bool matrix_free,
+                                 ChSolverGMRES::Preconditioner preconditioner,
+                                 bool& passed) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto mesh = std::make_shared<ChMesh>();
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetBeamRaleyghDamping(0.0);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(i * 0.1, 0, 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = std::make_shared<CountingCable>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetSection(section);
+        mesh->AddElement(element);
+    }
+    mesh->SetMatrixFree(matrix_free);
+    system.Add(mesh);
+
+    auto pin = std::make_shared<ChLinkPointFrame>();
+    pin->Initialize(nodes[0], ground);
+    system.Add(pin);
+
+    system.SetupInitial();
+
+    system.SetSolverType(solver_type);
+    system.SetSolverWarmStarting(true);
+    system.SetMaxItersSolverSpeed(400);
+    system.SetTolForce(1e-12);
+    if (auto gmres = std::dynamic_pointer_cast<ChSolverGMRES>(system.GetSolver())) {
+        gmres->SetPreconditioner(preconditioner);
+        gmres->SetRelTolerance(1e-12);
+    }
+
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto stepper = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    stepper->SetAlpha(-0.2);
+    stepper->SetMaxiters(20);
+    stepper->SetAbsTolerances(1e-10);
+    stepper->SetStepControl(false);
+
+    int iterations = 0;
+    for (int step = 0; step < num_steps; step++) {
+        system.DoStepDynamics(time_step);
+        if (auto gmres = std::dynamic_pointer_cast<ChSolverGMRES>(system.GetSolver()))
+            iterations += gmres->GetTotalIterations();
+    }
+
+    // In matrix-free mode, the element Jacobians are computed at most once per load
+    if (matrix_free) {
+        for (auto element : mesh->GetElements()) {
+            int num_evaluations = std::static_pointer_cast<CountingCable>(element)->num_evaluations;
+            if (num_evaluations == 0 || num_evaluations > mesh->GetNumCallsJacobianLoad()) {
+                GetLog() << "Element Jacobian computed " << num_evaluations << " times for "
+                         << mesh->GetNumCallsJacobianLoad() << " loads\n";
+                passed = false;
+                break;
+            }
+        }
+    }
+
+    // In matrix-free mode, the element Jacobians must not be accessible
+    for (auto element : mesh->GetElements()) {
+        auto cable = std::static_pointer_cast<ChElementCableANCF>(element);
+        if ((cable->Kstiffness().Get_K() == nullptr) != matrix_free) {
+            GetLog() << "Wrong storage of the element Jacobians\n";
+            passed = false;
+            break;
+        }
+    }
+
+    // A copy of a block does not refer to the provider of the original; a copied element provides its own
+    auto cable = std::static_pointer_cast<ChElementCableANCF>(mesh->GetElement(0));
+    ChKblockGeneric block(cable->Kstiffness());
+    ChElementCableANCF copy(*cable);
+    if (block.IsMatrixFree() || block.Get_K() == nullptr || copy.IsMatrixFree() != matrix_free ||
+        (matrix_free && copy.Kstiffness().GetMatrixProvider() == cable->Kstiffness().GetMatrixProvider())) {
+        GetLog() << "Matrix provider copied with the element Jacobian\n";
+        passed = false;
+    }
+
+    // The GMRES solver returns the norm of the final residual
+    if (auto gmres = std::dynamic_pointer_cast<ChSolverGMRES>(system.GetSolver())) {
+        double residual = gmres->Solve(*system.GetSystemDescriptor());
+        if (residual != gmres->GetResidual() || residual > 1e-6) {
+            GetLog() << "Wrong residual returned by GMRES: " << residual << "\n";
+            passed = false;
+        }
+    }
+
+    GetLog() << "Solver type: " << (int)solver_type << "  matrix free: " << matrix_free
+             << "  preconditioner: " << (int)preconditioner << "  GMRES iterations: " << iterations
+             << "  tip height: " << nodes.back()->GetPos().y() << "\n";
+
+    std::vector<ChVector<>> positions;
+    for (auto node : nodes)
+        positions.push_back(node->GetPos());
+    return positions;
+}
+
+// Return the largest distance between the positions of corresponding nodes.
+double MaxDifference(const std::vector<ChVector<>>& pos1, const std::vector<ChVector<>>& pos2) {
+    double max_diff = 0;
+    for (size_t i = 0; i < pos1.size(); i++)
+        max_diff = std::max(max_diff, (pos1[i] - pos2[i]).Length());
+    return max_diff;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    auto ref = Simulate(ChSolver::Type::MINRES, false, ChSolverGMRES::Preconditioner::DIAGONAL, passed);
+    auto stored = Simulate(ChSolver::Type::GMRES, false, ChSolverGMRES::Preconditioner::DIAGONAL, passed);
+    auto free_diag = Simulate(ChSolver::Type::GMRES, true, ChSolverGMRES::Preconditioner::DIAGONAL, passed);
+    auto free_block = Simulate(ChSolver::Type::GMRES, true, ChSolverGMRES::Preconditioner::BLOCK_JACOBI, passed);
+
+    // The cable must have fallen
+    if (ref.back().y() > -1e-3) {
+        GetLog() << "The cable did not move\n";
+        passed = false;
+    }
+
+    double diff_stored = MaxDifference(stored, ref);
+    double diff_free = MaxDifference(free_diag, stored);
+    double diff_block = MaxDifference(free_block, stored);
+
+    GetLog() << "Max. difference GMRES / MINRES:                  " << diff_stored << "\n";
+    GetLog() << "Max. difference matrix-free / stored (diagonal): " << diff_free << "\n";
+    GetLog() << "Max. difference matrix-free / stored (block):    " << diff_block << "\n";
+
+    if (diff_stored > 1e-6 || diff_free > 1e-8 || diff_block > 1e-8) {
+        GetLog() << "Different motion with the matrix-free GMRES solver\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel load of the internal and gravity forces of a mesh.
+// The elements of an ANCF cable are colored so that elements of the same color
+// do not share nodes. The residual loaded with several threads must be identical
+// to the one loaded with a single thread.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono_fea/ChElementCableANCF.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int num_elements = 40;  // number of cable elements
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mesh = std::make_shared<ChMesh>();
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+
+    // Nodes along a deformed (curved) line, so that internal forces are not zero
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        double x = i * 0.05;
+        auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(x, 0.1 * std::sin(3 * x), 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+
+    // Add the elements in non-sequential order
+    for (int k = 0; k < 3; k++) {
+        for (int i = k; i < num_elements; i += 3) {
+            auto element = std::make_shared<ChElementCableANCF>();
+            element->SetNodes(nodes[i], nodes[i + 1]);
+            element->SetSection(section);
+            mesh->AddElement(element);
+        }
+    }
+    system.Add(mesh);
+
+    system.SetupInitial();
+    system.Setup();
+    system.Update();
+
+    // Check the coloring: with the elements added in this order, the greedy coloring
+    // must use 3 colors (each element of the last group touches elements of the first two).
+    GetLog() << "Number of element colors: " << mesh->GetNumElementColors() << "\n";
+    if (mesh->GetNumElementColors() != 3) {
+        GetLog() << "Wrong number of colors\n";
+        passed = false;
+    }
+
+    // Load the residual with 1 thread, then with 4 threads
+    ChVectorDynamic<> R1(system.GetNcoords_w());
+    ChVectorDynamic<> R4(system.GetNcoords_w());
+
+    CHOMPfunctions::SetNumThreads(1);
+    mesh->IntLoadResidual_F(0, R1, 1.0);
+
+    CHOMPfunctions::SetNumThreads(4);
+    for (int k = 0; k < 10; k++) {
+        R4.Reset();
+        mesh->IntLoadResidual_F(0, R4, 1.0);
+
+        double max_diff = 0;
+        for (int i = 0; i < R1.GetRows(); i++)
+            max_diff = std::max(max_diff, std::abs(R4(i) - R1(i)));
+        if (max_diff > 0) {
+            GetLog() << "Different residual with 4 threads (max. difference: " << max_diff << ")\n";
+            passed = false;
+            break;
+        }
+    }
+
+    GetLog() << "Residual norm: " << R1.NormTwo() << "\n";
+    if (R1.NormTwo() == 0) {
+        GetLog() << "Zero residual\n";
+        passed = false;
+    }
+
+    // The gravity loads must not keep the elements alive once they are removed from the mesh
+    std::vector<std::weak_ptr<ChElementBase>> elements;
+    for (unsigned int i = 0; i < mesh->GetNelements(); i++)
+        elements.push_back(mesh->GetElement(i));
+    mesh->ClearElements();
+    for (auto& element : elements) {
+        if (!element.expired()) {
+            GetLog() << "Element kept alive by the gravity loads\n";
+            passed = false;
+            break;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
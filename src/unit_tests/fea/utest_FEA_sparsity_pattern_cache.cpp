@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the incremental assembly of the system matrix with the sparsity
+// pattern cache of ChSystemDescriptor.
+// An ANCF cable pinned to ground and a pendulum are simulated; at each step the
+// system matrix assembled in the cached pattern must be identical to the one
+// assembled from scratch. Adding a body half way through changes the pattern,
+// which must then be rebuilt.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/core/ChCSR3Matrix.h"
+#include "chrono/core/ChLinkedListMatrix.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono_fea/ChElementCableANCF.h"
+#include "chrono_fea/ChLinkPointFrame.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int num_steps = 20;       // number of simulation steps
+double time_step = 1e-3;  // integration step size
+int num_elements = 6;     // number of cable elements
+
+// Add a body hinged to ground.
+void AddPendulum(ChSystem& system, std::shared_ptr<ChBody> ground, double x) {
+    auto pendulum = std::make_shared<ChBody>();
+    pendulum->SetPos(ChVector<>(x, -0.5, 0));
+    pendulum->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    system.AddBody(pendulum);
+
+    auto hinge = std::make_shared<ChLinkLockRevolute>();
+    hinge->Initialize(ground, pendulum, ChCoordsys<>(ChVector<>(x, 0, 0), QUNIT));
+    system.AddLink(hinge);
+}
+
+// Check that the two matrices have the same size and elements.
+bool Equal(const ChSparseMatrix& A, const ChSparseMatrix& B) {
+    if (A.GetNumRows() != B.GetNumRows() || A.GetNumColumns() != B.GetNumColumns())
+        return false;
+    for (int i = 0; i < A.GetNumRows(); i++) {
+        for (int j = 0; j < A.GetNumColumns(); j++) {
+            if (A.GetElement(i, j) != B.GetElement(i, j)) {
+                GetLog() << "Element (" << i << ", " << j << ") differs: " << A.GetElement(i, j) << "  vs.  "
+                         << B.GetElement(i, j) << "\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystem system;
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    // ANCF cable along X, pinned to ground at its first node
+    auto mesh = std::make_shared<ChMesh>();
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(i * 0.1, 0, 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = std::make_shared<ChElementCableANCF>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetSection(section);
+        mesh->AddElement(element);
+    }
+    system.Add(mesh);
+
+    auto pin = std::make_shared<ChLinkPointFrame>();
+    pin->Initialize(nodes[0], ground);
+    system.Add(pin);
+
+    AddPendulum(system, ground, -1);
+
+    system.SetupInitial();
+
+    system.SetSolverType(ChSolver::Type::MINRES);
+    system.SetMaxItersSolverSpeed(100);
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto descriptor = system.GetSystemDescriptor();
+    descriptor->SetUseSparsityPatternCache(true);
+
+    ChCSR3Matrix Z;
+    bool passed = true;
+    int num_rebuilds = 0;
+
+    for (int step = 0; step < num_steps; step++) {
+        if (step == num_steps / 2)
+            AddPendulum(system, ground, -2);
+
+        system.DoStepDynamics(time_step);
+
+        // Assemble the matrix of the last step in the cached pattern and from scratch
+        ChLinkedListMatrix Zref;
+        descriptor->ConvertToMatrixForm(&Z, nullptr);
+        descriptor->ConvertToMatrixForm(&Zref, nullptr);
+
+        if (!Equal(Z, Zref)) {
+            GetLog() << "Assembled matrices differ at step " << step << "\n";
+            passed = false;
+            break;
+        }
+
+        // The pattern must be rebuilt at the first step and when the pendulum is added
+        num_rebuilds += (step == 0 || step == num_steps / 2);
+        if (descriptor->GetSparsityPatternCache().GetNumRebuilds() != num_rebuilds) {
+            GetLog() << "Unexpected rebuild of the sparsity pattern at step " << step << "\n";
+            passed = false;
+            break;
+        }
+    }
+
+    const ChSparsityPatternCache& cache = descriptor->GetSparsityPatternCache();
+    GetLog() << "Matrix size: " << Z.GetNumRows() << "  nnz: " << Z.GetNNZ() << "\n";
+    GetLog() << "Pattern rebuilds: " << cache.GetNumRebuilds() << "  updates: " << cache.GetNumUpdates() << "\n";
+    passed &= cache.GetNumUpdates() == num_steps - 2;
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
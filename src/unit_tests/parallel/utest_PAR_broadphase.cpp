@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the broadphase algorithms.
+// A layer of small spheres rests on a large container, with a few large boxes
+// among them.
+// - the contacts found with the hierarchical grid must be the same as those
+//   found with a single grid level, with fewer AABB-bin intersections.
+// - after a few steps with moving spheres, the contacts found by the
+//   incremental sweep and prune must be the same as those found by the grid.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+void CreateBodies(ChSystemParallel& system) {
+    system.Set_G_acc(ChVector<>(0, 0, 0));
+    system.GetSettings()->collision.collision_envelope = 0.01;
+    system.GetSettings()->collision.bins_per_axis = vec3(40, 40, 10);
+    system.GetSettings()->solver.max_iteration_sliding = 10;
+
+    auto material = std::make_shared<ChMaterialSurface>();
+
+    // Large container
+    utils::CreateBoxContainer(&system, 0, material, ChVector<>(5, 5, 1), 0.1, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+
+    // Layer of small spheres, with a few large boxes among them
+    double radius = 0.1;
+    int id = 1;
+    for (int ix = -20; ix <= 20; ix++) {
+        for (int iy = -20; iy <= 20; iy++) {
+            auto body = std::shared_ptr<ChBody>(system.NewBody());
+            body->SetIdentifier(id++);
+            body->SetMaterialSurface(material);
+            body->SetCollide(true);
+            body->GetCollisionModel()->ClearModel();
+            if (ix % 10 == 0 && iy % 10 == 0) {
+                body->SetPos(ChVector<>(0.2 * ix, 0.2 * iy, 0.5 - 0.01));
+                utils::AddBoxGeometry(body.get(), ChVector<>(0.5, 0.5, 0.5));
+            } else {
+                body->SetPos(ChVector<>(0.2 * ix, 0.2 * iy, radius - 0.01));
+                body->SetPos_dt(ChVector<>(0.1 * ((ix + iy) % 3 - 1), 0.1 * ((ix * iy) % 3 - 1), 0));
+                utils::AddSphereGeometry(body.get(), radius);
+            }
+            body->GetCollisionModel()->BuildModel();
+            system.AddBody(body);
+        }
+    }
+}
+
+// Return the sorted contact pairs of the last collision detection.
+std::vector<long long> GetContacts(ChSystemParallel& system) {
+    std::vector<long long> pairs(system.data_manager->host_data.contact_pairs.begin(),
+                                 system.data_manager->host_data.contact_pairs.end());
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+// Run one step with the given maximum number of grid levels and return the sorted contact pairs.
+std::vector<long long> FindContacts(unsigned int max_grid_levels, unsigned int& num_bin_intersections) {
+    ChSystemParallelDVI system;
+    CreateBodies(system);
+    system.GetSettings()->collision.max_grid_levels = max_grid_levels;
+
+    system.DoStepDynamics(1e-3);
+
+    num_bin_intersections = system.data_manager->measures.collision.number_of_bin_intersections;
+    std::cout << "Grid levels: " << system.data_manager->measures.collision.number_of_grid_levels
+              << "  bin intersections: " << num_bin_intersections
+              << "  contacts: " << system.data_manager->host_data.contact_pairs.size() << std::endl;
+
+    return GetContacts(system);
+}
+
+// Run a few steps with sweep and prune, then compare its contacts with those of the grid.
+bool TestSweepAndPrune() {
+    ChSystemParallelDVI system;
+    CreateBodies(system);
+    system.GetSettings()->collision.broadphase_type = BroadphaseType::BROADPHASE_SAP;
+
+    for (int i = 0; i < 20; i++)
+        system.DoStepDynamics(1e-2);
+
+    system.GetCollisionSystem()->Run();
+    std::vector<long long> pairs_sap = GetContacts(system);
+    const auto& broadphase = system.data_manager->broadphase;
+    std::cout << "SAP contacts: " << pairs_sap.size() << "  pairs added: " << broadphase->GetPairsAdded().size()
+              << "  removed: " << broadphase->GetPairsRemoved().size() << std::endl;
+
+    system.GetSettings()->collision.broadphase_type = BroadphaseType::BROADPHASE_GRID;
+    system.GetCollisionSystem()->Run();
+    std::vector<long long> pairs_grid = GetContacts(system);
+
+    if (pairs_sap.empty() || pairs_sap != pairs_grid) {
+        std::cout << "Different contacts with sweep and prune" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned int num_bin_intersections_1;
+    unsigned int num_bin_intersections_4;
+    std::vector<long long> pairs_1 = FindContacts(1, num_bin_intersections_1);
+    std::vector<long long> pairs_4 = FindContacts(4, num_bin_intersections_4);
+
+    bool passed = true;
+    if (pairs_1.empty() || pairs_1 != pairs_4) {
+        std::cout << "Different contacts with the multi-level grid" << std::endl;
+        passed = false;
+    }
+    if (num_bin_intersections_4 >= num_bin_intersections_1) {
+        std::cout << "Bin intersections not reduced" << std::endl;
+        passed = false;
+    }
+    passed &= TestSweepAndPrune();
+
+    std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
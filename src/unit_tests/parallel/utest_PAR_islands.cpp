@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the per-island solve of the parallel DVI solver.
+// Separate columns of stacked spheres rest on a fixed ground: each column is an
+// island (the ground does not connect them). The positions of the spheres must
+// be the same whether the islands are solved separately or all together.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+int num_columns = 4;    // columns per side of the grid
+int num_stacked = 2;    // spheres per column
+double radius = 0.1;    // sphere radius
+double spacing = 0.5;   // distance between columns
+
+// Simulate the columns and return the final positions of the spheres.
+std::vector<ChVector<>> Simulate(bool solve_islands, unsigned int& num_islands) {
+    ChSystemParallelDVI system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.GetSettings()->collision.collision_envelope = 0.01;
+    system.GetSettings()->collision.bins_per_axis = vec3(4, 4, 1);
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 200;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.GetSettings()->solver.tolerance = 1e-5;
+    system.GetSettings()->solver.solve_islands = solve_islands;
+    system.ChangeSolverType(SolverType::APGD);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.4f);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetIdentifier(-1);
+    ground->SetBodyFixed(true);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetMaterialSurface(material);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), ChVector<>(2, 2, 0.1));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int ix = 0; ix < num_columns; ix++) {
+        for (int iy = 0; iy < num_columns; iy++) {
+            for (int iz = 0; iz < num_stacked; iz++) {
+                // Slightly offset spheres, so that the columns settle differently
+                double offset = 0.01 * radius * (ix - iy) * (iz + 1);
+                auto sphere = std::shared_ptr<ChBody>(system.NewBody());
+                sphere->SetIdentifier((int)spheres.size());
+                sphere->SetMass(1);
+                sphere->SetInertiaXX(ChVector<>(0.4 * radius * radius));
+                sphere->SetPos(ChVector<>((ix - 1.5) * spacing + offset, (iy - 1.5) * spacing,
+                                          radius + iz * 2.05 * radius));
+                sphere->SetMaterialSurface(material);
+                sphere->SetCollide(true);
+                sphere->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(sphere.get(), radius);
+                sphere->GetCollisionModel()->BuildModel();
+                system.AddBody(sphere);
+                spheres.push_back(sphere);
+            }
+        }
+    }
+
+    for (int i = 0; i < 200; i++) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    num_islands = system.data_manager->measures.solver.number_of_islands;
+    std::cout << "Solve islands: " << solve_islands << "  islands: " << num_islands
+              << "  contacts: " << system.GetNumContacts() << std::endl;
+
+    std::vector<ChVector<>> positions;
+    for (auto& sphere : spheres)
+        positions.push_back(sphere->GetPos());
+    return positions;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    unsigned int num_islands;
+
+    std::vector<ChVector<>> pos_global = Simulate(false, num_islands);
+    if (num_islands != 0) {
+        std::cout << "Islands computed without per-island solve" << std::endl;
+        passed = false;
+    }
+
+    std::vector<ChVector<>> pos_islands = Simulate(true, num_islands);
+    if (num_islands != num_columns * num_columns) {
+        std::cout << "Wrong number of islands" << std::endl;
+        passed = false;
+    }
+
+    double max_diff = 0;
+    for (size_t i = 0; i < pos_global.size(); i++)
+        max_diff = std::max(max_diff, (pos_islands[i] - pos_global[i]).Length());
+    std::cout << "Max. position difference: " << max_diff << std::endl;
+    if (max_diff > 1e-3) {
+        std::cout << "Different positions with per-island solve" << std::endl;
+        passed = false;
+    }
+
+    std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the reduction and reuse of contact manifolds.
+// A box rests on a ground made of a fine triangle mesh, with one contact per
+// triangle under the box.
+// - with manifold reduction, at most 4 contacts must be kept between the box
+//   and the ground, and the box must stay at rest.
+// - with manifold reuse, the contacts of the resting box must be reused.
+//
+// =============================================================================
+
+#include <cmath>
+#include <iostream>
+
+#include "chrono/ChConfig.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Simulate the box on the mesh and return the number of contacts at the last step.
+unsigned int Simulate(unsigned int max_manifold_points,
+                      double manifold_tolerance,
+                      int num_steps,
+                      unsigned int& num_reused,
+                      double& height) {
+    ChSystemParallelDVI system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.GetSettings()->collision.collision_envelope = 0.01;
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 10, 2);
+    system.GetSettings()->collision.max_manifold_points = max_manifold_points;
+    system.GetSettings()->collision.manifold_tolerance = manifold_tolerance;
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 100;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.ChangeSolverType(SolverType::APGD);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.5f);
+
+    // Ground mesh, with cells of size 0.1
+    geometry::ChTriangleMeshSoup trimesh;
+    for (int ix = -10; ix < 10; ix++) {
+        for (int iy = -10; iy < 10; iy++) {
+            ChVector<> v0(0.1 * ix, 0.1 * iy, 0);
+            ChVector<> v1(0.1 * (ix + 1), 0.1 * iy, 0);
+            ChVector<> v2(0.1 * (ix + 1), 0.1 * (iy + 1), 0);
+            ChVector<> v3(0.1 * ix, 0.1 * (iy + 1), 0);
+            trimesh.addTriangle(v0, v1, v2);
+            trimesh.addTriangle(v0, v2, v3);
+        }
+    }
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetIdentifier(0);
+    ground->SetBodyFixed(true);
+    ground->SetMaterialSurface(material);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(trimesh, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    auto box = std::shared_ptr<ChBody>(system.NewBody());
+    box->SetIdentifier(1);
+    box->SetMass(1);
+    box->SetPos(ChVector<>(0.05, 0.05, 0.3));
+    box->SetMaterialSurface(material);
+    box->SetCollide(true);
+    box->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(box.get(), ChVector<>(0.3, 0.3, 0.3));
+    box->GetCollisionModel()->BuildModel();
+    system.AddBody(box);
+
+    for (int i = 0; i < num_steps; i++) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    num_reused = system.data_manager->measures.collision.number_of_manifolds_reused;
+    height = box->GetPos().z();
+    unsigned int num_contacts = system.GetNumContacts();
+    std::cout << "Max. points: " << max_manifold_points << "  tolerance: " << manifold_tolerance
+              << "  contacts: " << num_contacts << "  reused: " << num_reused
+              << "  reduced: " << system.data_manager->measures.collision.number_of_contacts_reduced
+              << "  height: " << height << std::endl;
+    return num_contacts;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    unsigned int num_reused;
+    double height;
+
+    // All contacts
+    unsigned int num_contacts = Simulate(0, 0, 1, num_reused, height);
+    if (num_contacts <= 4) {
+        std::cout << "Too few contacts with the mesh" << std::endl;
+        passed = false;
+    }
+
+    // Reduced manifold: the box must still rest on the ground
+    num_contacts = Simulate(4, 0, 200, num_reused, height);
+    if (num_contacts == 0 || num_contacts > 4 || std::abs(height - 0.3) > 0.02) {
+        std::cout << "Wrong reduced manifold" << std::endl;
+        passed = false;
+    }
+
+    // Reused manifold
+    unsigned int num_contacts_reused = Simulate(4, 1e-3, 200, num_reused, height);
+    if (num_reused == 0 || num_contacts_reused != num_contacts || std::abs(height - 0.3) > 0.02) {
+        std::cout << "Manifold not reused" << std::endl;
+        passed = false;
+    }
+
+    std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
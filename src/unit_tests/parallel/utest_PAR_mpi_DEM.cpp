@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the distributed DEM system (run with several MPI ranks).
+// Spheres roll on a fixed ground, across the boundaries of the subdomains, and
+// collide with each other and with a movable box replicated on all ranks. The
+// final positions must match those of the same system run on a single rank
+// (on MPI_COMM_SELF), the number of bodies must be conserved, and some bodies
+// must have migrated.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallelDEMMPI.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+int num_spheres = 8;       // number of spheres
+double radius = 0.05;     // sphere radius
+double time_end = 0.5;    // simulation length
+double time_step = 1e-4;  // integration step size
+
+std::shared_ptr<ChBody> CreateBody(ChSystemParallelDEMMPI& system, int id, const ChVector<>& pos) {
+    auto material = std::make_shared<ChMaterialSurfaceDEM>();
+    material->SetYoungModulus(1e7f);
+    material->SetFriction(0.3f);
+    material->SetRestitution(0.5f);
+
+    auto body = std::shared_ptr<ChBody>(system.NewBody());
+    body->SetIdentifier(id);
+    body->SetPos(pos);
+    body->SetMaterialSurface(material);
+    body->SetCollide(true);
+    return body;
+}
+
+// Simulate the system and return the final positions of the bodies owned by this rank, by identifier
+// (the box has identifier num_spheres, the spheres are 0 to num_spheres - 1).
+std::vector<std::pair<int, ChVector<>>> Simulate(MPI_Comm comm, int& num_migrated, bool& conserved) {
+    ChSystemParallelDEMMPI system(comm);
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.SetDomain(-1, 1, 0);
+    system.SetGhostLayer(4 * radius);
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 2, 2);
+
+    auto ground = CreateBody(system, -1, ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), ChVector<>(2, 1, 0.1));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBodyGlobal(ground);
+
+    // Movable box across the boundary between ranks 0 and 1, in its own collision family
+    auto box = CreateBody(system, num_spheres, ChVector<>(0.05, 0, 0.1));
+    box->SetMass(10);
+    box->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    box->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(box.get(), ChVector<>(0.1, 0.3, 0.1));
+    box->GetCollisionModel()->SetFamily(1);
+    box->GetCollisionModel()->BuildModel();
+    system.AddBodyGlobal(box);
+
+    // Spheres thrown towards the box from both sides
+    std::vector<int> initial_rank(num_spheres);
+    for (int i = 0; i < num_spheres; i++) {
+        double side = (i % 2 == 0) ? -1 : 1;
+        ChVector<> pos(side * (0.25 + 0.12 * (i / 2)), 0.02 * i - 0.08, radius);
+        auto sphere = CreateBody(system, i, pos);
+        sphere->SetMass(1);
+        sphere->SetInertiaXX(ChVector<>(0.4 * radius * radius));
+        sphere->SetPos_dt(ChVector<>(-side * (1.0 + 0.2 * i), 0, 0));
+        sphere->GetCollisionModel()->ClearModel();
+        utils::AddSphereGeometry(sphere.get(), radius);
+        sphere->GetCollisionModel()->BuildModel();
+        system.AddBody(sphere);
+        initial_rank[i] = system.GetOwnerRank(pos);
+    }
+
+    conserved = true;
+    while (system.GetChTime() < time_end) {
+        system.DoStepDynamics(time_step);
+        if (system.GetNumOwnedBodiesGlobal() != num_spheres)
+            conserved = false;
+    }
+
+    std::vector<std::pair<int, ChVector<>>> positions;
+    int migrated = 0;
+    for (auto& entry : system.GetOwnedBodies()) {
+        positions.push_back(std::make_pair(entry.first, entry.second->GetPos()));
+        migrated += (initial_rank[entry.first] != system.GetRank());
+    }
+    if (system.GetRank() == 0)
+        positions.push_back(std::make_pair(num_spheres, box->GetPos()));
+    MPI_Allreduce(&migrated, &num_migrated, 1, MPI_INT, MPI_SUM, comm);
+
+    return positions;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int rank, num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    bool passed = true;
+    int num_migrated;
+    bool conserved;
+
+    // Reference solution, computed on each rank
+    std::vector<std::pair<int, ChVector<>>> reference = Simulate(MPI_COMM_SELF, num_migrated, conserved);
+    std::vector<ChVector<>> ref_pos(num_spheres + 1);
+    for (auto& entry : reference)
+        ref_pos[entry.first] = entry.second;
+
+    // Distributed solution
+    std::vector<std::pair<int, ChVector<>>> distributed = Simulate(MPI_COMM_WORLD, num_migrated, conserved);
+    double local_diff = 0;
+    for (auto& entry : distributed)
+        local_diff = std::max(local_diff, (entry.second - ref_pos[entry.first]).Length());
+    double max_diff = 0;
+    MPI_Allreduce(&local_diff, &max_diff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        std::cout << "Ranks: " << num_ranks << "  migrated: " << num_migrated << "  max. position difference: "
+                  << max_diff << std::endl;
+        if (!conserved) {
+            std::cout << "Number of bodies not conserved" << std::endl;
+            passed = false;
+        }
+        if (num_ranks > 1 && num_migrated == 0) {
+            std::cout << "No body migrated" << std::endl;
+            passed = false;
+        }
+        if (max_diff > 1e-5) {
+            std::cout << "Different positions with the distributed system" << std::endl;
+            passed = false;
+        }
+        std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+    }
+
+    int status = !passed;
+    MPI_Bcast(&status, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Finalize();
+
+    // Return 0 if all tests passed.
+    return status;
+}
@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the Morton reordering of bodies.
+// Balls, added in a scattered order, fall in a container (DEM, with contact
+// history). The simulation with the bodies reordered at every step must give
+// the same results as the one without reordering, and GetBodyIndex must find
+// the bodies in the order they were added.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Simulate the falling balls and return their final positions, in the order they were added.
+std::vector<ChVector<>> Simulate(int reorder_interval, bool& ids_ok) {
+    ChSystemParallelDEM system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.GetSettings()->solver.tangential_displ_mode = ChSystemDEM::MultiStep;
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    system.GetSettings()->reorder_interval = reorder_interval;
+
+    auto material = std::make_shared<ChMaterialSurfaceDEM>();
+    material->SetYoungModulus(1e7f);
+    material->SetFriction(0.4f);
+
+    utils::CreateBoxContainer(&system, 0, material, ChVector<>(2, 2, 1), 0.1, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+
+    // Balls are added in a scattered order, so that the reordering is not trivial
+    double radius = 0.1;
+    int n = 8;
+    for (int i = 0; i < n * n * 2; i++) {
+        int j = (i * 37) % (n * n * 2);
+        auto ball = std::shared_ptr<ChBody>(system.NewBody());
+        ball->SetIdentifier(i + 1);
+        ball->SetMass(1);
+        ball->SetInertiaXX(0.4 * radius * radius * ChVector<>(1, 1, 1));
+        ball->SetPos(ChVector<>(-1.5 + 0.4 * (j % n) + 0.01 * (j / n), -1.5 + 0.4 * ((j / n) % n),
+                                0.2 + 0.21 * (j / (n * n))));
+        ball->SetMaterialSurface(material);
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        utils::AddSphereGeometry(ball.get(), radius);
+        ball->GetCollisionModel()->BuildModel();
+        system.AddBody(ball);
+    }
+
+    while (system.GetChTime() < 0.2) {
+        system.DoStepDynamics(1e-4);
+    }
+
+    std::cout << "Reorder interval: " << reorder_interval << "  contacts: " << system.GetNumContacts() << std::endl;
+
+    // The container was added first
+    auto bodies = system.Get_bodylist();
+    ids_ok = true;
+    std::vector<ChVector<>> pos;
+    for (int i = 1; i < (int)bodies->size(); i++) {
+        auto body = (*bodies)[system.GetBodyIndex(i)];
+        ids_ok &= (body->GetIdentifier() == i) && (body->GetId() == system.GetBodyIndex(i));
+        pos.push_back(body->GetPos());
+    }
+    return pos;
+}
+
+int main(int argc, char* argv[]) {
+    bool ids_ok0, ids_ok1;
+    std::vector<ChVector<>> pos0 = Simulate(0, ids_ok0);
+    std::vector<ChVector<>> pos1 = Simulate(1, ids_ok1);
+
+    bool passed = ids_ok0 && ids_ok1;
+    if (!passed)
+        std::cout << "Bodies not found by insertion index" << std::endl;
+
+    double max_diff = 0;
+    for (size_t i = 0; i < pos0.size(); i++)
+        max_diff = std::max(max_diff, (pos0[i] - pos1[i]).Length());
+    std::cout << "Max. position difference: " << max_diff << std::endl;
+    if (max_diff > 1e-6)
+        passed = false;
+
+    std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the single precision Schur products of the parallel DVI solver.
+// Boxes stacked on a fixed ground, one of them linked to the ground by a
+// spherical joint, are simulated with the solver products computed in double
+// and in single precision: the positions of the boxes must agree, in all the
+// solver modes (which use different sets of constraint rows).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+int num_stacked = 3;  // boxes in the stack
+double size = 0.2;    // box size
+
+// Simulate the stack and return the final positions of the boxes.
+std::vector<ChVector<>> Simulate(bool use_single_precision, SolverMode mode) {
+    ChSystemParallelDVI system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.GetSettings()->collision.collision_envelope = 0.01;
+    system.GetSettings()->collision.bins_per_axis = vec3(2, 2, 2);
+    system.GetSettings()->solver.solver_mode = mode;
+    system.GetSettings()->solver.max_iteration_normal = 20;
+    system.GetSettings()->solver.max_iteration_sliding = (mode == SolverMode::NORMAL) ? 0 : 50;
+    system.GetSettings()->solver.max_iteration_spinning = (mode == SolverMode::SPINNING) ? 50 : 0;
+    system.GetSettings()->solver.max_iteration_bilateral = 20;
+    system.GetSettings()->solver.tolerance = 1e-5;
+    system.GetSettings()->solver.use_single_precision = use_single_precision;
+    system.ChangeSolverType(SolverType::APGD);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.4f);
+    material->SetRollingFriction(0.01f);
+    material->SetSpinningFriction(0.01f);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetIdentifier(-1);
+    ground->SetBodyFixed(true);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetMaterialSurface(material);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), ChVector<>(1, 1, 0.1));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> boxes;
+    for (int i = 0; i < num_stacked; i++) {
+        auto box = std::shared_ptr<ChBody>(system.NewBody());
+        box->SetIdentifier(i);
+        box->SetMass(1);
+        box->SetInertiaXX(ChVector<>(size * size / 6));
+        box->SetPos(ChVector<>(0.01 * i, 0, (i + 0.5) * size));
+        box->SetMaterialSurface(material);
+        box->SetCollide(true);
+        box->GetCollisionModel()->ClearModel();
+        utils::AddBoxGeometry(box.get(), ChVector<>(size / 2));
+        box->GetCollisionModel()->BuildModel();
+        system.AddBody(box);
+        boxes.push_back(box);
+    }
+
+    // Pendulum hanging from the ground, next to the stack
+    auto bob = std::shared_ptr<ChBody>(system.NewBody());
+    bob->SetIdentifier(num_stacked);
+    bob->SetMass(1);
+    bob->SetPos(ChVector<>(0.6, 0, 0.5));
+    system.AddBody(bob);
+    boxes.push_back(bob);
+
+    auto joint = std::make_shared<ChLinkLockSpherical>();
+    joint->Initialize(ground, bob, ChCoordsys<>(ChVector<>(0.5, 0, 0.5), QUNIT));
+    system.AddLink(joint);
+
+    for (int i = 0; i < 100; i++) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    std::vector<ChVector<>> positions;
+    for (auto& box : boxes)
+        positions.push_back(box->GetPos());
+    return positions;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    SolverMode modes[] = {SolverMode::NORMAL, SolverMode::SLIDING, SolverMode::SPINNING};
+    for (SolverMode mode : modes) {
+        std::vector<ChVector<>> pos_double = Simulate(false, mode);
+        std::vector<ChVector<>> pos_single = Simulate(true, mode);
+
+        double max_diff = 0;
+        for (size_t i = 0; i < pos_double.size(); i++)
+            max_diff = std::max(max_diff, (pos_single[i] - pos_double[i]).Length());
+        std::cout << "Solver mode: " << (int)mode << "  max. position difference: " << max_diff << std::endl;
+        if (max_diff > 1e-3) {
+            std::cout << "Different positions with single precision products" << std::endl;
+            passed = false;
+        }
+    }
+
+    std::cout << "Test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the structure-of-arrays body state store of ChAssembly.
+// Tumbling bodies with full inertia tensors, some of them hinged to ground and
+// some fixed, are simulated with and without the store, with a linearized and
+// a nonlinear (HHT) integrator. Results must be identical.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double end_time = 0.5;    // total simulation time
+double time_step = 1e-3;  // integration step size
+int num_bodies = 12;      // number of bodies
+
+// Run the simulation and return the final body coordinates and velocities.
+std::vector<double> Simulate(bool use_store, bool hht, int& num_stored) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetUseBodyStateStore(use_store);
+
+    if (hht) {
+        auto solver = std::make_shared<ChSolverMINRES>();
+        solver->SetMaxIterations(200);
+        solver->SetTolerance(1e-12);
+        system.SetSolver(solver);
+        system.SetTimestepperType(ChTimestepper::Type::HHT);
+        auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+        integrator->SetAlpha(-0.2);
+        integrator->SetMaxiters(20);
+        integrator->SetAbsTolerances(1e-8);
+    }
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetMass(1.0 + 0.1 * i);
+        body->SetInertiaXX(ChVector<>(0.1, 0.2 + 0.01 * i, 0.3));
+        body->SetInertiaXY(ChVector<>(0.01, -0.02, 0.005 * i));
+        body->SetPos(ChVector<>(i, 0.1 * i, 0));
+        body->SetRot(Q_from_AngAxis(0.1 * i, ChVector<>(1, 1, 0).GetNormalized()));
+        body->SetPos_dt(ChVector<>(0.1, 0.2, -0.1 * i));
+        body->SetWvel_loc(ChVector<>(1.0, -0.5 * i, 2.0));
+        body->SetBodyFixed(i % 5 == 4);
+        system.AddBody(body);
+
+        if (i % 3 == 0) {
+            auto hinge = std::make_shared<ChLinkLockRevolute>();
+            hinge->Initialize(ground, body, ChCoordsys<>(ChVector<>(i, 0.1 * i + 0.5, 0), QUNIT));
+            system.AddLink(hinge);
+        }
+
+        bodies.push_back(body);
+    }
+
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+    }
+    num_stored = system.GetBodyStateStore().GetNbodies();
+
+    std::vector<double> state;
+    for (auto& body : bodies) {
+        for (int k = 0; k < 3; k++) {
+            state.push_back(body->GetPos()[k]);
+            state.push_back(body->GetPos_dt()[k]);
+            state.push_back(body->GetWvel_loc()[k]);
+        }
+        for (int k = 0; k < 4; k++)
+            state.push_back(body->GetRot()[k]);
+    }
+    return state;
+}
+
+bool Compare(bool hht) {
+    int stored0, stored1;
+    auto state0 = Simulate(false, hht, stored0);
+    auto state1 = Simulate(true, hht, stored1);
+
+    GetLog() << (hht ? "HHT" : "Euler implicit linearized") << ": " << stored1 << " bodies in store\n";
+
+    if (stored0 != 0 || stored1 != num_bodies - num_bodies / 5) {
+        GetLog() << "Wrong number of bodies in store\n";
+        return false;
+    }
+
+    for (size_t i = 0; i < state0.size(); i++) {
+        if (state0[i] != state1[i]) {
+            GetLog() << "State differs at entry " << (int)i << ": " << state0[i] << "  vs.  " << state1[i] << "\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= Compare(false);
+    passed &= Compare(true);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched constraint kernels (ChConstraintBatch).
+// A pile of spheres in a box and a pendulum hinged to ground are simulated with
+// the SOR, APGD and Barzilai-Borwein solvers, with and without the constraint
+// batch. The batched [Cq]*q product is also checked against the per-constraint one.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double end_time = 0.2;    // total simulation time
+double time_step = 1e-3;  // integration step size
+double radius = 0.05;     // sphere radius
+
+// Run the simulation and return the final body positions.
+std::vector<ChVector<>> Simulate(ChSolver::Type solver_type, bool batched, bool& kernels_ok, int& num_batched) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetSolverType(solver_type);
+    system.SetMaxItersSolverSpeed(50);
+    system.GetSystemDescriptor()->SetUseConstraintBatch(batched);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.4f);
+
+    utils::CreateBoxContainer(&system, 0, material, ChVector<>(0.5, 0.5, 0.5), 0.05, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int iy = 0; iy < 2; iy++) {
+        for (int ix = 0; ix < 3; ix++) {
+            for (int iz = 0; iz < 3; iz++) {
+                double shift = (iy % 2) * 0.5 * radius;
+                auto ball = std::shared_ptr<ChBody>(system.NewBody());
+                ball->SetMass(1);
+                ball->SetInertiaXX(0.4 * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(ChVector<>((ix - 1) * 2.05 * radius + shift, (2 * iy + 1) * 1.05 * radius,
+                                        (iz - 1) * 2.05 * radius + shift));
+                ball->SetCollide(true);
+                ball->SetMaterialSurface(material);
+                ball->GetCollisionModel()->ClearModel();
+                ball->GetCollisionModel()->AddSphere(radius);
+                ball->GetCollisionModel()->BuildModel();
+                system.AddBody(ball);
+                bodies.push_back(ball);
+            }
+        }
+    }
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto pendulum = std::make_shared<ChBody>();
+    pendulum->SetPos(ChVector<>(2, 1, 0));
+    pendulum->SetWvel_loc(ChVector<>(0, 0, 1));
+    system.AddBody(pendulum);
+    bodies.push_back(pendulum);
+
+    auto hinge = std::make_shared<ChLinkLockRevolute>();
+    hinge->Initialize(ground, pendulum, ChCoordsys<>(ChVector<>(2.5, 1, 0), QUNIT));
+    system.AddLink(hinge);
+
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+    }
+
+    // Check the batched [Cq]*q against the per-constraint products, for the last step
+    auto descriptor = system.GetSystemDescriptor();
+    descriptor->SetUseConstraintBatch(true);
+    kernels_ok = descriptor->UpdateConstraintBatch();
+    const ChConstraintBatch& batch = descriptor->GetConstraintBatch();
+    num_batched = batch.GetNconstraints();
+    ChMatrixDynamic<> q;
+    descriptor->FromVariablesToVector(q, true);
+    std::vector<double> Cq_q(num_batched);
+    batch.Compute_Cq_q(q.GetAddress(), Cq_q.data());
+    for (int i = 0; i < num_batched; i++) {
+        double ref = batch.GetConstraint(i)->Compute_Cq_q();
+        if (std::abs(Cq_q[i] - ref) > 1e-12 * (1 + std::abs(ref)) ||
+            std::abs(batch.Compute_Cq_q(i, q.GetAddress()) - ref) > 1e-12 * (1 + std::abs(ref))) {
+            GetLog() << "Batched [Cq]*q differs for constraint " << i << ": " << Cq_q[i] << "  vs.  " << ref << "\n";
+            kernels_ok = false;
+            break;
+        }
+    }
+
+    std::vector<ChVector<>> pos;
+    for (auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+bool Compare(ChSolver::Type solver_type, const char* name, double tolerance) {
+    bool kernels_ok;
+    int num_batched;
+    auto pos0 = Simulate(solver_type, false, kernels_ok, num_batched);
+    auto pos1 = Simulate(solver_type, true, kernels_ok, num_batched);
+
+    GetLog() << name << ": " << num_batched << " batched constraints\n";
+
+    if (!kernels_ok || num_batched < 5 + 3) {
+        GetLog() << "Constraint batch not used\n";
+        return false;
+    }
+
+    for (size_t i = 0; i < pos0.size(); i++) {
+        if ((pos0[i] - pos1[i]).Length() > tolerance) {
+            GetLog() << "Body " << (int)i << " differs: " << pos0[i] << "  vs.  " << pos1[i] << "\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= Compare(ChSolver::Type::SOR, "SOR", 1e-9);
+    passed &= Compare(ChSolver::Type::APGD, "APGD", 1e-6);
+    passed &= Compare(ChSolver::Type::BARZILAIBORWEIN, "BB", 1e-6);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
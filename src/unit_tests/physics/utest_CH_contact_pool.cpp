@@ -0,0 +1,186 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the matching of persistent contacts in ChContactPool.
+// Contacts of the previous pass, reported again in any order and interleaved
+// with new contacts, must be matched to the same contact objects. Objects that
+// are not reused must release their contactables, and the pool must shrink to
+// the number of contacts of the last passes.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChContactPool.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+// Minimal contact type, recording the contactables it was last reset with.
+class TestContact {
+  public:
+    TestContact(ChContactContainerBase* container, int* objA, int* objB, const ChCollisionInfo& cinfo) {
+        Reset(objA, objB, cinfo);
+    }
+    void Reset(int* mobjA, int* mobjB, const ChCollisionInfo& cinfo) {
+        objA = mobjA;
+        objB = mobjB;
+    }
+    void ReleaseContactables() {
+        objA = nullptr;
+        objB = nullptr;
+    }
+    int* objA;
+    int* objB;
+};
+
+int objects[20];  // fake contactable objects (and collision models)
+
+// Contact between objects i and j.
+ChCollisionInfo Pair(int i, int j) {
+    ChCollisionInfo cinfo;
+    cinfo.modelA = reinterpret_cast<ChCollisionModel*>(&objects[i]);
+    cinfo.modelB = reinterpret_cast<ChCollisionModel*>(&objects[j]);
+    return cinfo;
+}
+
+// Add a contact between objects i and j, and return its object and whether it was matched.
+TestContact* Add(ChContactPool<TestContact>& pool, int i, int j, bool& matched) {
+    return pool.Add(nullptr, &objects[i], &objects[j], Pair(i, j), &matched);
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    ChContactPool<TestContact> pool(4);
+    pool.SetShrinkInterval(0);
+    bool matched;
+
+    // First pass: 5 contacts (pair (0,1) has two contacts)
+    int pairs[5][2] = {{0, 1}, {0, 1}, {2, 3}, {4, 5}, {6, 7}};
+    std::vector<TestContact*> persistent;
+    pool.BeginAdd();
+    for (int k = 0; k < 5; k++)
+        persistent.push_back(Add(pool, pairs[k][0], pairs[k][1], matched));
+
+    // Second pass: a new contact first, then the persistent ones
+    pool.BeginAdd();
+    Add(pool, 10, 11, matched);
+    if (matched) {
+        GetLog() << "New contact matched\n";
+        passed = false;
+    }
+    int num_matched = 0;
+    for (int k = 0; k < 5; k++) {
+        TestContact* mc = Add(pool, pairs[k][0], pairs[k][1], matched);
+        if (matched && mc == persistent[k])
+            num_matched++;
+    }
+    GetLog() << "New contact first: matched " << num_matched << " of 5\n";
+    if (num_matched != 5)
+        passed = false;
+
+    // Third pass: persistent contacts in a different order, interleaved with new contacts
+    pool.BeginAdd();
+    int order[5] = {3, 0, 4, 2, 1};
+    num_matched = 0;
+    int num_new_matched = 0;
+    for (int k = 0; k < 5; k++) {
+        Add(pool, 12 + k, 13 + k, matched);
+        if (matched)
+            num_new_matched++;
+        // Contacts of the same pair are identified by their order: (0,1) is reported in the same order
+        int p = order[k];
+        TestContact* mc = Add(pool, pairs[p][0], pairs[p][1], matched);
+        if (matched && mc == persistent[p])
+            num_matched++;
+    }
+    GetLog() << "Interleaved new contacts: matched " << num_matched << " of 5, new matched " << num_new_matched
+             << "\n";
+    if (num_matched != 5 || num_new_matched != 0)
+        passed = false;
+
+    // All active contacts must be distinct objects
+    for (int i = 0; i < pool.GetNadded(); i++) {
+        for (int j = i + 1; j < pool.GetNadded(); j++) {
+            if (pool[i] == pool[j]) {
+                GetLog() << "Same object used by two contacts\n";
+                passed = false;
+            }
+        }
+    }
+    if (pool.GetNadded() != 10) {
+        GetLog() << "Wrong number of contacts\n";
+        passed = false;
+    }
+    pool.EndAdd();
+
+    // Fourth pass: only two persistent contacts. The other objects must release their contactables.
+    pool.BeginAdd();
+    Add(pool, 2, 3, matched);
+    Add(pool, 6, 7, matched);
+    pool.EndAdd();
+    int capacity = pool.GetCapacity();
+    for (int j = pool.GetNadded(); j < capacity; j++) {
+        if (pool[j]->objA || pool[j]->objB) {
+            GetLog() << "Retired contact still references its contactables\n";
+            passed = false;
+            break;
+        }
+    }
+
+    // Shrink after 3 passes with the same two contacts
+    pool.SetShrinkInterval(3);
+    for (int k = 0; k < 3; k++) {
+        pool.BeginAdd();
+        TestContact* mc1 = Add(pool, 2, 3, matched);
+        TestContact* mc2 = Add(pool, 6, 7, matched);
+        if (mc1 != persistent[2] || mc2 != persistent[4]) {
+            GetLog() << "Persistent contact not matched before shrinking\n";
+            passed = false;
+        }
+        pool.EndAdd();
+    }
+    GetLog() << "Capacity: " << capacity << " before shrinking, " << pool.GetCapacity() << " after\n";
+    if (pool.GetCapacity() != 2)
+        passed = false;
+
+    // Grow again: surviving contacts are still matched, new objects are all distinct
+    pool.BeginAdd();
+    std::vector<TestContact*> active;
+    active.push_back(Add(pool, 6, 7, matched));
+    if (!matched || active.back() != persistent[4]) {
+        GetLog() << "Persistent contact not matched after shrinking\n";
+        passed = false;
+    }
+    for (int k = 0; k < 9; k++)
+        active.push_back(Add(pool, 12 + k, 13 + k, matched));
+    for (size_t i = 0; i < active.size(); i++) {
+        for (size_t j = i + 1; j < active.size(); j++) {
+            if (active[i] == active[j]) {
+                GetLog() << "Same object used by two contacts after shrinking\n";
+                passed = false;
+            }
+        }
+    }
+    pool.EndAdd();
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
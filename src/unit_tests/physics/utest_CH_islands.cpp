@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for island sleeping (ChSystem::SetUseSleeping).
+// A stack of boxes and a separate box come to rest on the ground and must be
+// put to sleep, in two different islands. A ball then falls on the stack: all
+// the boxes of the stack must wake up together, while the separate box keeps
+// sleeping. Bodies added after the partition must report no island.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double time_step = 2e-3;  // integration step size
+double size = 0.2;        // box size
+int num_stacked = 3;      // boxes in the stack
+
+std::shared_ptr<ChBody> AddBox(ChSystem& system, std::shared_ptr<ChMaterialSurface> material, const ChVector<>& pos) {
+    auto box = std::shared_ptr<ChBody>(system.NewBody());
+    box->SetMass(1);
+    box->SetInertiaXX(ChVector<>(1, 1, 1) * (size * size / 6));
+    box->SetPos(pos);
+    box->SetCollide(true);
+    box->SetMaterialSurface(material);
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(size / 2, size / 2, size / 2);
+    box->GetCollisionModel()->BuildModel();
+    system.AddBody(box);
+    return box;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetUseSleeping(true);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.6f);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetPos(ChVector<>(0, -0.1, 0));
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(2, 0.1, 2);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> stack;
+    for (int i = 0; i < num_stacked; i++)
+        stack.push_back(AddBox(system, material, ChVector<>(-0.5, (i + 0.5) * size, 0)));
+    auto single = AddBox(system, material, ChVector<>(0.5, 0.5 * size, 0));
+
+    bool passed = true;
+
+    // Let the boxes come to rest
+    while (system.GetChTime() < 1.5) {
+        system.DoStepDynamics(time_step);
+    }
+
+    GetLog() << "Islands: " << system.GetNislands() << "  sleeping bodies: " << system.GetNbodiesSleeping() << "\n";
+    if (system.GetNislands() != 2 || system.GetNbodiesSleeping() != num_stacked + 1) {
+        GetLog() << "Boxes not sleeping in two islands\n";
+        passed = false;
+    }
+    int stack_island = system.GetBodyIsland(1);
+    for (int i = 1; i <= num_stacked; i++) {
+        if (system.GetBodyIsland(i) != stack_island || system.GetBodyIsland(num_stacked + 1) == stack_island) {
+            GetLog() << "Wrong island for body " << i << "\n";
+            passed = false;
+        }
+    }
+
+    // Throw a ball on the stack (with an initial speed, so that it is not a sleep candidate)
+    auto ball = std::shared_ptr<ChBody>(system.NewBody());
+    ball->SetMass(1);
+    ball->SetPos(ChVector<>(-0.5, num_stacked * size + 0.3, 0));
+    ball->SetPos_dt(ChVector<>(0, -1, 0));
+    ball->SetCollide(true);
+    ball->SetMaterialSurface(material);
+    ball->GetCollisionModel()->ClearModel();
+    ball->GetCollisionModel()->AddSphere(0.05);
+    ball->GetCollisionModel()->BuildModel();
+    system.AddBody(ball);
+
+    if (system.GetBodyIsland(num_stacked + 2) != -1) {
+        GetLog() << "Island reported for a body added after the partition\n";
+        passed = false;
+    }
+
+    bool woken = false;
+    while (system.GetChTime() < 2.0) {
+        system.DoStepDynamics(time_step);
+
+        int num_sleeping = 0;
+        for (auto& box : stack)
+            num_sleeping += box->GetSleeping();
+        if (num_sleeping != 0 && num_sleeping != num_stacked) {
+            GetLog() << "Stack partially woken up at time " << system.GetChTime() << "\n";
+            passed = false;
+            break;
+        }
+        woken |= (num_sleeping == 0);
+
+        if (!single->GetSleeping()) {
+            GetLog() << "Separate box woken up at time " << system.GetChTime() << "\n";
+            passed = false;
+            break;
+        }
+    }
+
+    if (!woken) {
+        GetLog() << "Stack not woken up by the ball\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
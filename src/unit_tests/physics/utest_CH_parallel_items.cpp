@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel processing of bodies and links in ChAssembly.
+// A chain of bodies connected by springs (which load forces on both bodies) is
+// hinged to ground and falls under gravity. The simulation is run serially and
+// in parallel mode with different numbers of threads. Parallel results must not
+// depend on the number of threads, and must match the serial ones up to round-off.
+// An asset shared by all bodies and links checks that assets are always updated
+// serially, outside of the parallel loops, and as many times as in serial mode.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "chrono/assets/ChAsset.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkSpring.h"
+#include "chrono/physics/ChSystem.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double end_time = 1.0;    // total simulation time
+double time_step = 1e-3;  // integration step size
+int num_bodies = 40;      // bodies in the chain
+
+// Asset counting its updates (not thread-safe), and those done from a parallel region.
+class CountingAsset : public ChAsset {
+  public:
+    CountingAsset() : num_updates(0), num_parallel_updates(0) {}
+    virtual void Update(ChPhysicsItem* updater, const ChCoordsys<>& coords) override {
+        num_updates++;
+#ifdef _OPENMP
+        if (omp_in_parallel())
+            num_parallel_updates++;
+#endif
+    }
+    int num_updates;
+    int num_parallel_updates;
+};
+
+// Run the simulation and return the final body positions.
+// Returns the number of asset updates (-1 if any was done in a parallel region).
+std::vector<ChVector<>> SimulateChain(bool parallel, int nthreads, int& num_colors, int& asset_updates) {
+    auto asset = std::make_shared<CountingAsset>();
+
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetParallelThreadNumber(nthreads);
+    system.SetUseParallelItems(parallel);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        body->SetPos(ChVector<>(0.5 * (i + 1), 0, 0));
+        body->AddAsset(asset);
+        system.AddBody(body);
+
+        if (i == 0) {
+            auto hinge = std::make_shared<ChLinkLockRevolute>();
+            hinge->Initialize(ground, body, ChCoordsys<>(ChVector<>(0.25, 0, 0), QUNIT));
+            system.AddLink(hinge);
+        } else {
+            // Two springs with offset end points, so that they also apply torques
+            for (int side = -1; side <= 1; side += 2) {
+                auto spring = std::make_shared<ChLinkSpring>();
+                spring->Initialize(prev, body, true, ChVector<>(0.2, 0, 0.1 * side), ChVector<>(-0.2, 0, 0.1 * side));
+                spring->Set_SpringK(2000);
+                spring->Set_SpringR(5);
+                spring->AddAsset(asset);
+                system.AddLink(spring);
+            }
+        }
+
+        bodies.push_back(body);
+        prev = body;
+    }
+
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+    }
+    num_colors = system.GetNlinkColors();
+
+    asset_updates = asset->num_parallel_updates ? -1 : asset->num_updates;
+
+    std::vector<ChVector<>> pos;
+    for (auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+int main(int argc, char* argv[]) {
+    int colors0, colors1, colors4;
+    int assets0, assets1, assets4;
+    auto pos0 = SimulateChain(false, 1, colors0, assets0);
+    auto pos1 = SimulateChain(true, 1, colors1, assets1);
+    auto pos4 = SimulateChain(true, 4, colors4, assets4);
+
+    GetLog() << "Number of link colors: " << colors1 << "\n";
+    GetLog() << "Chain end position:    " << pos0.back() << "\n";
+
+    bool passed = true;
+
+    GetLog() << "Asset updates:         " << assets0 << "  " << assets1 << "  " << assets4 << "\n";
+    if (assets0 <= 0 || assets1 != assets0 || assets4 != assets0) {
+        GetLog() << "Assets not updated serially\n";
+        passed = false;
+    }
+
+    if (colors0 != 0 || colors1 < 2 || colors1 != colors4) {
+        GetLog() << "Unexpected link coloring\n";
+        passed = false;
+    }
+
+    for (size_t i = 0; i < pos1.size(); i++) {
+        if (!(pos1[i] == pos4[i])) {
+            GetLog() << "Body " << (int)i << " depends on number of threads: " << pos1[i] << "  vs.  " << pos4[i]
+                     << "\n";
+            passed = false;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < pos0.size(); i++) {
+        if ((pos0[i] - pos1[i]).Length() > 1e-6) {
+            GetLog() << "Body " << (int)i << " differs from serial: " << pos0[i] << "  vs.  " << pos1[i] << "\n";
+            passed = false;
+            break;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
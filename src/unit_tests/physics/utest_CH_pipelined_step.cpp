@@ -0,0 +1,174 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the pipelined integration step (ChSystem::SetPipelinedStep).
+// A Newton's cradle: a row of spheres hinged to ground by revolute joints and
+// coupled by springs, the first one released from a raised position so that the
+// spheres keep colliding. The simulation is run with and without overlapping the
+// collision detection with the update of bodies and links, serially and with
+// parallel items. Results must be bitwise identical to the sequential step, and
+// the hinges must have been updated while the collision detection was running.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkSpring.h"
+#include "chrono/physics/ChSystem.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double end_time = 1.0;    // total simulation time
+double time_step = 1e-3;  // integration step size
+double radius = 0.05;     // sphere radius
+double length = 0.5;      // pendulum length
+int num_spheres = 5;      // spheres in the cradle
+
+// Revolute joint counting the updates done inside an OpenMP parallel region.
+class CountingRevolute : public ChLinkLockRevolute {
+  public:
+    CountingRevolute() : num_concurrent_updates(0) {}
+    virtual void Update(double mytime, bool update_assets) override {
+        ChLinkLockRevolute::Update(mytime, update_assets);
+#ifdef _OPENMP
+        if (omp_get_level() > 0) {
+#pragma omp atomic
+            num_concurrent_updates++;
+        }
+#endif
+    }
+    int num_concurrent_updates;
+};
+
+// Run the simulation and return the final sphere positions.
+std::vector<ChVector<>> SimulateCradle(bool pipelined, bool parallel, int& num_contacts, int& concurrent_updates) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetParallelThreadNumber(3);
+    system.SetUseParallelItems(parallel);
+    system.SetPipelinedStep(pipelined);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.2f);
+    material->SetRestitution(0.9f);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    std::vector<std::shared_ptr<CountingRevolute>> hinges;
+    for (int i = 0; i < num_spheres; i++) {
+        ChVector<> hinge_pos(2 * radius * i, length, 0);
+        ChVector<> sphere_pos = hinge_pos + ChVector<>(0, -length, 0);
+        if (i == 0)
+            sphere_pos = hinge_pos + length * ChVector<>(-std::sin(CH_C_PI / 6), -std::cos(CH_C_PI / 6), 0);
+
+        auto sphere = std::make_shared<ChBody>();
+        sphere->SetMass(1);
+        sphere->SetInertiaXX(0.4 * radius * radius * ChVector<>(1, 1, 1));
+        sphere->SetPos(sphere_pos);
+        sphere->SetCollide(true);
+        sphere->SetMaterialSurface(material);
+        sphere->GetCollisionModel()->ClearModel();
+        sphere->GetCollisionModel()->AddSphere(radius);
+        sphere->GetCollisionModel()->BuildModel();
+        system.AddBody(sphere);
+
+        auto hinge = std::make_shared<CountingRevolute>();
+        hinge->Initialize(ground, sphere, ChCoordsys<>(hinge_pos, QUNIT));
+        system.AddLink(hinge);
+
+        if (i > 0) {
+            auto spring = std::make_shared<ChLinkSpring>();
+            spring->Initialize(spheres.back(), sphere, false, spheres.back()->GetPos(), sphere->GetPos());
+            spring->Set_SpringK(10);
+            spring->Set_SpringR(0.1);
+            system.AddLink(spring);
+        }
+
+        spheres.push_back(sphere);
+        hinges.push_back(hinge);
+    }
+
+    num_contacts = 0;
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+        num_contacts += system.GetNcontacts();
+    }
+
+    concurrent_updates = 0;
+    for (auto& hinge : hinges)
+        concurrent_updates += hinge->num_concurrent_updates;
+
+    std::vector<ChVector<>> pos;
+    for (auto& sphere : spheres)
+        pos.push_back(sphere->GetPos());
+    return pos;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    for (int parallel = 0; parallel < 2; parallel++) {
+        int contacts_seq, contacts_pip;
+        int updates_seq, updates_pip;
+        auto pos_seq = SimulateCradle(false, parallel != 0, contacts_seq, updates_seq);
+        auto pos_pip = SimulateCradle(true, parallel != 0, contacts_pip, updates_pip);
+
+        GetLog() << (parallel ? "Parallel" : "Serial") << " items\n";
+        GetLog() << "  Contacts over all steps:   " << contacts_seq << "  vs.  " << contacts_pip << "\n";
+        GetLog() << "  Concurrent hinge updates:  " << updates_seq << "  vs.  " << updates_pip << "\n";
+        GetLog() << "  Last sphere position:      " << pos_seq.back() << "\n";
+
+        if (contacts_seq == 0 || contacts_seq != contacts_pip) {
+            GetLog() << "Contacts differ\n";
+            passed = false;
+        }
+
+#ifdef _OPENMP
+        if (updates_pip == 0 || (!parallel && updates_seq != 0)) {
+            GetLog() << "Hinges not updated concurrently with the collision detection\n";
+            passed = false;
+        }
+#endif
+
+        for (size_t i = 0; i < pos_seq.size(); i++) {
+            if (!(pos_seq[i] == pos_pip[i])) {
+                GetLog() << "Sphere " << (int)i << " differs: " << pos_seq[i] << "  vs.  " << pos_pip[i] << "\n";
+                passed = false;
+                break;
+            }
+        }
+
+        // The last sphere must have been hit through the others
+        if (pos_seq.back().x() <= 2 * radius * (num_spheres - 1) + 1e-3) {
+            GetLog() << "Last sphere did not move\n";
+            passed = false;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
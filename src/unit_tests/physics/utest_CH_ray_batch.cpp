@@ -0,0 +1,160 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched ray-hit tests of the Bullet collision system.
+// A grid of vertical rays is cast on a sphere, a box, a compound of two spheres
+// and two triangle meshes (convex decomposition and GImpact), in different
+// collision families, above a ground box. A box that does not collide with
+// family 0 floats above them.
+// The results of RayHitBatch must match those of RayHit (which DeformableTerrain
+// used to call for each vertex): rays are in family 0, so that the floating box
+// is never hit. Rays filtered by family must hit the objects behind the excluded
+// ones.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/collision/ChCModelBullet.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/physics/ChSystem.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+std::shared_ptr<ChBody> AddBody(ChSystem& system, const ChVector<>& pos, int family) {
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(pos);
+    body->SetBodyFixed(true);
+    body->SetCollide(true);
+    body->GetCollisionModel()->ClearModel();
+    body->GetCollisionModel()->SetFamily(family);
+    system.AddBody(body);
+    return body;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystem system;
+
+    auto sphere = AddBody(system, ChVector<>(0, 0, 0), 0);
+    sphere->GetCollisionModel()->AddSphere(0.5);
+    sphere->GetCollisionModel()->BuildModel();
+
+    auto box = AddBody(system, ChVector<>(2, 0, 0), 1);
+    box->GetCollisionModel()->AddBox(0.5, 0.5, 0.5);
+    box->GetCollisionModel()->BuildModel();
+
+    // Compound shape, whose children are tested one by one by RayHitBatch
+    auto compound = AddBody(system, ChVector<>(3, 0, 0), 0);
+    compound->GetCollisionModel()->AddSphere(0.25, ChVector<>(0, 0, -0.3));
+    compound->GetCollisionModel()->AddSphere(0.25, ChVector<>(0, 0, 0.3));
+    compound->GetCollisionModel()->BuildModel();
+
+    // Box excluding family 0, missed by all rays
+    auto floating = AddBody(system, ChVector<>(1, 1.2, 0), 4);
+    floating->GetCollisionModel()->AddBox(0.3, 0.3, 0.3);
+    floating->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(0);
+    floating->GetCollisionModel()->BuildModel();
+
+    geometry::ChTriangleMeshSoup trimesh;
+    trimesh.addTriangle(ChVector<>(-0.5, 0, -0.5), ChVector<>(-0.5, 0, 0.5), ChVector<>(0.5, 0, 0.5));
+    trimesh.addTriangle(ChVector<>(-0.5, 0, -0.5), ChVector<>(0.5, 0, 0.5), ChVector<>(0.5, 0, -0.5));
+    auto mesh = AddBody(system, ChVector<>(4, 0, 0), 2);
+    mesh->GetCollisionModel()->AddTriangleMesh(trimesh, false, false);
+    mesh->GetCollisionModel()->BuildModel();
+
+    // GImpact shapes are tested separately by RayHitBatch
+    auto concave = AddBody(system, ChVector<>(5.5, 0, 0), 2);
+    std::static_pointer_cast<ChModelBullet>(concave->GetCollisionModel())->AddTriangleMeshConcave(trimesh);
+    concave->GetCollisionModel()->BuildModel();
+
+    auto ground = AddBody(system, ChVector<>(2, -2, 0), 3);
+    ground->GetCollisionModel()->AddBox(5, 0.5, 5);
+    ground->GetCollisionModel()->BuildModel();
+
+    system.DoStepDynamics(1e-3);
+
+    // Grid of vertical rays
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int ix = 0; ix <= 150; ix++) {
+        for (int iz = 0; iz <= 12; iz++) {
+            ChCollisionSystem::ChRay ray;
+            ray.from = ChVector<>(-1 + 0.05 * ix, 2, -0.6 + 0.1 * iz);
+            ray.to = ray.from - ChVector<>(0, 5, 0);
+            rays.push_back(ray);
+        }
+    }
+
+    bool passed = true;
+    auto collision_system = system.GetCollisionSystem();
+
+    // Batched and single ray-hit tests must agree
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    collision_system->RayHitBatch(rays, results);
+    int num_hits[5] = {0, 0, 0, 0, 0};
+    int num_hits_concave = 0;
+    int num_hits_compound = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        collision_system->RayHit(rays[i].from, rays[i].to, result);
+        if (result.hit != results[i].hit ||
+            (result.hit && (result.hitModel != results[i].hitModel ||
+                            (result.abs_hitPoint - results[i].abs_hitPoint).Length() > 1e-9))) {
+            GetLog() << "Ray " << (int)i << ": RayHitBatch differs from RayHit\n";
+            passed = false;
+            break;
+        }
+        if (result.hit)
+            num_hits[result.hitModel->GetFamily()]++;
+        if (result.hit && result.hitModel == concave->GetCollisionModel().get())
+            num_hits_concave++;
+        if (result.hit && result.hitModel == compound->GetCollisionModel().get())
+            num_hits_compound++;
+    }
+    GetLog() << "Hits on spheres: " << num_hits[0] << " (compound: " << num_hits_compound
+             << ")  box: " << num_hits[1] << "  meshes: " << num_hits[2] << " (GImpact: " << num_hits_concave
+             << ")  ground: " << num_hits[3] << "  floating box: " << num_hits[4] << "\n";
+    if (num_hits[0] == num_hits_compound || num_hits_compound == 0 || num_hits[1] == 0 || num_hits_concave == 0 ||
+        num_hits[2] == num_hits_concave || num_hits[3] == 0 || num_hits[4] != 0)
+        passed = false;
+
+    // Excluding the box and the meshes, their rays must hit the ground (up to the collision envelope)
+    short int family_mask = 0x7FFF & ~(1 << 1) & ~(1 << 2);
+    std::vector<ChCollisionSystem::ChRayhitResult> results_filtered;
+    collision_system->RayHitBatch(rays, results_filtered, family_mask);
+    for (size_t i = 0; i < rays.size(); i++) {
+        if (!results[i].hit)
+            continue;
+        int family = results[i].hitModel->GetFamily();
+        bool ok = results_filtered[i].hit;
+        if (ok && (family == 1 || family == 2))
+            ok = results_filtered[i].hitModel == ground->GetCollisionModel().get() &&
+                 std::abs(results_filtered[i].abs_hitPoint.y() + 1.5) < 0.05;
+        else if (ok)
+            ok = results_filtered[i].hitModel == results[i].hitModel;
+        if (!ok) {
+            GetLog() << "Ray " << (int)i << ": unexpected hit with family filter\n";
+            passed = false;
+            break;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the graph-colored parallel SOR solver (ChSolverSORcolored).
+// A pile of spheres settles in a box. The same problem is run with different
+// numbers of threads and the resulting body states must be bitwise identical.
+// The pile must also be supported by the container (no sphere below the floor).
+// The coloring must be reused as long as the layout of the problem does not change.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverSORcolored.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+double end_time = 0.5;    // total simulation time
+double time_step = 1e-3;  // integration step size
+double radius = 0.05;     // sphere radius
+int num_layers = 4;       // layers of spheres in the pile
+int num_per_side = 4;     // spheres per side in each layer
+
+// Run the simulation with the given number of threads and return the final body positions.
+std::vector<ChVector<>> SimulatePile(int nthreads, int& num_colors, double& min_height, bool& reused) {
+    ChSystem system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetSolverType(ChSolver::Type::SOR_COLORED);
+    system.SetParallelThreadNumber(nthreads);
+    system.SetMaxItersSolverSpeed(60);
+
+    auto material = std::make_shared<ChMaterialSurface>();
+    material->SetFriction(0.4f);
+
+    utils::CreateBoxContainer(&system, 0, material, ChVector<>(0.5, 0.5, 0.5), 0.05, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+
+    std::vector<std::shared_ptr<ChBody>> balls;
+    int id = 1;
+    for (int iy = 0; iy < num_layers; iy++) {
+        for (int ix = 0; ix < num_per_side; ix++) {
+            for (int iz = 0; iz < num_per_side; iz++) {
+                // Small per-layer offset so that spheres rest on each other
+                double shift = (iy % 2) * 0.5 * radius;
+                auto ball = std::shared_ptr<ChBody>(system.NewBody());
+                ball->SetIdentifier(id++);
+                ball->SetMass(1);
+                ball->SetInertiaXX(0.4 * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(ChVector<>((ix - 1.5) * 2.05 * radius + shift, (2 * iy + 1) * 1.05 * radius,
+                                        (iz - 1.5) * 2.05 * radius + shift));
+                ball->SetCollide(true);
+                ball->SetMaterialSurface(material);
+                ball->GetCollisionModel()->ClearModel();
+                ball->GetCollisionModel()->AddSphere(radius);
+                ball->GetCollisionModel()->BuildModel();
+                system.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    num_colors = 0;
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+        auto solver = std::static_pointer_cast<ChSolverSORcolored>(system.GetSolver());
+        num_colors = ChMax(num_colors, solver->GetNumColors());
+    }
+
+    // Solving again the same problem must not color the constraints again
+    auto solver = std::static_pointer_cast<ChSolverSORcolored>(system.GetSolver());
+    int num_colorings = solver->GetNumColorings();
+    solver->Solve(*system.GetSystemDescriptor());
+    reused = (solver->GetNumColorings() == num_colorings);
+    GetLog() << "Colorings: " << num_colorings << " in " << (int)(end_time / time_step + 0.5) << " steps\n";
+
+    std::vector<ChVector<>> pos;
+    min_height = 1e30;
+    for (auto& ball : balls) {
+        pos.push_back(ball->GetPos());
+        min_height = ChMin(min_height, ball->GetPos().y());
+    }
+    return pos;
+}
+
+int main(int argc, char* argv[]) {
+    int colors1, colors4;
+    double height1, height4;
+    bool reused1, reused4;
+    auto pos1 = SimulatePile(1, colors1, height1, reused1);
+    auto pos4 = SimulatePile(4, colors4, height4, reused4);
+
+    GetLog() << "Max. number of colors: " << colors1 << "\n";
+    GetLog() << "Lowest sphere center:  " << height1 << "\n";
+
+    bool passed = true;
+
+    if (!reused1 || !reused4) {
+        GetLog() << "Coloring not reused for an unchanged problem\n";
+        passed = false;
+    }
+
+    if (colors1 != colors4) {
+        GetLog() << "Coloring depends on number of threads\n";
+        passed = false;
+    }
+
+    for (size_t i = 0; i < pos1.size(); i++) {
+        if (!(pos1[i] == pos4[i])) {
+            GetLog() << "Body " << (int)i << " differs: " << pos1[i] << "  vs.  " << pos4[i] << "\n";
+            passed = false;
+            break;
+        }
+    }
+
+    if (height1 < 0.5 * radius) {
+        GetLog() << "Pile not supported by the container\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}